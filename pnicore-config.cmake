@@ -9,4 +9,9 @@ if((NOT TARGET Boost::system) AND (NOT TARGET Boost::program_options))
 	endif()
 endif()
 link_directories(${Boost_LIBRARY_DIRS})
+
+# the library links publicly against the platform thread library
+if(NOT TARGET Threads::Threads)
+	find_package(Threads REQUIRED)
+endif()
 include(${CMAKE_CURRENT_LIST_DIR}/pnicore_targets.cmake)
@@ -24,6 +24,7 @@
 #pragma once
 
 #include <pni/core/algorithms.hpp>
+#include <pni/core/algorithms/reductions.hpp>
 #include <pni/core/arrays.hpp>
 #include <pni/core/benchmark.hpp>
 #include <pni/core/configuration.hpp>
@@ -0,0 +1,408 @@
+//
+// (c) Copyright 2026 DESY, Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+// This file is part of libpnicore.
+//
+// libpnicore is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpnicore is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpnicore.  If not, see <http://www.gnu.org/licenses/>.
+//
+// ============================================================================
+//
+// Created on: Oct 16, 2026
+//     Author: Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+#pragma once
+
+#include <memory>
+#include <algorithm>
+#include <type_traits>
+
+#include <pni/core/types.hpp>
+#include <pni/core/arrays.hpp>
+#include <pni/core/algorithms/math/expression_evaluator.hpp>
+#include <pni/core/algorithms/comparisons/comparison_kernels.hpp>
+
+namespace pni{
+namespace core{
+
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief blocks of elements to compare
+    //!
+    //! Provides consecutive blocks of at most expression_block elements
+    //! of an array or expression converted to the comparison type T.
+    //! Contiguous arrays of type T are used in place, expressions are
+    //! evaluated block by block with the expression evaluator.
+    //!
+    //! \tparam ATYPE array or expression type
+    //! \tparam T comparison type
+    //!
+    template<
+             typename ATYPE,
+             typename T
+            >
+    class comparison_source
+    {
+        private:
+            //! element type
+            typedef typename ATYPE::value_type value_type;
+            //! evaluator type
+            typedef expression_evaluator<ATYPE> evaluator_type;
+
+            //! the data
+            const ATYPE &_a;
+            //! block buffer followed by the scratch buffers
+            std::unique_ptr<value_type[]> _buffer;
+            //! buffer for converted elements
+            std::unique_ptr<T[]> _converted;
+
+            //-----------------------------------------------------------------
+            //! load with the expression evaluator
+            const value_type *_load(size_t offset,size_t n,std::true_type)
+            {
+                return evaluator_type::load(_a,offset,n,_buffer.get(),
+                                            _buffer.get()+expression_block);
+            }
+
+            //-----------------------------------------------------------------
+            //! load element by element
+            const value_type *_load(size_t offset,size_t n,std::false_type)
+            {
+                for(size_t i=0;i<n;++i) _buffer[i] = _a[offset+i];
+                return _buffer.get();
+            }
+
+            //-----------------------------------------------------------------
+            //! no conversion required
+            const T *_convert(const T *p,size_t,std::true_type) { return p; }
+
+            //-----------------------------------------------------------------
+            //! convert to the comparison type
+            const T *_convert(const value_type *p,size_t n,std::false_type)
+            {
+                std::copy(p,p+n,_converted.get());
+                return _converted.get();
+            }
+        public:
+            //-----------------------------------------------------------------
+            //! constructor
+            explicit comparison_source(const ATYPE &a):
+                _a(a),
+                _buffer(new value_type[(evaluator_type::buffers+1)*
+                                       expression_block]),
+                _converted(std::is_same<value_type,T>::value ? nullptr :
+                           new T[expression_block])
+            {}
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief load a block
+            //!
+            //! The pointer remains valid until the next call.
+            //!
+            //! \param offset linear index of the first element
+            //! \param n number of elements (at most expression_block)
+            //! \return pointer to the elements
+            //!
+            const T *load(size_t offset,size_t n)
+            {
+                typedef std::integral_constant<bool,
+                            evaluator_type::is_fusable> fusable_type;
+                typedef std::integral_constant<bool,
+                            std::is_same<value_type,T>::value> same_type;
+
+                return _convert(_load(offset,n,fusable_type()),n,
+                                same_type());
+            }
+    };
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief blocks of elements of a view to compare
+    //!
+    //! Contiguous views are used in place. The elements of all other views
+    //! are gathered with the view iterator so the blocks must be loaded
+    //! in order.
+    //!
+    //! \tparam ATYPE array type of the view
+    //! \tparam T comparison type
+    //!
+    template<
+             typename ATYPE,
+             typename T
+            >
+    class comparison_source<array_view<ATYPE>,T>
+    {
+        private:
+            //! view type
+            typedef array_view<ATYPE> view_type;
+            //! element type
+            typedef typename view_type::value_type value_type;
+
+            //! pointer to the data of a contiguous view
+            const value_type *_data;
+            //! iterator to the next element
+            typename view_type::const_iterator _iter;
+            //! block buffer
+            std::unique_ptr<T[]> _buffer;
+
+            //-----------------------------------------------------------------
+            //! use the data in place
+            const T *_load(size_t offset,size_t,std::true_type)
+            {
+                return _data+offset;
+            }
+
+            //-----------------------------------------------------------------
+            //! gather the elements in the buffer
+            const T *_load(size_t offset,size_t n,std::false_type)
+            {
+                if(_data) std::copy(_data+offset,_data+offset+n,
+                                    _buffer.get());
+                else
+                    for(size_t i=0;i<n;++i,++_iter) _buffer[i] = *_iter;
+
+                return _buffer.get();
+            }
+        public:
+            //-----------------------------------------------------------------
+            //! constructor
+            explicit comparison_source(const view_type &v):
+                _data(v.is_contiguous() ? v.data() : nullptr),
+                _iter(v.begin()),
+                _buffer(new T[expression_block])
+            {}
+
+            //-----------------------------------------------------------------
+            //! load a block
+            const T *load(size_t offset,size_t n)
+            {
+                typedef std::integral_constant<bool,
+                            std::is_same<value_type,T>::value> same_type;
+
+                if(_data && same_type::value)
+                    return _load(offset,n,same_type());
+
+                return _load(offset,n,std::false_type());
+            }
+    };
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief find the first mismatch between two arrays
+    //!
+    //! Loads both operands block by block and passes the blocks to the
+    //! kernel. The search stops at the first block for which the kernel
+    //! reports a mismatch.
+    //!
+    //! \tparam T comparison type
+    //! \tparam ATYPE type of the first operand
+    //! \tparam BTYPE type of the second operand
+    //! \tparam KERNEL kernel type
+    //! \param a first operand
+    //! \param b second operand
+    //! \param kernel callable with (const T*,const T*,size_t) returning the
+    //!        index of the first mismatch in the block or the block size
+    //! \return linear index of the first mismatch or a.size()
+    //!
+    template<
+             typename T,
+             typename ATYPE,
+             typename BTYPE,
+             typename KERNEL
+            >
+    size_t find_mismatch(const ATYPE &a,const BTYPE &b,KERNEL kernel)
+    {
+        static_assert(has_same_storage_order<ATYPE,BTYPE>::value,
+                      "Arrays must have the same storage order!");
+
+        comparison_source<ATYPE,T> sa(a);
+        comparison_source<BTYPE,T> sb(b);
+
+        size_t size = a.size();
+        for(size_t offset=0;offset<size;offset+=expression_block)
+        {
+            size_t n = std::min(expression_block,size-offset);
+            size_t index = kernel(sa.load(offset,n),sb.load(offset,n),n);
+            if(index<n) return offset+index;
+        }
+        return size;
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief check if two operands have the same shape
+    //!
+    template<
+             typename ATYPE,
+             typename BTYPE
+            >
+    bool equal_shape(const ATYPE &a,const BTYPE &b)
+    {
+        return a.template shape<shape_t>() == b.template shape<shape_t>();
+    }
+
+    //=========================================================================
+    //!
+    //! \ingroup mdim_array_classes
+    //! \brief check if two arrays are equal
+    //!
+    //! Two arrays are equal if they have the same shape and all their
+    //! elements are equal. The elements are compared in blocks with the
+    //! search stopping at the first block containing a difference.
+    //! Contiguous integer data is compared with memcmp, floating point and
+    //! complex data with vector kernels. If the element types differ the
+    //! elements are converted to their common type.
+    /*!
+    \code
+    size_t index;
+    if(!array_equal(volume,reference,index))
+        std::cerr<<"first difference at "<<index<<std::endl;
+    \endcode
+    !*/
+    //!
+    //! \tparam ATYPE array, view, or expression type
+    //! \tparam BTYPE array, view, or expression type
+    //! \param a first operand
+    //! \param b second operand
+    //! \param index linear index (storage order) of the first unequal 
+    //!        element, a.size() if the arrays are equal, 0 if the shapes 
+    //!        differ
+    //! \return true if the arrays are equal
+    //!
+    template<
+             typename ATYPE,
+             typename BTYPE
+            >
+    bool array_equal(const ATYPE &a,const BTYPE &b,size_t &index)
+    {
+        typedef typename std::common_type<typename ATYPE::value_type,
+                                          typename BTYPE::value_type>::type
+                                          compare_type;
+
+        if(!equal_shape(a,b))
+        {
+            index = 0;
+            return false;
+        }
+
+        index = find_mismatch<compare_type>(a,b,
+                    [](const compare_type *pa,const compare_type *pb,size_t n)
+                    { return find_unequal(pa,pb,n); });
+        return index == a.size();
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_classes
+    //! \brief check if two arrays are equal
+    //!
+    //! \tparam ATYPE array, view, or expression type
+    //! \tparam BTYPE array, view, or expression type
+    //! \param a first operand
+    //! \param b second operand
+    //! \return true if the arrays are equal
+    //!
+    template<
+             typename ATYPE,
+             typename BTYPE
+            >
+    bool array_equal(const ATYPE &a,const BTYPE &b)
+    {
+        size_t index;
+        return array_equal(a,b,index);
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_classes
+    //! \brief check if two arrays are equal within a tolerance
+    //!
+    //! Returns true if both arrays have the same shape and for all
+    //! elements either a==b or |a-b| <= atol + rtol*|b|. The test is not
+    //! symmetric - b is the reference. NaN values are never close.
+    //! Floating point and complex data is compared with vector kernels,
+    //! integers are compared as float64 values. The search stops at the
+    //! first block containing a mismatch.
+    /*!
+    \code
+    size_t index;
+    if(!allclose(volume,reference,1e-5,1e-8,index))
+        std::cerr<<"first mismatch at "<<index<<std::endl;
+    \endcode
+    !*/
+    //!
+    //! \tparam ATYPE array, view, or expression type
+    //! \tparam BTYPE array, view, or expression type
+    //! \param a first operand
+    //! \param b reference
+    //! \param rtol relative tolerance
+    //! \param atol absolute tolerance
+    //! \param index linear index (storage order) of the first mismatch, 
+    //!        a.size() if all elements are close, 0 if the shapes differ
+    //! \return true if all elements are close
+    //!
+    template<
+             typename ATYPE,
+             typename BTYPE
+            >
+    bool allclose(const ATYPE &a,const BTYPE &b,float64 rtol,float64 atol,
+                  size_t &index)
+    {
+        typedef typename std::common_type<typename ATYPE::value_type,
+                                          typename BTYPE::value_type>::type
+                                          compare_type;
+
+        if(!equal_shape(a,b))
+        {
+            index = 0;
+            return false;
+        }
+
+        index = find_mismatch<compare_type>(a,b,
+                    [rtol,atol](const compare_type *pa,
+                                const compare_type *pb,size_t n)
+                    { return find_not_close(pa,pb,n,rtol,atol); });
+        return index == a.size();
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_classes
+    //! \brief check if two arrays are equal within a tolerance
+    //!
+    //! \tparam ATYPE array, view, or expression type
+    //! \tparam BTYPE array, view, or expression type
+    //! \param a first operand
+    //! \param b reference
+    //! \param rtol relative tolerance
+    //! \param atol absolute tolerance
+    //! \return true if all elements are close
+    //!
+    template<
+             typename ATYPE,
+             typename BTYPE
+            >
+    bool allclose(const ATYPE &a,const BTYPE &b,float64 rtol = 1e-5,
+                  float64 atol = 1e-8)
+    {
+        size_t index;
+        return allclose(a,b,rtol,atol,index);
+    }
+
+//end of namespace
+}
+}
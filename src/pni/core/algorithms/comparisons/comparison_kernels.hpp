@@ -0,0 +1,453 @@
+//
+// (c) Copyright 2026 DESY, Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+// This file is part of libpnicore.
+//
+// libpnicore is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpnicore is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpnicore.  If not, see <http://www.gnu.org/licenses/>.
+//
+// ============================================================================
+//
+// Created on: Oct 16, 2026
+//     Author: Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+#pragma once
+
+#include <cmath>
+#include <cstring>
+#include <complex>
+#include <limits>
+#include <type_traits>
+
+#include <pni/core/types.hpp>
+#include <pni/core/algorithms/math/simd_kernels.hpp>
+
+namespace pni{
+namespace core{
+
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief check if two floating point values are close
+    //!
+    //! Two values are close if they are equal or if
+    //! |a-b| <= atol + rtol*|b| with |a-b| being finite. Thus infinite
+    //! values are only close to themselves and NaN is never close to
+    //! anything.
+    //!
+    //! \tparam T floating point type
+    //! \param a first value
+    //! \param b reference value
+    //! \param rtol relative tolerance
+    //! \param atol absolute tolerance
+    //! \return true if the values are close
+    //!
+    template<typename T>
+    bool is_close(T a,T b,T rtol,T atol)
+    {
+        T d = std::abs(a-b);
+        return a==b || (d <= atol+rtol*std::abs(b) &&
+                        d <= std::numeric_limits<T>::max());
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief check if two complex values are close
+    //!
+    //! The magnitudes are computed as sqrt(re*re+im*im) so that the result
+    //! is the same as the one of the vector kernels.
+    //!
+    template<typename T>
+    bool is_close(const std::complex<T> &a,const std::complex<T> &b,T rtol,
+                  T atol)
+    {
+        T dr = a.real()-b.real();
+        T di = a.imag()-b.imag();
+        T br = b.real();
+        T bi = b.imag();
+        T d = std::sqrt(dr*dr+di*di);
+        return a==b || (d <= atol+rtol*std::sqrt(br*br+bi*bi) &&
+                        d <= std::numeric_limits<T>::max());
+    }
+
+    //=========================================================================
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief vector kernel comparing two buffers
+    //!
+    //! The default template is used for all combinations of instruction
+    //! set and lane type without a vector kernel. Specializations provide
+    //! two static member functions
+    //!
+    //! \li real(a,b,n,rtol,atol) for n values of type LANE
+    //! \li complex(a,b,n,rtol,atol) for n complex values
+    //!
+    //! both returning the index of the first element of a which is not
+    //! close to the corresponding element of b, or n if all elements are
+    //! close. The vector code only filters blocks in which all elements
+    //! are close, every other block is checked with is_close().
+    //!
+    //! \tparam ISA instruction set level
+    //! \tparam LANE lane type (float32 or float64)
+    //!
+    template<
+             simd_isa_t ISA,
+             typename   LANE
+            >
+    struct simd_close_kernel
+    {
+        //! no kernel available
+        static const bool available = false;
+
+        //! compare real values
+        static size_t real(const LANE *a,const LANE *b,size_t n,LANE rtol,
+                           LANE atol)
+        {
+            for(size_t i=0;i<n;++i)
+                if(!is_close(a[i],b[i],rtol,atol)) return i;
+            return n;
+        }
+
+        //! compare complex values
+        static size_t complex(const std::complex<LANE> *a,
+                              const std::complex<LANE> *b,size_t n,
+                              LANE rtol,LANE atol)
+        {
+            for(size_t i=0;i<n;++i)
+                if(!is_close(a[i],b[i],rtol,atol)) return i;
+            return n;
+        }
+    };
+
+#ifdef PNI_CORE_X86_SIMD
+
+#define PNI_CLOSE_REAL_KERNEL(TARGET,LANE,REG,LOAD,SET1,ADD,SUB,MUL,MIN,\
+                              ANDNOT,CMPLE,MOVEMASK)\
+    __attribute__((target(TARGET)))\
+    static size_t real(const LANE *a,const LANE *b,size_t n,LANE rtol,\
+                       LANE atol)\
+    {\
+        const size_t width = sizeof(REG)/sizeof(LANE);\
+        const int all = (1<<width)-1;\
+        const REG sign = SET1(LANE(-0.0));\
+        const REG r = SET1(rtol);\
+        const REG t = SET1(atol);\
+        const REG max = SET1(std::numeric_limits<LANE>::max());\
+        size_t i = 0;\
+        for(;i+width<=n;i+=width)\
+        {\
+            REG va = LOAD(a+i);\
+            REG vb = LOAD(b+i);\
+            REG d = ANDNOT(sign,SUB(va,vb));\
+            REG tol = MIN(ADD(t,MUL(r,ANDNOT(sign,vb))),max);\
+            if(MOVEMASK(CMPLE(d,tol))==all) continue;\
+            for(size_t j=i;j<i+width;++j)\
+                if(!is_close(a[j],b[j],rtol,atol)) return j;\
+        }\
+        for(;i<n;++i) if(!is_close(a[i],b[i],rtol,atol)) return i;\
+        return n;\
+    }
+
+#define PNI_AVX_CMPLE_PS(a,b) _mm256_cmp_ps(a,b,_CMP_LE_OQ)
+#define PNI_AVX_CMPLE_PD(a,b) _mm256_cmp_pd(a,b,_CMP_LE_OQ)
+
+    //! \cond NO_API_DOC
+    template<> struct simd_close_kernel<simd_isa_t::SSE2,float32>
+    {
+        static const bool available = true;
+
+        PNI_CLOSE_REAL_KERNEL("sse2",float32,__m128,_mm_loadu_ps,_mm_set1_ps,
+                              _mm_add_ps,_mm_sub_ps,_mm_mul_ps,_mm_min_ps,
+                              _mm_andnot_ps,_mm_cmple_ps,_mm_movemask_ps)
+
+        static size_t complex(const complex32 *a,const complex32 *b,size_t n,
+                              float32 rtol,float32 atol)
+        {
+            return simd_close_kernel<simd_isa_t::NONE,float32>::complex(
+                    a,b,n,rtol,atol);
+        }
+    };
+
+    template<> struct simd_close_kernel<simd_isa_t::SSE2,float64>
+    {
+        static const bool available = true;
+
+        PNI_CLOSE_REAL_KERNEL("sse2",float64,__m128d,_mm_loadu_pd,
+                              _mm_set1_pd,_mm_add_pd,_mm_sub_pd,_mm_mul_pd,
+                              _mm_min_pd,_mm_andnot_pd,_mm_cmple_pd,
+                              _mm_movemask_pd)
+
+        static size_t complex(const complex64 *a,const complex64 *b,size_t n,
+                              float64 rtol,float64 atol)
+        {
+            return simd_close_kernel<simd_isa_t::NONE,float64>::complex(
+                    a,b,n,rtol,atol);
+        }
+    };
+
+    template<> struct simd_close_kernel<simd_isa_t::AVX2,float32>
+    {
+        static const bool available = true;
+
+        PNI_CLOSE_REAL_KERNEL("avx2",float32,__m256,_mm256_loadu_ps,
+                              _mm256_set1_ps,_mm256_add_ps,_mm256_sub_ps,
+                              _mm256_mul_ps,_mm256_min_ps,_mm256_andnot_ps,
+                              PNI_AVX_CMPLE_PS,_mm256_movemask_ps)
+
+        //four complex numbers per register - the horizontal addition
+        //yields |d0|^2 |d1|^2 |b0|^2 |b1|^2 in every 128Bit half
+        __attribute__((target("avx2")))
+        static size_t complex(const complex32 *a,const complex32 *b,size_t n,
+                              float32 rtol,float32 atol)
+        {
+            const __m256 r = _mm256_set1_ps(rtol);
+            const __m256 t = _mm256_set1_ps(atol);
+            const __m256 max = _mm256_set1_ps(
+                    std::numeric_limits<float32>::max());
+            const float32 *pa = reinterpret_cast<const float32*>(a);
+            const float32 *pb = reinterpret_cast<const float32*>(b);
+            size_t i = 0;
+            for(;i+4<=n;i+=4)
+            {
+                __m256 va = _mm256_loadu_ps(pa+2*i);
+                __m256 vb = _mm256_loadu_ps(pb+2*i);
+                __m256 d = _mm256_sub_ps(va,vb);
+                __m256 s = _mm256_sqrt_ps(
+                        _mm256_hadd_ps(_mm256_mul_ps(d,d),
+                                       _mm256_mul_ps(vb,vb)));
+                __m256 sb = _mm256_permute_ps(s,_MM_SHUFFLE(1,0,3,2));
+                __m256 tol = _mm256_min_ps(
+                        _mm256_add_ps(t,_mm256_mul_ps(r,sb)),max);
+                int mask = _mm256_movemask_ps(PNI_AVX_CMPLE_PS(s,tol));
+                if((mask&0x33)==0x33) continue;
+                for(size_t j=i;j<i+4;++j)
+                    if(!is_close(a[j],b[j],rtol,atol)) return j;
+            }
+            for(;i<n;++i) if(!is_close(a[i],b[i],rtol,atol)) return i;
+            return n;
+        }
+    };
+
+    template<> struct simd_close_kernel<simd_isa_t::AVX2,float64>
+    {
+        static const bool available = true;
+
+        PNI_CLOSE_REAL_KERNEL("avx2",float64,__m256d,_mm256_loadu_pd,
+                              _mm256_set1_pd,_mm256_add_pd,_mm256_sub_pd,
+                              _mm256_mul_pd,_mm256_min_pd,_mm256_andnot_pd,
+                              PNI_AVX_CMPLE_PD,_mm256_movemask_pd)
+
+        //two complex numbers per register - the horizontal addition
+        //yields |d0|^2 |b0|^2 |d1|^2 |b1|^2
+        __attribute__((target("avx2")))
+        static size_t complex(const complex64 *a,const complex64 *b,size_t n,
+                              float64 rtol,float64 atol)
+        {
+            const __m256d r = _mm256_set1_pd(rtol);
+            const __m256d t = _mm256_set1_pd(atol);
+            const __m256d max = _mm256_set1_pd(
+                    std::numeric_limits<float64>::max());
+            const float64 *pa = reinterpret_cast<const float64*>(a);
+            const float64 *pb = reinterpret_cast<const float64*>(b);
+            size_t i = 0;
+            for(;i+2<=n;i+=2)
+            {
+                __m256d va = _mm256_loadu_pd(pa+2*i);
+                __m256d vb = _mm256_loadu_pd(pb+2*i);
+                __m256d d = _mm256_sub_pd(va,vb);
+                __m256d s = _mm256_sqrt_pd(
+                        _mm256_hadd_pd(_mm256_mul_pd(d,d),
+                                       _mm256_mul_pd(vb,vb)));
+                __m256d sb = _mm256_permute_pd(s,0x5);
+                __m256d tol = _mm256_min_pd(
+                        _mm256_add_pd(t,_mm256_mul_pd(r,sb)),max);
+                int mask = _mm256_movemask_pd(PNI_AVX_CMPLE_PD(s,tol));
+                if((mask&0x5)==0x5) continue;
+                for(size_t j=i;j<i+2;++j)
+                    if(!is_close(a[j],b[j],rtol,atol)) return j;
+            }
+            for(;i<n;++i) if(!is_close(a[i],b[i],rtol,atol)) return i;
+            return n;
+        }
+    };
+    //! \endcond
+
+#undef PNI_AVX_CMPLE_PD
+#undef PNI_AVX_CMPLE_PS
+#undef PNI_CLOSE_REAL_KERNEL
+
+#endif
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief run the best comparison kernel available
+    //!
+    //! \tparam LANE lane type
+    //!
+    template<typename LANE> struct simd_close_dispatch
+    {
+        typedef simd_close_kernel<simd_isa_t::AVX2,LANE> avx2_kernel;
+        typedef simd_close_kernel<simd_isa_t::SSE2,LANE> sse2_kernel;
+        typedef simd_close_kernel<simd_isa_t::NONE,LANE> scalar_kernel;
+
+        //! compare real values
+        static size_t real(const LANE *a,const LANE *b,size_t n,LANE rtol,
+                           LANE atol)
+        {
+            simd_isa_t isa = simd_isa();
+            if(avx2_kernel::available && isa>=simd_isa_t::AVX2)
+                return avx2_kernel::real(a,b,n,rtol,atol);
+            if(sse2_kernel::available && isa>=simd_isa_t::SSE2)
+                return sse2_kernel::real(a,b,n,rtol,atol);
+            return scalar_kernel::real(a,b,n,rtol,atol);
+        }
+
+        //! compare complex values
+        static size_t complex(const std::complex<LANE> *a,
+                              const std::complex<LANE> *b,size_t n,
+                              LANE rtol,LANE atol)
+        {
+            simd_isa_t isa = simd_isa();
+            if(avx2_kernel::available && isa>=simd_isa_t::AVX2)
+                return avx2_kernel::complex(a,b,n,rtol,atol);
+            if(sse2_kernel::available && isa>=simd_isa_t::SSE2)
+                return sse2_kernel::complex(a,b,n,rtol,atol);
+            return scalar_kernel::complex(a,b,n,rtol,atol);
+        }
+    };
+
+    //=========================================================================
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief find the first element which is not close
+    //!
+    //! Integer values are compared as float64 values.
+    //!
+    //! \tparam T element type
+    //! \param a first buffer
+    //! \param b reference buffer
+    //! \param n number of elements
+    //! \param rtol relative tolerance
+    //! \param atol absolute tolerance
+    //! \return index of the first element which is not close or n
+    //!
+    template<typename T>
+    size_t find_not_close(const T *a,const T *b,size_t n,float64 rtol,
+                          float64 atol)
+    {
+        typedef typename std::conditional<std::is_floating_point<T>::value,
+                                          T,float64>::type compute_type;
+
+        for(size_t i=0;i<n;++i)
+            if(!is_close(compute_type(a[i]),compute_type(b[i]),
+                         compute_type(rtol),compute_type(atol)))
+                return i;
+        return n;
+    }
+
+    //! \cond NO_API_DOC
+    template<typename T>
+    size_t find_not_close(const std::complex<T> *a,const std::complex<T> *b,
+                          size_t n,float64 rtol,float64 atol)
+    {
+        for(size_t i=0;i<n;++i)
+            if(!is_close(a[i],b[i],T(rtol),T(atol))) return i;
+        return n;
+    }
+
+    inline size_t find_not_close(const float32 *a,const float32 *b,size_t n,
+                                 float64 rtol,float64 atol)
+    {
+        return simd_close_dispatch<float32>::real(a,b,n,float32(rtol),
+                                                  float32(atol));
+    }
+
+    inline size_t find_not_close(const float64 *a,const float64 *b,size_t n,
+                                 float64 rtol,float64 atol)
+    {
+        return simd_close_dispatch<float64>::real(a,b,n,rtol,atol);
+    }
+
+    inline size_t find_not_close(const complex32 *a,const complex32 *b,
+                                 size_t n,float64 rtol,float64 atol)
+    {
+        return simd_close_dispatch<float32>::complex(a,b,n,float32(rtol),
+                                                     float32(atol));
+    }
+
+    inline size_t find_not_close(const complex64 *a,const complex64 *b,
+                                 size_t n,float64 rtol,float64 atol)
+    {
+        return simd_close_dispatch<float64>::complex(a,b,n,rtol,atol);
+    }
+    //! \endcond
+
+    //-------------------------------------------------------------------------
+    //! \cond NO_API_DOC
+    template<typename T>
+    size_t find_unequal(const T *a,const T *b,size_t n,
+                        std::integral_constant<int,0>)
+    {
+        if(!n || !std::memcmp(a,b,n*sizeof(T))) return n;
+
+        size_t i = 0;
+        while(a[i]==b[i]) ++i;
+        return i;
+    }
+
+    template<typename T>
+    size_t find_unequal(const T *a,const T *b,size_t n,
+                        std::integral_constant<int,1>)
+    {
+        return find_not_close(a,b,n,0.,0.);
+    }
+
+    template<typename T>
+    size_t find_unequal(const T *a,const T *b,size_t n,
+                        std::integral_constant<int,2>)
+    {
+        for(size_t i=0;i<n;++i) if(!(a[i]==b[i])) return i;
+        return n;
+    }
+    //! \endcond
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief find the first unequal element
+    //!
+    //! Integer and bool buffers are compared with memcmp, floating point
+    //! and complex buffers with the comparison kernels and zero tolerance
+    //! (so that -0.0 equals 0.0 and NaN equals nothing). All other types
+    //! are compared with operator==.
+    //!
+    //! \tparam T element type
+    //! \param a first buffer
+    //! \param b second buffer
+    //! \param n number of elements
+    //! \return index of the first unequal element or n
+    //!
+    template<typename T>
+    size_t find_unequal(const T *a,const T *b,size_t n)
+    {
+        return find_unequal(a,b,n,
+                 std::integral_constant<int,
+                     std::is_integral<T>::value ? 0 :
+                     std::is_floating_point<T>::value ||
+                     is_complex_type<T>::value ? 1 : 2>());
+    }
+
+//end of namespace
+}
+}
@@ -0,0 +1,469 @@
+//
+// (c) Copyright 2026 DESY, Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+// This file is part of libpnicore.
+//
+// libpnicore is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpnicore is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpnicore.  If not, see <http://www.gnu.org/licenses/>.
+//
+// ============================================================================
+//
+// Created on: Oct 16, 2026
+//     Author: Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+#pragma once
+
+#include <algorithm>
+#include <cstring>
+#include <complex>
+#include <limits>
+#include <type_traits>
+
+#include <pni/core/error/exceptions.hpp>
+#include <pni/core/types/types.hpp>
+#include <pni/core/types/type_info.hpp>
+#include <pni/core/types/traits.hpp>
+#include <pni/core/types/convertible.hpp>
+#include <pni/core/types/unchecked_convertible.hpp>
+#include <pni/core/algorithms/math/simd_kernels.hpp>
+
+namespace pni{
+namespace core{
+
+    //!
+    //! \ingroup type_classes
+    //! \brief range checking policy for bulk conversions
+    //!
+    //! Conversions which are unchecked convertible are never range checked.
+    //! For all other conversions CHECKED verifies that every value fits in
+    //! the target type. With UNCHECKED the caller guarantees this and the
+    //! values are just cast.
+    //!
+    enum class conversion_policy { CHECKED, UNCHECKED };
+
+    //! number of elements range checked and converted at once
+    const size_t conversion_block = 2048;
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup type_classes_internal
+    //! \brief range of a target type in the source type
+    //!
+    //! Provides the smallest and largest value of type SB which can be
+    //! converted to TB. This is the floating point version where the range
+    //! of TB is smaller than the one of SB.
+    //!
+    //! \tparam TB target base type
+    //! \tparam SB source base type
+    //!
+    template<
+             typename TB,
+             typename SB,
+             bool     integer = std::numeric_limits<SB>::is_integer
+            >
+    struct conversion_range
+    {
+        //! smallest value
+        static SB min() { return SB(type_info<TB>::min()); }
+
+        //! largest value
+        static SB max() { return SB(type_info<TB>::max()); }
+    };
+
+    //! \cond NO_API_DOC
+    template<
+             typename TB,
+             typename SB
+            >
+    struct conversion_range<TB,SB,true>
+    {
+        typedef std::numeric_limits<TB> target_limits;
+        typedef std::numeric_limits<SB> source_limits;
+
+        static SB min()
+        {
+            return target_limits::is_signed && source_limits::is_signed ?
+                   SB(target_limits::min()) : SB(0);
+        }
+
+        static SB max()
+        {
+            return uintmax_t(target_limits::max()) <
+                   uintmax_t(source_limits::max()) ?
+                   SB(target_limits::max()) : source_limits::max();
+        }
+    };
+    //! \endcond NO_API_DOC
+
+    //=========================================================================
+    //!
+    //! \ingroup type_classes_internal
+    //! \brief vector kernel computing the range of a buffer
+    //!
+    //! The default template is used for all combinations of instruction
+    //! set and type without a vector kernel. The static member function
+    //! minmax(p,n,min,max) lowers min and raises max to the smallest and
+    //! largest of the n values starting at p. NaN values are ignored,
+    //! like by the range checks of boost::numeric_cast.
+    //!
+    //! \tparam ISA instruction set level
+    //! \tparam T element type
+    //!
+    template<
+             simd_isa_t ISA,
+             typename   T
+            >
+    struct simd_minmax_kernel
+    {
+        //! no kernel available
+        static const bool available = false;
+
+        //! update min and max
+        static void minmax(const T *p,size_t n,T &min,T &max)
+        {
+            for(size_t i=0;i<n;++i)
+            {
+                if(p[i]<min) min = p[i];
+                if(p[i]>max) max = p[i];
+            }
+        }
+    };
+
+#ifdef PNI_CORE_X86_SIMD
+
+//min and max return their second argument if one of the arguments is NaN
+//so the accumulators never pick up NaN values
+#define PNI_MINMAX_KERNEL(TARGET,T,REG,LOAD,SET1,MIN,MAX)\
+    static const bool available = true;\
+    __attribute__((target(TARGET)))\
+    static void minmax(const T *p,size_t n,T &min,T &max)\
+    {\
+        const size_t width = sizeof(REG)/sizeof(T);\
+        REG vmin = SET1(min);\
+        REG vmax = SET1(max);\
+        size_t i = 0;\
+        for(;i+width<=n;i+=width)\
+        {\
+            REG v = LOAD(p+i);\
+            vmin = MIN(v,vmin);\
+            vmax = MAX(v,vmax);\
+        }\
+        T lanes[2*width];\
+        std::memcpy(lanes,&vmin,sizeof(REG));\
+        std::memcpy(lanes+width,&vmax,sizeof(REG));\
+        simd_minmax_kernel<simd_isa_t::NONE,T>::minmax(lanes,2*width,\
+                                                      min,max);\
+        simd_minmax_kernel<simd_isa_t::NONE,T>::minmax(p+i,n-i,min,max);\
+    }
+
+#define PNI_SSE_LOAD_SI(p) \
+    _mm_loadu_si128(reinterpret_cast<const __m128i*>(p))
+#define PNI_AVX_LOAD_SI(p) \
+    _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p))
+
+    //! \cond NO_API_DOC
+    template<> struct simd_minmax_kernel<simd_isa_t::SSE2,uint8>
+    {
+        PNI_MINMAX_KERNEL("sse2",uint8,__m128i,PNI_SSE_LOAD_SI,_mm_set1_epi8,
+                          _mm_min_epu8,_mm_max_epu8)
+    };
+
+    template<> struct simd_minmax_kernel<simd_isa_t::SSE2,int16>
+    {
+        PNI_MINMAX_KERNEL("sse2",int16,__m128i,PNI_SSE_LOAD_SI,
+                          _mm_set1_epi16,_mm_min_epi16,_mm_max_epi16)
+    };
+
+    template<> struct simd_minmax_kernel<simd_isa_t::SSE2,float32>
+    {
+        PNI_MINMAX_KERNEL("sse2",float32,__m128,_mm_loadu_ps,_mm_set1_ps,
+                          _mm_min_ps,_mm_max_ps)
+    };
+
+    template<> struct simd_minmax_kernel<simd_isa_t::SSE2,float64>
+    {
+        PNI_MINMAX_KERNEL("sse2",float64,__m128d,_mm_loadu_pd,_mm_set1_pd,
+                          _mm_min_pd,_mm_max_pd)
+    };
+
+    template<> struct simd_minmax_kernel<simd_isa_t::AVX2,int8>
+    {
+        PNI_MINMAX_KERNEL("avx2",int8,__m256i,PNI_AVX_LOAD_SI,
+                          _mm256_set1_epi8,_mm256_min_epi8,_mm256_max_epi8)
+    };
+
+    template<> struct simd_minmax_kernel<simd_isa_t::AVX2,uint8>
+    {
+        PNI_MINMAX_KERNEL("avx2",uint8,__m256i,PNI_AVX_LOAD_SI,
+                          _mm256_set1_epi8,_mm256_min_epu8,_mm256_max_epu8)
+    };
+
+    template<> struct simd_minmax_kernel<simd_isa_t::AVX2,int16>
+    {
+        PNI_MINMAX_KERNEL("avx2",int16,__m256i,PNI_AVX_LOAD_SI,
+                          _mm256_set1_epi16,_mm256_min_epi16,
+                          _mm256_max_epi16)
+    };
+
+    template<> struct simd_minmax_kernel<simd_isa_t::AVX2,uint16>
+    {
+        PNI_MINMAX_KERNEL("avx2",uint16,__m256i,PNI_AVX_LOAD_SI,
+                          _mm256_set1_epi16,_mm256_min_epu16,
+                          _mm256_max_epu16)
+    };
+
+    template<> struct simd_minmax_kernel<simd_isa_t::AVX2,int32>
+    {
+        PNI_MINMAX_KERNEL("avx2",int32,__m256i,PNI_AVX_LOAD_SI,
+                          _mm256_set1_epi32,_mm256_min_epi32,
+                          _mm256_max_epi32)
+    };
+
+    template<> struct simd_minmax_kernel<simd_isa_t::AVX2,uint32>
+    {
+        PNI_MINMAX_KERNEL("avx2",uint32,__m256i,PNI_AVX_LOAD_SI,
+                          _mm256_set1_epi32,_mm256_min_epu32,
+                          _mm256_max_epu32)
+    };
+
+    template<> struct simd_minmax_kernel<simd_isa_t::AVX2,float32>
+    {
+        PNI_MINMAX_KERNEL("avx2",float32,__m256,_mm256_loadu_ps,
+                          _mm256_set1_ps,_mm256_min_ps,_mm256_max_ps)
+    };
+
+    template<> struct simd_minmax_kernel<simd_isa_t::AVX2,float64>
+    {
+        PNI_MINMAX_KERNEL("avx2",float64,__m256d,_mm256_loadu_pd,
+                          _mm256_set1_pd,_mm256_min_pd,_mm256_max_pd)
+    };
+    //! \endcond
+
+#undef PNI_AVX_LOAD_SI
+#undef PNI_SSE_LOAD_SI
+#undef PNI_MINMAX_KERNEL
+
+#endif
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup type_classes_internal
+    //! \brief run the best range kernel available
+    //!
+    //! \tparam T element type
+    //! \param p pointer to the first element
+    //! \param n number of elements
+    //! \param min smallest value - lowered to the minimum of the buffer
+    //! \param max largest value - raised to the maximum of the buffer
+    //!
+    template<typename T>
+    void simd_minmax(const T *p,size_t n,T &min,T &max)
+    {
+        typedef simd_minmax_kernel<simd_isa_t::AVX2,T> avx2_kernel;
+        typedef simd_minmax_kernel<simd_isa_t::SSE2,T> sse2_kernel;
+        typedef simd_minmax_kernel<simd_isa_t::NONE,T> scalar_kernel;
+
+        simd_isa_t isa = simd_isa();
+        if(avx2_kernel::available && isa>=simd_isa_t::AVX2)
+            avx2_kernel::minmax(p,n,min,max);
+        else if(sse2_kernel::available && isa>=simd_isa_t::SSE2)
+            sse2_kernel::minmax(p,n,min,max);
+        else
+            scalar_kernel::minmax(p,n,min,max);
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup type_classes_internal
+    //! \brief cast a buffer to another type
+    //!
+    //! A plain loop which the compiler can vectorize.
+    //!
+    //! \tparam TT target type
+    //! \tparam ST source type
+    //! \param src pointer to the source data
+    //! \param dst pointer to the target buffer
+    //! \param n number of elements
+    //!
+    template<
+             typename TT,
+             typename ST
+            >
+    void cast_n(const ST *src,TT *dst,size_t n)
+    {
+#ifdef _MSC_VER
+#pragma warning(disable: 4244)
+#endif
+        for(size_t i=0;i<n;++i) dst[i] = TT(src[i]);
+#ifdef _MSC_VER
+#pragma warning(default: 4244)
+#endif
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup type_classes_internal
+    //! \brief bulk conversion kernel
+    //!
+    //! Kernel for unchecked convertible types - the data is just cast.
+    //!
+    //! \tparam TT target type
+    //! \tparam ST source type
+    //! \tparam checked true if the conversion requires a range check
+    //!
+    template<
+             typename TT,
+             typename ST,
+             bool     checked = !unchecked_convertible<ST,TT>::value
+            >
+    struct conversion_kernel
+    {
+        //! convert n elements
+        static void convert(const ST *src,TT *dst,size_t n,conversion_policy)
+        {
+            cast_n(src,dst,n);
+        }
+    };
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup type_classes_internal
+    //! \brief range checking bulk conversion kernel
+    //!
+    //! The data is processed in blocks of conversion_block elements. The
+    //! range of each block is computed with simd_minmax() and compared to
+    //! the range of the target type before the block is cast. For complex
+    //! data the real and imaginary parts are checked.
+    //!
+    //! \tparam TT target type
+    //! \tparam ST source type
+    //!
+    template<
+             typename TT,
+             typename ST
+            >
+    struct conversion_kernel<TT,ST,true>
+    {
+        //! type of the real and imaginary part of the source
+        typedef typename type_info<ST>::base_type source_base;
+        //! type of the real and imaginary part of the target
+        typedef typename type_info<TT>::base_type target_base;
+        //! range of the target type
+        typedef conversion_range<target_base,source_base> range_type;
+
+        //! convert n elements
+        static void convert(const ST *src,TT *dst,size_t n,
+                            conversion_policy policy)
+        {
+            if(policy==conversion_policy::UNCHECKED)
+            {
+                cast_n(src,dst,n);
+                return;
+            }
+
+            const size_t parts = sizeof(ST)/sizeof(source_base);
+            const source_base lower = range_type::min();
+            const source_base upper = range_type::max();
+
+            for(size_t offset=0;offset<n;offset+=conversion_block)
+            {
+                size_t count = std::min(conversion_block,n-offset);
+
+                //start with the bounds so that only data can exceed them
+                source_base min = upper;
+                source_base max = lower;
+                simd_minmax(reinterpret_cast<const source_base*>(src+offset),
+                            count*parts,min,max);
+                if(min<lower || max>upper)
+                    throw range_error(EXCEPTION_RECORD,
+                            "Source value exceeded range of target type!");
+
+                cast_n(src+offset,dst+offset,count);
+            }
+        }
+    };
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup type_classes
+    //! \brief check if a buffer can be converted with convert_n
+    //!
+    //! True if ST and TT are numeric types and ST can be converted to TT.
+    //!
+    //! \tparam ST source type
+    //! \tparam TT target type
+    //!
+    template<
+             typename ST,
+             typename TT,
+             bool     numeric = is_numeric_type<ST>::value &&
+                                is_numeric_type<TT>::value
+            >
+    struct bulk_convertible
+    {
+        //! result
+        static const bool value = convertible<ST,TT>::value;
+    };
+
+    //! \cond NO_API_DOC
+    template<
+             typename ST,
+             typename TT
+            >
+    struct bulk_convertible<ST,TT,false>
+    {
+        static const bool value = false;
+    };
+    //! \endcond NO_API_DOC
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup type_classes
+    //! \brief convert a buffer to another type
+    //!
+    //! Converts n values of type ST to TT. The conversion follows the
+    //! rules of convert() but checks and casts the data in blocks rather
+    //! than value by value. If a range_error is thrown dst may have been
+    //! partially written.
+    /*!
+    \code
+    std::vector<uint16> frame = ...;
+    std::vector<float32> data(frame.size());
+    convert_n(frame.data(),data.data(),frame.size());
+    \endcode
+    !*/
+    //!
+    //! \throws range_error if a value does not fit in the target type
+    //! \tparam TT target type
+    //! \tparam ST source type
+    //! \param src pointer to the source data
+    //! \param dst pointer to the target buffer
+    //! \param n number of elements
+    //! \param policy range checking policy
+    //!
+    template<
+             typename TT,
+             typename ST
+            >
+    void convert_n(const ST *src,TT *dst,size_t n,
+                   conversion_policy policy = conversion_policy::CHECKED)
+    {
+        static_assert(convertible<ST,TT>::value,
+                      "Types are in no way convertible!");
+
+        conversion_kernel<TT,ST>::convert(src,dst,n,policy);
+    }
+
+//end of namespace
+}
+}
@@ -0,0 +1,141 @@
+//
+// (c) Copyright 2026 DESY, Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+// This file is part of libpnicore.
+//
+// libpnicore is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpnicore is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpnicore.  If not, see <http://www.gnu.org/licenses/>.
+//
+// ============================================================================
+//
+// Created on: Oct 16, 2026
+//     Author: Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+
+#include <pni/core/types/id_type_map.hpp>
+#include <pni/core/algorithms/conversions/convert_n.hpp>
+
+namespace pni{
+namespace core{
+
+namespace{
+
+    //function type of a table entry
+    typedef void (*conversion_function)(const void *,void *,size_t,
+                                        conversion_policy);
+
+    //-------------------------------------------------------------------------
+    // table entry calling the typed kernel
+    template<
+             typename ST,
+             typename TT,
+             bool     valid = bulk_convertible<ST,TT>::value
+            >
+    struct conversion_entry
+    {
+        static void convert(const void *src,void *dst,size_t n,
+                            conversion_policy policy)
+        {
+            convert_n(static_cast<const ST*>(src),static_cast<TT*>(dst),n,
+                      policy);
+        }
+    };
+
+    template<
+             typename ST,
+             typename TT
+            >
+    struct conversion_entry<ST,TT,false>
+    {
+        static void convert(const void *,void *,size_t,conversion_policy)
+        {
+            throw type_error(EXCEPTION_RECORD,
+                    "Conversion not possible!");
+        }
+    };
+
+    //-------------------------------------------------------------------------
+    // one row of the table - the kernels for a single source type
+    template<
+             size_t SID,
+             typename IDS = typename make_type_id_list<
+                                size_t(type_id_t::BOOL)+1>::type
+            >
+    struct conversion_row;
+
+    template<
+             size_t SID,
+             size_t ...IDS
+            >
+    struct conversion_row<SID,type_id_list<IDS...>>
+    {
+        typedef typename id_type_map<type_id_t(SID)>::type source_type;
+
+        static const conversion_function functions[sizeof...(IDS)];
+    };
+
+    template<
+             size_t SID,
+             size_t ...IDS
+            >
+    const conversion_function
+    conversion_row<SID,type_id_list<IDS...>>::functions[] =
+    {
+        &conversion_entry<
+                    source_type,
+                    typename id_type_map<type_id_t(IDS)>::type>::convert...
+    };
+
+    //-------------------------------------------------------------------------
+    // the table - one row per source type ID
+    template<
+             typename IDS = make_type_id_list<
+                                size_t(type_id_t::BOOL)+1>::type
+            >
+    struct conversion_table;
+
+    template<size_t ...IDS> struct conversion_table<type_id_list<IDS...>>
+    {
+        static const size_t size = sizeof...(IDS);
+
+        static const conversion_function *const rows[sizeof...(IDS)];
+    };
+
+    template<size_t ...IDS>
+    const conversion_function *const
+    conversion_table<type_id_list<IDS...>>::rows[] =
+    {
+        conversion_row<IDS>::functions...
+    };
+
+//end of anonymous namespace
+}
+
+    //-------------------------------------------------------------------------
+    void convert_n(type_id_t source_tid,type_id_t target_tid,
+                   const void *src,void *dst,size_t n,
+                   conversion_policy policy)
+    {
+        typedef conversion_table<> table_type;
+
+        size_t source_index = size_t(source_tid);
+        size_t target_index = size_t(target_tid);
+        if(source_index>=table_type::size || target_index>=table_type::size)
+            throw type_error(EXCEPTION_RECORD,"Unknown type ID!");
+
+        table_type::rows[source_index][target_index](src,dst,n,policy);
+    }
+
+//end of namespace
+}
+}
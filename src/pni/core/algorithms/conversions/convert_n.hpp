@@ -0,0 +1,67 @@
+//
+// (c) Copyright 2026 DESY, Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+// This file is part of libpnicore.
+//
+// libpnicore is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpnicore is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpnicore.  If not, see <http://www.gnu.org/licenses/>.
+//
+// ============================================================================
+//
+// Created on: Oct 16, 2026
+//     Author: Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+#pragma once
+
+#include <pni/core/types/types.hpp>
+#include <pni/core/algorithms/conversions/conversion_kernels.hpp>
+#include <pni/core/windows.hpp>
+
+namespace pni{
+namespace core{
+
+    //!
+    //! \ingroup type_classes
+    //! \brief convert a buffer to another type
+    //!
+    //! Type erased version of convert_n() for buffers whose types are only
+    //! known at runtime. The kernel for the two type IDs is looked up in a
+    //! table with one entry for every pair of type IDs, which is created at
+    //! compile time. Thus the type dispatch is done once per buffer and not
+    //! once per element.
+    /*!
+    \code
+    std::vector<uint16> frame = ...;
+    std::vector<float32> data(frame.size());
+    convert_n(type_id_t::UINT16,type_id_t::FLOAT32,frame.data(),data.data(),
+              frame.size());
+    \endcode
+    !*/
+    //!
+    //! \throws type_error if the types are not convertible or not numeric
+    //! \throws range_error if a value does not fit in the target type
+    //! \param source_tid ID of the source type
+    //! \param target_tid ID of the target type
+    //! \param src pointer to the source data
+    //! \param dst pointer to the target buffer
+    //! \param n number of elements
+    //! \param policy range checking policy
+    //!
+    PNICORE_EXPORT
+    void convert_n(type_id_t source_tid,type_id_t target_tid,
+                   const void *src,void *dst,size_t n,
+                   conversion_policy policy = conversion_policy::CHECKED);
+
+//end of namespace
+}
+}
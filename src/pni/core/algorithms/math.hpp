@@ -24,8 +24,14 @@
 #pragma once
 
 #include <pni/core/algorithms/math/add_op.hpp>
+#include <pni/core/algorithms/math/broadcast_map.hpp>
 #include <pni/core/algorithms/math/div_op.hpp>
+#include <pni/core/algorithms/math/expression_evaluator.hpp>
 #include <pni/core/algorithms/math/inplace_arithmetics.hpp>
 #include <pni/core/algorithms/math/mult_op.hpp>
 #include <pni/core/algorithms/math/op_traits.hpp>
+#include <pni/core/algorithms/math/parallel_inplace_arithmetics.hpp>
+#include <pni/core/algorithms/math/simd_inplace_arithmetics.hpp>
+#include <pni/core/algorithms/math/simd_kernels.hpp>
 #include <pni/core/algorithms/math/sub_op.hpp>
+#include <pni/core/algorithms/math/unary_op.hpp>
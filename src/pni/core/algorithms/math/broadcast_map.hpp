@@ -0,0 +1,386 @@
+//
+// (c) Copyright 2026 DESY, Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+// This file is part of libpnicore.
+//
+// libpnicore is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpnicore is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpnicore.  If not, see <http://www.gnu.org/licenses/>.
+//
+// ============================================================================
+//
+// Created on: Oct 16, 2026
+//     Author: Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+#pragma once
+
+#include <vector>
+#include <sstream>
+#include <algorithm>
+#include <type_traits>
+
+#include <pni/core/types/types.hpp>
+#include <pni/core/error/exceptions.hpp>
+#include <pni/core/arrays/index_map/index_maps.hpp>
+
+namespace pni{
+namespace core{
+
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief compute the broadcast shape of two operands
+    //!
+    //! The shapes are aligned at their last dimension. Along every
+    //! dimension the number of elements must either be equal or one of
+    //! them must be 1. Missing leading dimensions of the operand with the
+    //! lower rank are treated as 1. A rank 0 operand (a scalar) is
+    //! compatible with every shape.
+    //!
+    //! \throws shape_mismatch_error if the shapes are not compatible
+    //! \param a shape of the left operand
+    //! \param b shape of the right operand
+    //! \return shape of the result
+    //!
+    inline shape_t broadcast_shape(const shape_t &a,const shape_t &b)
+    {
+        shape_t result(std::max(a.size(),b.size()));
+
+        auto ia = a.rbegin();
+        auto ib = b.rbegin();
+        for(auto ir = result.rbegin();ir!=result.rend();++ir)
+        {
+            size_t na = ia!=a.rend() ? *ia++ : 1;
+            size_t nb = ib!=b.rend() ? *ib++ : 1;
+
+            if(na!=nb && na!=1 && nb!=1)
+            {
+                std::stringstream ss;
+                ss<<"Shapes of operands cannot be broadcast - dimensions "
+                  <<na<<" and "<<nb<<" do not match!";
+                throw shape_mismatch_error(EXCEPTION_RECORD,ss.str());
+            }
+            *ir = na==1 ? nb : na;
+        }
+
+        return result;
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief broadcast index map
+    //!
+    //! Maps the linear index of an element of a broadcast result onto the
+    //! linear index of an operand with a smaller shape. Along broadcast
+    //! dimensions the stride of the operand is 0 so that the operand is
+    //! never copied.
+    //!
+    //! If the operand has the shape of the result (or is a scalar) the
+    //! map is the identity. If only leading dimensions are broadcast (for
+    //! instance a (H,W) dark image subtracted from a (N,H,W) stack) the
+    //! operand simply repeats with a period of its size.
+    //!
+    //! Linear indices are storage indices. The shapes passed to the
+    //! constructor must thus be given in storage order (slowest dimension
+    //! first). For a C-ordered operand of lower rank the missing leading
+    //! dimensions may be omitted, other operands must be padded to the
+    //! rank of the result first - binary_broadcast takes care of this.
+    //!
+    class broadcast_map
+    {
+        private:
+            //! true if the map is the identity
+            bool _identity;
+            //! repetition period of the operand (0 if not periodic)
+            size_t _period;
+            //! shape of the result
+            shape_t _shape;
+            //! operand strides along the dimensions of the result
+            std::vector<size_t> _strides;
+        public:
+            //=================constructors====================================
+            //!
+            //! \brief default constructor
+            //!
+            //! Creates an identity map.
+            //!
+            broadcast_map():
+                _identity(true),
+                _period(0),
+                _shape(),
+                _strides()
+            {}
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief constructor
+            //!
+            //! \param shape shape of the operand in storage order
+            //! \param result shape of the result in storage order
+            //!
+            broadcast_map(const shape_t &shape,const shape_t &result):
+                _identity(shape.empty() || shape==result),
+                _period(0),
+                _shape(),
+                _strides()
+            {
+                if(_identity) return;
+
+                size_t offset = result.size()-shape.size();
+                size_t stride = 1;
+
+                _shape = result;
+                _strides = std::vector<size_t>(result.size(),0);
+                for(size_t i=shape.size();i!=0;--i)
+                {
+                    if(shape[i-1]!=1) _strides[offset+i-1] = stride;
+                    stride *= shape[i-1];
+                }
+
+                //check if only leading dimensions are broadcast
+                size_t i = result.size();
+                while(i!=0 && (_strides[i-1]!=0 || result[i-1]==1)) --i;
+                bool periodic = true;
+                for(size_t j=0;j<i;++j) periodic = periodic && _strides[j]==0;
+                if(periodic) _period = stride;
+            }
+
+            //=================public member functions=========================
+            //! true if the map is the identity
+            bool is_identity() const { return _identity; }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief get repetition period
+            //!
+            //! \return number of elements of the operand if only leading
+            //! dimensions are broadcast, 0 otherwise
+            //!
+            size_t period() const { return _period; }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief map an index
+            //!
+            //! \param i linear index into the result
+            //! \return linear index into the operand
+            //!
+            size_t operator()(size_t i) const
+            {
+                if(_identity) return i;
+                if(_period) return i%_period;
+
+                size_t index = 0;
+                for(size_t d=_shape.size();d!=0;--d)
+                {
+                    index += (i%_shape[d-1])*_strides[d-1];
+                    i /= _shape[d-1];
+                }
+                return index;
+            }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief gather operand elements
+            //!
+            //! Copies the operand elements for n consecutive elements of
+            //! the result starting at offset to dest. The index is advanced
+            //! odometer style so that no divisions are required per element.
+            //!
+            //! \tparam OPT operand type
+            //! \tparam T element type
+            //! \param op reference to the operand
+            //! \param offset linear index of the first result element
+            //! \param n number of elements
+            //! \param dest destination buffer
+            //!
+            template<
+                     typename OPT,
+                     typename T
+                    >
+            void gather(const OPT &op,size_t offset,size_t n,T *dest) const
+            {
+                if(_identity || _period)
+                {
+                    for(size_t i=0;i<n;++i) dest[i] = op[(*this)(offset+i)];
+                    return;
+                }
+
+                size_t rank = _shape.size();
+                std::vector<size_t> index(rank);
+                size_t position = 0;
+                for(size_t d=rank,o=offset;d!=0;--d)
+                {
+                    index[d-1] = o%_shape[d-1];
+                    o /= _shape[d-1];
+                    position += index[d-1]*_strides[d-1];
+                }
+
+                for(size_t i=0;i<n;++i)
+                {
+                    dest[i] = op[position];
+
+                    for(size_t d=rank;d!=0;--d)
+                    {
+                        position += _strides[d-1];
+                        if(++index[d-1]<_shape[d-1]) break;
+                        position -= index[d-1]*_strides[d-1];
+                        index[d-1] = 0;
+                    }
+                }
+            }
+    };
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief broadcast information of a binary expression
+    //!
+    //! Computes the shape of the result of a binary expression and the
+    //! broadcast maps for both of its operands. Shapes are broadcast by
+    //! index (the last indices are aligned) while the maps work on
+    //! linear indices in the storage order of the operands.
+    //!
+    class binary_broadcast
+    {
+        private:
+            //! shape of the result
+            shape_t _shape;
+            //! number of elements of the result
+            size_t _size;
+            //! map for the left operand
+            broadcast_map _lhs;
+            //! map for the right operand
+            broadcast_map _rhs;
+
+            //-----------------------------------------------------------------
+            //! number of elements for a shape
+            static size_t size(const shape_t &shape,size_t default_size)
+            {
+                if(shape.empty()) return default_size;
+
+                size_t s = 1;
+                for(auto n: shape) s*=n;
+                return s;
+            }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief operand shape in storage order
+            //!
+            //! Pads the shape of an operand with leading dimensions of 1
+            //! to the rank of the result and reorders it to storage order.
+            //! The shape of a scalar is left empty.
+            //!
+            //! \tparam IMPT index map implementation of the result
+            //! \param shape shape of the operand
+            //! \param rank rank of the result
+            //! \return shape in storage order
+            //!
+            template<typename IMPT>
+            static shape_t linear_shape(const shape_t &shape,size_t rank)
+            {
+                if(shape.empty()) return shape;
+
+                shape_t padded(rank-shape.size(),1);
+                padded.insert(padded.end(),shape.begin(),shape.end());
+                return IMPT::linear_order(padded);
+            }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief storage order of an expression
+            //!
+            //! Mixed orders are rejected by the operators so the order of
+            //! the first array operand is used.
+            //!
+            template<
+                     typename OP1T,
+                     typename OP2T,
+                     typename ORDER = typename storage_order<OP1T>::type
+                    >
+            struct expression_order
+            {
+                //! index map implementation of the expression
+                typedef ORDER type;
+            };
+
+            //-----------------------------------------------------------------
+            //! the left operand is a scalar
+            template<
+                     typename OP1T,
+                     typename OP2T
+                    >
+            struct expression_order<OP1T,OP2T,void>
+            {
+                //! index map implementation of the expression
+                typedef typename std::conditional<
+                    std::is_void<typename storage_order<OP2T>::type>::value,
+                    c_index_map_imp,
+                    typename storage_order<OP2T>::type>::type type;
+            };
+
+            //-----------------------------------------------------------------
+            //! create an operand map
+            template<typename IMPT>
+            static broadcast_map make_map(const shape_t &shape,
+                                          const shape_t &result)
+            {
+                return broadcast_map(linear_shape<IMPT>(shape,result.size()),
+                                     IMPT::linear_order(result));
+            }
+        public:
+            //-----------------------------------------------------------------
+            //!
+            //! \brief constructor
+            //!
+            //! \throws shape_mismatch_error if the operand shapes are not
+            //! compatible
+            //! \tparam OP1T left operand type
+            //! \tparam OP2T right operand type
+            //! \param a left operand
+            //! \param b right operand
+            //!
+            template<
+                     typename OP1T,
+                     typename OP2T
+                    >
+            binary_broadcast(const OP1T &a,const OP2T &b):
+                _shape(broadcast_shape(a.template shape<shape_t>(),
+                                       b.template shape<shape_t>())),
+                _size(size(_shape,std::max(a.size(),b.size()))),
+                _lhs(make_map<typename expression_order<OP1T,OP2T>::type>(
+                     a.template shape<shape_t>(),_shape)),
+                _rhs(make_map<typename expression_order<OP1T,OP2T>::type>(
+                     b.template shape<shape_t>(),_shape))
+            {}
+
+            //-----------------------------------------------------------------
+            //! get shape of the result
+            const shape_t &shape() const { return _shape; }
+
+            //-----------------------------------------------------------------
+            //! get number of elements of the result
+            size_t size() const { return _size; }
+
+            //-----------------------------------------------------------------
+            //! get map for the left operand
+            const broadcast_map &lhs() const { return _lhs; }
+
+            //-----------------------------------------------------------------
+            //! get map for the right operand
+            const broadcast_map &rhs() const { return _rhs; }
+    };
+
+//end of namespace
+}
+}
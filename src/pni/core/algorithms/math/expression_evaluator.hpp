@@ -0,0 +1,598 @@
+//
+// (c) Copyright 2026 DESY, Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+// This file is part of libpnicore.
+//
+// libpnicore is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpnicore is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpnicore.  If not, see <http://www.gnu.org/licenses/>.
+//
+// ============================================================================
+//
+// Created on: Oct 16, 2026
+//     Author: Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+#pragma once
+
+#include <vector>
+#include <cstring>
+#include <algorithm>
+#include <type_traits>
+
+#include <pni/core/types.hpp>
+#include <pni/core/types/container_trait.hpp>
+#include <pni/core/utilities/thread_pool.hpp>
+#include <pni/core/arrays/scalar.hpp>
+#include <pni/core/algorithms/math/add_op.hpp>
+#include <pni/core/algorithms/math/broadcast_map.hpp>
+#include <pni/core/algorithms/math/sub_op.hpp>
+#include <pni/core/algorithms/math/mult_op.hpp>
+#include <pni/core/algorithms/math/div_op.hpp>
+#include <pni/core/algorithms/math/unary_op.hpp>
+#include <pni/core/algorithms/math/simd_kernels.hpp>
+#include <pni/core/algorithms/math/parallel_inplace_arithmetics.hpp>
+
+namespace pni{
+namespace core{
+
+    template<
+             typename STORAGE,
+             typename IMAP,
+             typename IPA
+            > 
+    class mdarray;
+
+    //! number of elements evaluated at once by the expression evaluator
+    const size_t expression_block = 1024;
+
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief block evaluation of an expression
+    //!
+    //! The expression evaluator computes blocks of consecutive elements of 
+    //! an expression. load() returns a pointer to n elements starting at 
+    //! offset. Contiguous arrays return a pointer to their data, all other
+    //! nodes write their result to the dest buffer. Temporary results are 
+    //! stored in the scratch buffers of which every node needs buffers 
+    //! blocks of n elements.
+    //!
+    //! This default implementation is used for all leafs which are neither 
+    //! contiguous arrays nor scalars (for instance array views). It gathers 
+    //! the elements via operator[].
+    //! 
+    //! \tparam E expression type
+    //!
+    template<typename E> 
+    struct expression_evaluator
+    {
+        //! element type
+        typedef typename E::value_type value_type;
+        //! true if all nodes of the expression have the same element type
+        static const bool is_fusable = true;
+        //! number of scratch buffers required
+        static const size_t buffers = 0;
+
+        //---------------------------------------------------------------------
+        //!
+        //! \brief load a block of elements
+        //!
+        //! \param e reference to the expression
+        //! \param offset index of the first element
+        //! \param n number of elements
+        //! \param dest buffer for n elements 
+        //! \return pointer to the elements
+        //!
+        static const value_type *load(const E &e,size_t offset,size_t n,
+                                      value_type *dest,value_type *)
+        {
+            for(size_t i=0;i<n;++i) dest[i] = e[offset+i];
+            return dest;
+        }
+    };
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief block evaluation of a scalar 
+    //!
+    //! \tparam T element type of the scalar
+    //!
+    template<typename T>
+    struct expression_evaluator<scalar<T>>
+    {
+        //! element type
+        typedef T value_type;
+        //! a scalar can always be fused
+        static const bool is_fusable = true;
+        //! no scratch buffers required
+        static const size_t buffers = 0;
+
+        //! fill a block with the scalar value
+        static const T *load(const scalar<T> &e,size_t,size_t n,T *dest,T *)
+        {
+            std::fill(dest,dest+n,e[0]);
+            return dest;
+        }
+    };
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief block evaluation of an array
+    //!
+    //! Arrays with contiguous storage are used in place. For all other 
+    //! arrays (in particular those which hold an expression template as 
+    //! their storage) the evaluation is forwarded to the storage.
+    //!
+    //! \tparam STORAGE storage type of the array
+    //! \tparam IMAP index map type
+    //! \tparam IPA inplace arithmetics type
+    //!
+    template<
+             typename STORAGE,
+             typename IMAP,
+             typename IPA
+            >
+    struct expression_evaluator<mdarray<STORAGE,IMAP,IPA>>
+    {
+        //! array type
+        typedef mdarray<STORAGE,IMAP,IPA> array_type;
+        //! element type
+        typedef typename array_type::value_type value_type;
+        //! true if the storage is contiguous
+        static const bool is_contiguous = 
+            container_trait<STORAGE>::is_contiguous &&
+            !std::is_same<value_type,bool>::value;
+        //! evaluator for the storage
+        typedef expression_evaluator<STORAGE> storage_evaluator;
+
+        //! true if the storage can be fused
+        static const bool is_fusable = is_contiguous ||
+                                       storage_evaluator::is_fusable;
+        //! number of scratch buffers required
+        static const size_t buffers = is_contiguous ? 0 : 
+                                      storage_evaluator::buffers;
+       
+        //---------------------------------------------------------------------
+        //! load from contiguous storage
+        static const value_type *load(const array_type &e,size_t offset,
+                                      size_t,value_type *,value_type *,
+                                      std::true_type)
+        {
+            return e.data()+offset;
+        }
+
+        //---------------------------------------------------------------------
+        //! load from an expression template
+        static const value_type *load(const array_type &e,size_t offset,
+                                      size_t n,value_type *dest,
+                                      value_type *scratch,std::false_type)
+        {
+            return storage_evaluator::load(e.storage(),offset,n,dest,scratch);
+        }
+
+        //---------------------------------------------------------------------
+        //! load a block of elements
+        static const value_type *load(const array_type &e,size_t offset,
+                                      size_t n,value_type *dest,
+                                      value_type *scratch)
+        {
+            return load(e,offset,n,dest,scratch,
+                        std::integral_constant<bool,is_contiguous>());
+        }
+    };
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief load a block of a broadcast operand
+    //!
+    //! If the operand is not broadcast the block is loaded with the 
+    //! evaluator of the operand. An operand which only repeats along 
+    //! leading dimensions is loaded in runs which do not cross its end, 
+    //! so that contiguous operands are still used in place. All other 
+    //! operands are gathered with the broadcast map.
+    //!
+    //! \tparam EVALUATOR evaluator type of the operand
+    //! \tparam OPT operand type
+    //! \tparam T element type
+    //! \param op reference to the operand
+    //! \param map broadcast map of the operand
+    //! \param offset index of the first element of the result
+    //! \param n number of elements
+    //! \param dest buffer for n elements
+    //! \param scratch scratch buffers for the evaluator
+    //! \return pointer to the elements
+    //!
+    template<
+             typename EVALUATOR,
+             typename OPT,
+             typename T
+            >
+    const T *broadcast_load(const OPT &op,const broadcast_map &map,
+                            size_t offset,size_t n,T *dest,T *scratch)
+    {
+        if(map.is_identity()) 
+            return EVALUATOR::load(op,offset,n,dest,scratch);
+
+        size_t period = map.period();
+        if(period==0)
+        {
+            map.gather(op,offset,n,dest);
+            return dest;
+        }
+
+        size_t index = offset%period;
+        if(index+n<=period) 
+            return EVALUATOR::load(op,index,n,dest,scratch);
+
+        for(size_t i=0;i<n;)
+        {
+            size_t m = std::min(n-i,period-index);
+            const T *a = EVALUATOR::load(op,index,m,dest+i,scratch);
+            if(a!=dest+i) std::copy(a,a+m,dest+i);
+            i += m;
+            index = 0;
+        }
+        return dest;
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief block evaluation of a binary expression
+    //!
+    //! The left operand is evaluated into the destination buffer, the 
+    //! right one into a scratch buffer. Both are then combined with the 
+    //! vector kernels for the operation. 
+    //!
+    //! \tparam OP1T left operand type
+    //! \tparam OP2T right operand type
+    //! \tparam OP vector operation (simd_add, simd_sub, ...)
+    //!
+    template<
+             typename OP1T,
+             typename OP2T,
+             typename OP
+            >
+    struct binary_expression_evaluator
+    {
+        //! element type
+        typedef typename OP1T::value_type value_type;
+        //! evaluator for the left operand
+        typedef expression_evaluator<OP1T> lhs_evaluator;
+        //! evaluator for the right operand
+        typedef expression_evaluator<OP2T> rhs_evaluator;
+        //! true if the right operand is a scalar
+        static const bool is_scalar = 
+            std::is_same<OP2T,scalar<typename OP2T::value_type>>::value;
+
+        //! both operands must have the same element type
+        static const bool is_fusable = 
+            lhs_evaluator::is_fusable && rhs_evaluator::is_fusable &&
+            std::is_same<value_type,typename OP2T::value_type>::value;
+
+        //! number of scratch buffers required
+        static const size_t buffers = 
+            lhs_evaluator::buffers > rhs_evaluator::buffers+1 ? 
+            lhs_evaluator::buffers : rhs_evaluator::buffers+1;
+
+        //---------------------------------------------------------------------
+        //! apply a scalar right operand
+        static void apply(value_type *dest,const OP2T &b,
+                          const broadcast_map &,size_t,size_t n,
+                          value_type *,std::true_type)
+        {
+            simd_apply<OP>(dest,b[0],n);
+        }
+
+        //---------------------------------------------------------------------
+        //! apply an array right operand
+        static void apply(value_type *dest,const OP2T &b,
+                          const broadcast_map &map,size_t offset,
+                          size_t n,value_type *scratch,std::false_type)
+        {
+            simd_apply<OP>(dest,broadcast_load<rhs_evaluator>(b,map,offset,n,
+                                                              scratch,
+                                                              scratch+n),n);
+        }
+
+        //---------------------------------------------------------------------
+        //! evaluate a block of elements
+        template<typename E>
+        static const value_type *load(const E &e,size_t offset,size_t n,
+                                      value_type *dest,value_type *scratch)
+        {
+            const value_type *a = broadcast_load<lhs_evaluator>(e.lhs(),
+                                                               e.lhs_map(),
+                                                               offset,n,dest,
+                                                               scratch);
+            if(a!=dest) std::copy(a,a+n,dest);
+
+            apply(dest,e.rhs(),e.rhs_map(),offset,n,scratch,
+                  std::integral_constant<bool,is_scalar>());
+            return dest;
+        }
+    };
+
+    //! \cond NO_API_DOC
+    template<typename OP1T,typename OP2T>
+    struct expression_evaluator<add_op<OP1T,OP2T>>:
+        binary_expression_evaluator<OP1T,OP2T,simd_add>
+    {};
+
+    template<typename OP1T,typename OP2T>
+    struct expression_evaluator<sub_op<OP1T,OP2T>>:
+        binary_expression_evaluator<OP1T,OP2T,simd_sub>
+    {};
+
+    template<typename OP1T,typename OP2T>
+    struct expression_evaluator<mult_op<OP1T,OP2T>>:
+        binary_expression_evaluator<OP1T,OP2T,simd_mult>
+    {};
+
+    template<typename OP1T,typename OP2T>
+    struct expression_evaluator<div_op<OP1T,OP2T>>:
+        binary_expression_evaluator<OP1T,OP2T,simd_div>
+    {};
+    //! \endcond
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief block evaluation of a unary expression
+    //!
+    //! If the function preserves the element type the operand is evaluated
+    //! into the destination buffer and the function is applied in place. 
+    //! Functions changing the element type (for instance abs() on complex 
+    //! numbers) read the operand element by element.
+    //!
+    //! \tparam OPT operand type
+    //! \tparam FUNCT function type
+    //!
+    template<
+             typename OPT,
+             typename FUNCT
+            >
+    struct expression_evaluator<unary_op<OPT,FUNCT>>
+    {
+        //! expression type
+        typedef unary_op<OPT,FUNCT> expression_type;
+        //! element type
+        typedef typename expression_type::value_type value_type;
+        //! evaluator for the operand
+        typedef expression_evaluator<OPT> operand_evaluator;
+        //! true if the function can be applied in the destination buffer
+        static const bool is_inplace = 
+            std::is_same<value_type,typename OPT::value_type>::value &&
+            operand_evaluator::is_fusable;
+        //! a unary expression can always be fused 
+        static const bool is_fusable = true;
+        //! number of scratch buffers required
+        static const size_t buffers = is_inplace ? operand_evaluator::buffers
+                                                 : 0;
+
+        //---------------------------------------------------------------------
+        //! evaluate the operand block and apply the function in place
+        static const value_type *load(const expression_type &e,size_t offset,
+                                      size_t n,value_type *dest,
+                                      value_type *scratch,std::true_type)
+        {
+            const value_type *a = operand_evaluator::load(e.operand(),offset,
+                                                          n,dest,scratch);
+            const FUNCT &f = e.function();
+            for(size_t i=0;i<n;++i) dest[i] = f(a[i]);
+            return dest;
+        }
+
+        //---------------------------------------------------------------------
+        //! apply the function element by element
+        static const value_type *load(const expression_type &e,size_t offset,
+                                      size_t n,value_type *dest,
+                                      value_type *,std::false_type)
+        {
+            const OPT &a = e.operand();
+            const FUNCT &f = e.function();
+            for(size_t i=0;i<n;++i) dest[i] = f(a[offset+i]);
+            return dest;
+        }
+
+        //---------------------------------------------------------------------
+        //! evaluate a block of elements
+        static const value_type *load(const expression_type &e,size_t offset,
+                                      size_t n,value_type *dest,
+                                      value_type *scratch)
+        {
+            return load(e,offset,n,dest,scratch,
+                        std::integral_constant<bool,is_inplace>());
+        }
+    };
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief check if an expression can be evaluated in blocks
+    //!
+    //! This is the case if the destination has a contiguous storage and 
+    //! all nodes of the expression have the element type of the 
+    //! destination.
+    //!
+    //! \tparam DTYPE destination array type
+    //! \tparam ETYPE expression type
+    //!
+    template<
+             typename DTYPE,
+             typename ETYPE
+            >
+    struct is_fused_evaluation
+    {
+        //! true if the fused evaluation can be used
+        static const bool value = 
+            container_trait<typename DTYPE::storage_type>::is_contiguous &&
+            !std::is_same<typename DTYPE::value_type,bool>::value &&
+            std::is_same<typename DTYPE::value_type,
+                         typename ETYPE::value_type>::value &&
+            expression_evaluator<ETYPE>::is_fusable;
+    };
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief check if an array can be copied in bulk
+    //!
+    //! This is the case if source and destination have a contiguous 
+    //! storage. The element types may differ.
+    //!
+    //! \tparam DTYPE destination array type
+    //! \tparam STYPE source array type
+    //!
+    template<
+             typename DTYPE,
+             typename STYPE
+            >
+    struct is_bulk_copy
+    {
+        //! true if the arrays can be copied via pointers
+        static const bool value = 
+            container_trait<typename DTYPE::storage_type>::is_contiguous &&
+            container_trait<typename STYPE::storage_type>::is_contiguous &&
+            !std::is_same<typename DTYPE::value_type,bool>::value &&
+            !std::is_same<typename STYPE::value_type,bool>::value;
+    };
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief copy a block of elements
+    //!
+    //! Trivially copyable elements of equal type are copied with memcpy.
+    //!
+    template<typename T>
+    void copy_block(T *dest,const T *src,size_t n,std::true_type)
+    {
+        if(n) std::memcpy(dest,src,n*sizeof(T));
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief copy a block of elements
+    //!
+    //! Elements are converted in a loop over plain pointers which the 
+    //! compiler can vectorize.
+    //!
+    template<
+             typename T,
+             typename S
+            >
+    void copy_block(T *dest,const S *src,size_t n,std::false_type)
+    {
+        std::copy(src,src+n,dest);
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief copy elements between contiguous memory
+    //!
+    //! Copies n elements converting them to the destination type if 
+    //! necessary. If parallel is true and at least 
+    //! parallel_inplace_arithmetics::min_size elements are copied, the 
+    //! work is distributed over the library thread pool.
+    //!
+    //! \tparam T destination element type
+    //! \tparam S source element type
+    //! \param dest pointer to memory for n elements
+    //! \param src pointer to the source elements
+    //! \param n number of elements
+    //! \param parallel true for multi-threaded copying
+    //!
+    template<
+             typename T,
+             typename S
+            >
+    void copy_elements(T *dest,const S *src,size_t n,bool parallel)
+    {
+        typedef std::integral_constant<bool,
+                    std::is_same<T,S>::value &&
+                    std::is_trivially_copyable<T>::value> memcpy_type;
+
+        if(parallel && n>=parallel_inplace_arithmetics::min_size)
+        {
+            size_t chunk = parallel_inplace_arithmetics::chunk_bytes/
+                           sizeof(T);
+            parallel_for(n,chunk,[dest,src](size_t begin,size_t end)
+            {
+                copy_block(dest+begin,src+begin,end-begin,memcpy_type());
+            });
+        }
+        else
+            copy_block(dest,src,n,memcpy_type());
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief evaluate an expression into memory
+    //!
+    //! Evaluates the expression in a single pass over blocks of 
+    //! expression_block elements. Every block of every operand is loaded 
+    //! once and combined with the vector kernels while it resides in the 
+    //! L1 cache, so (raw-dark)*gain streams over raw, dark, gain, and the 
+    //! destination only once. 
+    //! 
+    //! If parallel is true and the expression has at least
+    //! parallel_inplace_arithmetics::min_size elements, the blocks are 
+    //! distributed over the library thread pool.
+    //!
+    //! \tparam T element type
+    //! \tparam ETYPE expression type
+    //! \param dest pointer to memory for n elements
+    //! \param e reference to the expression
+    //! \param n number of elements
+    //! \param parallel true for multi-threaded evaluation
+    //!
+    template<
+             typename T,
+             typename ETYPE
+            >
+    void evaluate_expression(T *dest,const ETYPE &e,size_t n,bool parallel)
+    {
+        typedef expression_evaluator<ETYPE> evaluator_type;
+        
+        auto evaluate = [dest,&e](size_t begin,size_t end)
+        {
+            std::vector<T> buffer((evaluator_type::buffers+1)*
+                                  expression_block);
+            for(size_t offset=begin;offset<end;offset+=expression_block)
+            {
+                size_t n = std::min(expression_block,end-offset);
+                const T *p = evaluator_type::load(e,offset,n,buffer.data(),
+                                             buffer.data()+expression_block);
+                std::copy(p,p+n,dest+offset);
+            }
+        };
+
+        if(parallel && n>=parallel_inplace_arithmetics::min_size)
+        {
+            size_t chunk = parallel_inplace_arithmetics::chunk_bytes/sizeof(T);
+            chunk = std::max(expression_block,
+                             chunk/expression_block*expression_block);
+            parallel_for(n,chunk,evaluate);
+        }
+        else
+            evaluate(0,n);
+    }
+
+//end of namespace
+}
+}
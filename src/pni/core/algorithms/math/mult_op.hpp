@@ -24,6 +24,8 @@
 #pragma once
 
 #include <pni/core/algorithms/math/op_traits.hpp>
+#include <pni/core/algorithms/math/broadcast_map.hpp>
+#include <pni/core/utilities/container_utils.hpp>
 #include <pni/core/utilities/container_iterator.hpp>
 
 namespace pni{
@@ -50,6 +52,8 @@ namespace core{
             typename op_trait<OP1T>::ref_type _op1;
             //! right operand
             typename op_trait<OP2T>::ref_type _op2;
+            //! broadcast information for the operands
+            binary_broadcast _broadcast;
         public:
             //--------------------public types---------------------------------
             //! value type of the multiplication
@@ -85,7 +89,8 @@ namespace core{
             //!
             mult_op(const OP1T &o1,const OP2T &o2):
                 _op1(o1),
-                _op2(o2)
+                _op2(o2),
+                _broadcast(o1,o2)
             {}
 
             //====================public methods===============================
@@ -98,7 +103,8 @@ namespace core{
             //!
             value_type operator[](size_t i) const
             {
-                return this->_op1[i]*this->_op2[i];
+                return this->_op1[_broadcast.lhs()(i)]*
+                       this->_op2[_broadcast.rhs()(i)];
             }
 
             //-----------------------------------------------------------------
@@ -128,9 +134,59 @@ namespace core{
             //!
             size_t size() const
             {
-                return _op1.size() > _op2.size() ? _op1.size() : _op2.size();
+                return _broadcast.size();
             }
 
+            //-----------------------------------------------------------------
+            //!
+            //! \brief get rank
+            //!
+            //! Return the rank of the broadcast result. 
+            //! \return number of dimensions of the result
+            //!
+            size_t rank() const
+            {
+                return _broadcast.shape().size();
+            }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief get shape
+            //!
+            //! Return the shape of the broadcast result.
+            //! \tparam CTYPE container type for the shape
+            //! \return shape of the result
+            //!
+            template<typename CTYPE> CTYPE shape() const
+            {
+                const shape_t &s = _broadcast.shape();
+                return container_utils<CTYPE>::create(s.begin(),s.end());
+            }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief get left operand
+            //!
+            const OP1T &lhs() const { return _op1; }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief get right operand
+            //!
+            const OP2T &rhs() const { return _op2; }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief get broadcast map of the left operand
+            //!
+            const broadcast_map &lhs_map() const { return _broadcast.lhs(); }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief get broadcast map of the right operand
+            //!
+            const broadcast_map &rhs_map() const { return _broadcast.rhs(); }
+
 
             //=====================iterators===================================
             //! 
@@ -0,0 +1,415 @@
+//
+// (c) Copyright 2026 DESY, Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+// This file is part of libpnicore.
+//
+// libpnicore is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpnicore is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpnicore.  If not, see <http://www.gnu.org/licenses/>.
+//
+// ============================================================================
+//
+// Created on: Oct 16, 2026
+//     Author: Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+
+#pragma once
+
+#include <algorithm>
+#include <type_traits>
+
+#include <pni/core/types.hpp>
+#include <pni/core/utilities/sfinae_macros.hpp>
+#include <pni/core/utilities/thread_pool.hpp>
+#include <pni/core/algorithms/math/inplace_arithmetics.hpp>
+#include <pni/core/algorithms/math/simd_inplace_arithmetics.hpp>
+
+namespace pni{
+namespace core{
+
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief multi-threaded inplace arithmetics
+    //!
+    //! An implementation of the inplace arithmetics policy which distributes
+    //! the work over the library thread pool (see thread_pool::instance()). 
+    //! The elements are split into chunks of chunk_bytes bytes which are 
+    //! processed in parallel. Arrays with less than min_size elements are 
+    //! processed serially as the synchronization overhead would dominate. 
+    //! 
+    //! Within a chunk the vector kernels of simd_inplace_arithmetics are 
+    //! used if both operands have a contiguous storage with the same element
+    //! type, otherwise the elements are accessed via operator[].
+    //!
+    //! The number of threads can be controlled via the PNICORE_NUM_THREADS
+    //! environment variable or thread_pool::instance().resize().
+    //!
+    /*!
+    \code
+    typedef mdarray<std::vector<float64>,dynamic_cindex_map,
+                    parallel_inplace_arithmetics> array_type;
+
+    auto a = array_type::create(shape_t{10000,10000});
+    a += 1.0;   //runs on all cores
+    \endcode
+    !*/
+    //!
+    struct parallel_inplace_arithmetics
+    {
+        //! minimum number of elements for parallel execution
+        static const size_t min_size = 1ul<<16;
+
+        //! number of bytes processed by a single chunk
+        static const size_t chunk_bytes = 1ul<<18;
+
+        private:
+            //----------------------------------------------------------------
+            //!
+            //! \brief get the chunk size
+            //!
+            //! \tparam T element type
+            //! \return number of elements per chunk
+            //!
+            template<typename T> static size_t chunk_size()
+            {
+                return std::max(size_t(chunk_bytes/sizeof(T)),size_t(1));
+            }
+
+            //----------------------------------------------------------------
+            //!
+            //! \brief vectorized scalar operation on a chunk
+            //!
+            template<
+                     typename OP,
+                     typename LTYPE,
+                     typename T
+                    >
+            static void scalar_chunk(LTYPE &a,const T &b,size_t begin,
+                                     size_t end,std::true_type)
+            {
+                simd_apply<OP>(a.data()+begin,b,end-begin);
+            }
+
+            //----------------------------------------------------------------
+            //!
+            //! \brief scalar operation on a chunk
+            //!
+            template<
+                     typename OP,
+                     typename LTYPE,
+                     typename T
+                    >
+            static void scalar_chunk(LTYPE &a,const T &b,size_t begin,
+                                     size_t end,std::false_type)
+            {
+                for(size_t i=begin;i<end;++i) OP::apply(a[i],b);
+            }
+
+            //----------------------------------------------------------------
+            //!
+            //! \brief vectorized array operation on a chunk
+            //!
+            template<
+                     typename OP,
+                     typename LTYPE,
+                     typename RTYPE
+                    >
+            static void array_chunk(LTYPE &a,const RTYPE &b,size_t begin,
+                                    size_t end,std::true_type)
+            {
+                simd_apply<OP>(a.data()+begin,b.data()+begin,end-begin);
+            }
+
+            //----------------------------------------------------------------
+            //!
+            //! \brief array operation on a chunk
+            //!
+            template<
+                     typename OP,
+                     typename LTYPE,
+                     typename RTYPE
+                    >
+            static void array_chunk(LTYPE &a,const RTYPE &b,size_t begin,
+                                    size_t end,std::false_type)
+            {
+                for(size_t i=begin;i<end;++i) OP::apply(a[i],b[i]);
+            }
+
+            //----------------------------------------------------------------
+            //!
+            //! \brief run a scalar operation
+            //!
+            template<
+                     typename OP,
+                     typename LTYPE,
+                     typename T
+                    >
+            static void scalar_op(LTYPE &a,const T &b)
+            {
+                typedef std::integral_constant<bool,
+                            simd_scalar_operation<LTYPE,T>::value> simd_type;
+                typedef typename LTYPE::value_type value_type;
+                size_t n = a.size();
+
+                if(n<min_size)
+                    scalar_chunk<OP>(a,b,0,n,simd_type());
+                else
+                    parallel_for(n,chunk_size<value_type>(),
+                                 [&a,&b](size_t begin,size_t end)
+                                 { scalar_chunk<OP>(a,b,begin,end,
+                                                    simd_type()); });
+            }
+
+            //----------------------------------------------------------------
+            //!
+            //! \brief run an array operation
+            //!
+            template<
+                     typename OP,
+                     typename LTYPE,
+                     typename RTYPE
+                    >
+            static void array_op(LTYPE &a,const RTYPE &b)
+            {
+                typedef std::integral_constant<bool,
+                            simd_array_operation<LTYPE,RTYPE>::value> simd_type;
+                typedef typename LTYPE::value_type value_type;
+                size_t n = a.size();
+
+                if(n<min_size)
+                    array_chunk<OP>(a,b,0,n,simd_type());
+                else
+                    parallel_for(n,chunk_size<value_type>(),
+                                 [&a,&b](size_t begin,size_t end)
+                                 { array_chunk<OP>(a,b,begin,end,
+                                                   simd_type()); });
+            }
+
+        public:
+            //================parallel initialization==========================
+            //!
+            //! \brief fill memory in parallel
+            //!
+            //! Fills the memory with the same partitioning as all other 
+            //! parallel operations. As the chunks are always assigned to 
+            //! the same threads every page is touched first by the thread 
+            //! which later processes it. On NUMA systems the pages are thus 
+            //! placed on the node of this thread.
+            //!
+            //! \tparam T element type
+            //! \param data pointer to the first element
+            //! \param n number of elements
+            //! \param value the value to fill in
+            //!
+            template<typename T> 
+            static void fill(T *data,size_t n,const T &value)
+            {
+                if(n<min_size)
+                    std::fill(data,data+n,value);
+                else
+                    parallel_for(n,chunk_size<T>(),
+                                 [data,&value](size_t begin,size_t end)
+                                 { std::fill(data+begin,data+end,value); });
+            }
+
+            //==================inplace addition===============================
+            //!
+            //! \brief add scalar to array
+            //!
+            //! Element wise inplace addition of a scalar to an array.
+            //!
+            //! \tparam LTYPE array type
+            //! \param a reference to an instance of LTYPE
+            //! \param b scalar value
+            //!
+            template<
+                     typename LTYPE,
+                     typename T,
+                     typename = enable_if<or_t<
+                               is_pod<T>,is_cmplx<T>
+                               >>
+                    >
+            static void add(LTYPE &a,T b)
+            {
+                CHECK_ARITHMETIC_SINGLE(LTYPE);
+                scalar_op<simd_add>(a,b);
+            }
+
+            //----------------------------------------------------------------
+            //!
+            //! \brief add array to array
+            //!
+            //! Element wise inplace addition of two arrays.
+            //!
+            //! \tparam LTYPE l.h.s. type
+            //! \tparam RTYPE r.h.s. type
+            //! \param a reference to an array of type LTYPE
+            //! \param b reference to an array of type RTYPE
+            //!
+            template<
+                     typename LTYPE,
+                     typename RTYPE,
+                     typename = enable_if<not_t<
+                                or_t<is_pod<RTYPE>,is_cmplx<RTYPE>>
+                                >>
+                    >
+            static void add(LTYPE &a,const RTYPE &b)
+            {
+                CHECK_ARITHMETIC_DOUBLE(LTYPE,RTYPE);
+                array_op<simd_add>(a,b);
+            }
+
+            //==================inplace subtraction============================
+            //!
+            //! \brief subtract scalar from array
+            //!
+            //! Element wise subtraction of a scalar from an array.
+            //!
+            //! \tparam LTYPE l.h.s. array type
+            //! \param a reference to the l.h.s.
+            //! \param b scalar value on the r.h.s.
+            //!
+            template<
+                     typename LTYPE,
+                     typename T,
+                     typename = enable_if<or_t<
+                                is_pod<T>,is_cmplx<T>
+                                >>
+                    >
+            static void sub(LTYPE &a,T b)
+            {
+                CHECK_ARITHMETIC_SINGLE(LTYPE);
+                scalar_op<simd_sub>(a,b);
+            }
+
+            //----------------------------------------------------------------
+            //!
+            //! \brief subtract array from array
+            //!
+            //! Element wise inplace subtraction of two arrays.
+            //!
+            //! \tparam LTYPE l.h.s. array type
+            //! \tparam RTYPE r.h.s. array type
+            //! \param a reference to the l.h.s.
+            //! \param b reference to the r.h.s.
+            //!
+            template<
+                     typename LTYPE,
+                     typename RTYPE,
+                     typename = enable_if<not_t<
+                                or_t<is_pod<RTYPE>,is_cmplx<RTYPE>>
+                                >>
+                    >
+            static void sub(LTYPE &a,const RTYPE &b)
+            {
+                CHECK_ARITHMETIC_DOUBLE(LTYPE,RTYPE);
+                array_op<simd_sub>(a,b);
+            }
+
+            //=====================inplace multiplication======================
+            //!
+            //! \brief multiply array with scalar
+            //!
+            //! Element wise inplace multiplication of an array with a scalar.
+            //!
+            //! \tparam LTYPE l.h.s. array type
+            //! \param a reference to the l.h.s.
+            //! \param b scalar r.h.s. value
+            //!
+            template<
+                     typename LTYPE,
+                     typename T,
+                     typename = enable_if<or_t<
+                                is_pod<T>,is_cmplx<T>
+                                >>
+                    >
+            static void mult(LTYPE &a,T b)
+            {
+                CHECK_ARITHMETIC_SINGLE(LTYPE);
+                scalar_op<simd_mult>(a,b);
+            }
+
+            //----------------------------------------------------------------
+            //!
+            //! \brief multiply array by array
+            //!
+            //! Element wise inplace multiplication of two arrays.
+            //!
+            //! \tparam LTYPE l.h.s. array type
+            //! \tparam RTYPE r.h.s. array type
+            //! \param a reference to the l.h.s.
+            //! \param b reference to the r.h.s.
+            //!
+            template<
+                     typename LTYPE,
+                     typename RTYPE,
+                     typename = enable_if<not_t<
+                                or_t<is_pod<RTYPE>,is_cmplx<RTYPE>>
+                                >>
+                    >
+            static void mult(LTYPE &a,const RTYPE &b)
+            {
+                CHECK_ARITHMETIC_DOUBLE(LTYPE,RTYPE);
+                array_op<simd_mult>(a,b);
+            }
+
+            //=====================inplace division============================
+            //!
+            //! \brief divide array by scalar
+            //!
+            //! Element wise inplace division of an array by a scalar.
+            //!
+            //! \tparam LTYPE l.h.s. array type
+            //! \param a reference to the l.h.s.
+            //! \param b scalar r.h.s. value
+            //!
+            template<
+                     typename LTYPE,
+                     typename T,
+                     typename = enable_if<or_t<
+                                is_pod<T>,is_cmplx<T>
+                                >>
+                    >
+            static void div(LTYPE &a,T b)
+            {
+                CHECK_ARITHMETIC_SINGLE(LTYPE);
+                scalar_op<simd_div>(a,b);
+            }
+
+            //----------------------------------------------------------------
+            //!
+            //! \brief divide array by array
+            //!
+            //! Element wise inplace division of two arrays.
+            //!
+            //! \tparam LTYPE l.h.s. array type
+            //! \tparam RTYPE r.h.s. array type
+            //! \param a reference to the l.h.s.
+            //! \param b reference to the r.h.s.
+            //!
+            template<
+                     typename LTYPE,
+                     typename RTYPE,
+                     typename = enable_if<not_t<
+                                or_t<is_pod<RTYPE>,is_cmplx<RTYPE>>
+                                >>
+                    >
+            static void div(LTYPE &a,const RTYPE &b)
+            {
+                CHECK_ARITHMETIC_DOUBLE(LTYPE,RTYPE);
+                array_op<simd_div>(a,b);
+            }
+    };
+
+//end namespace
+}
+}
@@ -0,0 +1,407 @@
+//
+// (c) Copyright 2026 DESY, Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+// This file is part of libpnicore.
+//
+// libpnicore is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpnicore is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpnicore.  If not, see <http://www.gnu.org/licenses/>.
+//
+// ============================================================================
+//
+// Created on: Oct 16, 2026
+//     Author: Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+
+#pragma once
+
+#include <type_traits>
+
+#include <pni/core/types.hpp>
+#include <pni/core/types/container_trait.hpp>
+#include <pni/core/utilities/sfinae_macros.hpp>
+#include <pni/core/algorithms/math/inplace_arithmetics.hpp>
+#include <pni/core/algorithms/math/simd_kernels.hpp>
+
+namespace pni{
+namespace core{
+
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief check if a scalar operation can be vectorized
+    //!
+    //! A scalar operation can be vectorized if the array has a contiguous
+    //! storage and the scalar has the same type as the elements of the
+    //! array.
+    //!
+    //! \tparam LTYPE array type
+    //! \tparam T scalar type
+    //!
+    template<
+             typename LTYPE,
+             typename T
+            >
+    struct simd_scalar_operation
+    {
+        //! element type of the array
+        typedef typename LTYPE::value_type value_type;
+
+        //! true if the operation can use the vector kernels
+        static const bool value = container_trait<LTYPE>::is_contiguous &&
+                                  std::is_same<value_type,T>::value &&
+                                  !std::is_same<value_type,bool>::value;
+    };
+
+    //------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief check if an array operation can be vectorized
+    //!
+    //! An array operation can be vectorized if both arrays have a
+    //! contiguous storage and the same element type.
+    //!
+    //! \tparam LTYPE l.h.s. array type
+    //! \tparam RTYPE r.h.s. array type
+    //!
+    template<
+             typename LTYPE,
+             typename RTYPE
+            >
+    struct simd_array_operation
+    {
+        //! element type of the l.h.s. array
+        typedef typename LTYPE::value_type value_type;
+
+        //! true if the operation can use the vector kernels
+        static const bool value =
+            container_trait<LTYPE>::is_contiguous &&
+            container_trait<RTYPE>::is_contiguous &&
+            std::is_same<value_type,typename RTYPE::value_type>::value &&
+            !std::is_same<value_type,bool>::value;
+    };
+
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief SIMD inplace arithmetics
+    //!
+    //! An implementation of the inplace arithmetics policy using explicitly
+    //! vectorized kernels. The kernel for the best instruction set available
+    //! (SSE2, AVX2, or AVX-512) is selected at runtime.
+    //!
+    //! The vector kernels are only used if the array operands have a
+    //! contiguous storage (container_trait<T>::is_contiguous) and share the
+    //! same element type. In all other cases (for instance for array views
+    //! with strides or for expression templates on the r.h.s.) the scalar
+    //! loop is used.
+    //!
+    //! Integer division and complex multiplication and division have no
+    //! lane-wise vector instruction and are thus always done by the scalar
+    //! loop (which the compiler can still auto-vectorize).
+    //!
+    /*!
+    \code
+    typedef mdarray<std::vector<float32>,dynamic_cindex_map,
+                    simd_inplace_arithmetics> array_type;
+
+    auto frame = array_type::create(shape_t{2048,2048});
+    auto dark  = array_type::create(shape_t{2048,2048});
+
+    frame -= dark;   //uses the vectorized kernels
+    \endcode
+    !*/
+    //!
+    struct simd_inplace_arithmetics
+    {
+        private:
+            //----------------------------------------------------------------
+            //!
+            //! \brief vectorized scalar operation
+            //!
+            template<
+                     typename OP,
+                     typename LTYPE,
+                     typename T
+                    >
+            static void scalar_op(LTYPE &a,const T &b,std::true_type)
+            {
+                simd_apply<OP>(a.data(),b,a.size());
+            }
+
+            //----------------------------------------------------------------
+            //!
+            //! \brief scalar operation fallback
+            //!
+            template<
+                     typename OP,
+                     typename LTYPE,
+                     typename T
+                    >
+            static void scalar_op(LTYPE &a,const T &b,std::false_type)
+            {
+                size_t n = a.size();
+                for(size_t i=0;i<n;++i) OP::apply(a[i],b);
+            }
+
+            //----------------------------------------------------------------
+            //!
+            //! \brief vectorized array operation
+            //!
+            template<
+                     typename OP,
+                     typename LTYPE,
+                     typename RTYPE
+                    >
+            static void array_op(LTYPE &a,const RTYPE &b,std::true_type)
+            {
+                simd_apply<OP>(a.data(),b.data(),a.size());
+            }
+
+            //----------------------------------------------------------------
+            //!
+            //! \brief array operation fallback
+            //!
+            template<
+                     typename OP,
+                     typename LTYPE,
+                     typename RTYPE
+                    >
+            static void array_op(LTYPE &a,const RTYPE &b,std::false_type)
+            {
+                size_t n = a.size();
+                for(size_t i=0;i<n;++i) OP::apply(a[i],b[i]);
+            }
+
+            //----------------------------------------------------------------
+            //!
+            //! \brief dispatch a scalar operation
+            //!
+            template<
+                     typename OP,
+                     typename LTYPE,
+                     typename T
+                    >
+            static void scalar_op(LTYPE &a,const T &b)
+            {
+                typedef simd_scalar_operation<LTYPE,T> trait_type;
+                scalar_op<OP>(a,b,
+                              std::integral_constant<bool,trait_type::value>());
+            }
+
+            //----------------------------------------------------------------
+            //!
+            //! \brief dispatch an array operation
+            //!
+            template<
+                     typename OP,
+                     typename LTYPE,
+                     typename RTYPE
+                    >
+            static void array_op(LTYPE &a,const RTYPE &b)
+            {
+                typedef simd_array_operation<LTYPE,RTYPE> trait_type;
+                array_op<OP>(a,b,
+                             std::integral_constant<bool,trait_type::value>());
+            }
+
+        public:
+            //==================inplace addition===============================
+            //!
+            //! \brief add scalar to array
+            //!
+            //! Element wise inplace addition of a scalar to an array.
+            //!
+            //! \tparam LTYPE array type
+            //! \param a reference to an instance of LTYPE
+            //! \param b scalar value
+            //!
+            template<
+                     typename LTYPE,
+                     typename T,
+                     typename = enable_if<or_t<
+                               is_pod<T>,is_cmplx<T>
+                               >>
+                    >
+            static void add(LTYPE &a,T b)
+            {
+                CHECK_ARITHMETIC_SINGLE(LTYPE);
+                scalar_op<simd_add>(a,b);
+            }
+
+            //----------------------------------------------------------------
+            //!
+            //! \brief add array to array
+            //!
+            //! Element wise inplace addition of two arrays.
+            //!
+            //! \tparam LTYPE l.h.s. type
+            //! \tparam RTYPE r.h.s. type
+            //! \param a reference to an array of type LTYPE
+            //! \param b reference to an array of type RTYPE
+            //!
+            template<
+                     typename LTYPE,
+                     typename RTYPE,
+                     typename = enable_if<not_t<
+                                or_t<is_pod<RTYPE>,is_cmplx<RTYPE>>
+                                >>
+                    >
+            static void add(LTYPE &a,const RTYPE &b)
+            {
+                CHECK_ARITHMETIC_DOUBLE(LTYPE,RTYPE);
+                array_op<simd_add>(a,b);
+            }
+
+            //==================inplace subtraction============================
+            //!
+            //! \brief subtract scalar from array
+            //!
+            //! Element wise subtraction of a scalar from an array.
+            //!
+            //! \tparam LTYPE l.h.s. array type
+            //! \param a reference to the l.h.s.
+            //! \param b scalar value on the r.h.s.
+            //!
+            template<
+                     typename LTYPE,
+                     typename T,
+                     typename = enable_if<or_t<
+                                is_pod<T>,is_cmplx<T>
+                                >>
+                    >
+            static void sub(LTYPE &a,T b)
+            {
+                CHECK_ARITHMETIC_SINGLE(LTYPE);
+                scalar_op<simd_sub>(a,b);
+            }
+
+            //----------------------------------------------------------------
+            //!
+            //! \brief subtract array from array
+            //!
+            //! Element wise inplace subtraction of two arrays.
+            //!
+            //! \tparam LTYPE l.h.s. array type
+            //! \tparam RTYPE r.h.s. array type
+            //! \param a reference to the l.h.s.
+            //! \param b reference to the r.h.s.
+            //!
+            template<
+                     typename LTYPE,
+                     typename RTYPE,
+                     typename = enable_if<not_t<
+                                or_t<is_pod<RTYPE>,is_cmplx<RTYPE>>
+                                >>
+                    >
+            static void sub(LTYPE &a,const RTYPE &b)
+            {
+                CHECK_ARITHMETIC_DOUBLE(LTYPE,RTYPE);
+                array_op<simd_sub>(a,b);
+            }
+
+            //=====================inplace multiplication======================
+            //!
+            //! \brief multiply array with scalar
+            //!
+            //! Element wise inplace multiplication of an array with a scalar.
+            //!
+            //! \tparam LTYPE l.h.s. array type
+            //! \param a reference to the l.h.s.
+            //! \param b scalar r.h.s. value
+            //!
+            template<
+                     typename LTYPE,
+                     typename T,
+                     typename = enable_if<or_t<
+                                is_pod<T>,is_cmplx<T>
+                                >>
+                    >
+            static void mult(LTYPE &a,T b)
+            {
+                CHECK_ARITHMETIC_SINGLE(LTYPE);
+                scalar_op<simd_mult>(a,b);
+            }
+
+            //----------------------------------------------------------------
+            //!
+            //! \brief multiply array by array
+            //!
+            //! Element wise inplace multiplication of two arrays.
+            //!
+            //! \tparam LTYPE l.h.s. array type
+            //! \tparam RTYPE r.h.s. array type
+            //! \param a reference to the l.h.s.
+            //! \param b reference to the r.h.s.
+            //!
+            template<
+                     typename LTYPE,
+                     typename RTYPE,
+                     typename = enable_if<not_t<
+                                or_t<is_pod<RTYPE>,is_cmplx<RTYPE>>
+                                >>
+                    >
+            static void mult(LTYPE &a,const RTYPE &b)
+            {
+                CHECK_ARITHMETIC_DOUBLE(LTYPE,RTYPE);
+                array_op<simd_mult>(a,b);
+            }
+
+            //=====================inplace division============================
+            //!
+            //! \brief divide array by scalar
+            //!
+            //! Element wise inplace division of an array by a scalar.
+            //!
+            //! \tparam LTYPE l.h.s. array type
+            //! \param a reference to the l.h.s.
+            //! \param b scalar r.h.s. value
+            //!
+            template<
+                     typename LTYPE,
+                     typename T,
+                     typename = enable_if<or_t<
+                                is_pod<T>,is_cmplx<T>
+                                >>
+                    >
+            static void div(LTYPE &a,T b)
+            {
+                CHECK_ARITHMETIC_SINGLE(LTYPE);
+                scalar_op<simd_div>(a,b);
+            }
+
+            //----------------------------------------------------------------
+            //!
+            //! \brief divide array by array
+            //!
+            //! Element wise inplace division of two arrays.
+            //!
+            //! \tparam LTYPE l.h.s. array type
+            //! \tparam RTYPE r.h.s. array type
+            //! \param a reference to the l.h.s.
+            //! \param b reference to the r.h.s.
+            //!
+            template<
+                     typename LTYPE,
+                     typename RTYPE,
+                     typename = enable_if<not_t<
+                                or_t<is_pod<RTYPE>,is_cmplx<RTYPE>>
+                                >>
+                    >
+            static void div(LTYPE &a,const RTYPE &b)
+            {
+                CHECK_ARITHMETIC_DOUBLE(LTYPE,RTYPE);
+                array_op<simd_div>(a,b);
+            }
+    };
+
+//end namespace
+}
+}
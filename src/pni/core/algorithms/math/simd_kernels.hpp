@@ -0,0 +1,540 @@
+//
+// (c) Copyright 2026 DESY, Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+// This file is part of libpnicore.
+//
+// libpnicore is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpnicore is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpnicore.  If not, see <http://www.gnu.org/licenses/>.
+//
+// ============================================================================
+//
+// Created on: Oct 16, 2026
+//     Author: Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <complex>
+#include <atomic>
+#include <type_traits>
+
+#if (defined(__GNUC__) || defined(__clang__)) && \
+    (defined(__x86_64__) || defined(__i386__))
+#define PNI_CORE_X86_SIMD
+#include <immintrin.h>
+#endif
+
+namespace pni{
+namespace core{
+
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief SIMD instruction set levels
+    //!
+    //! The instruction set levels used by the vectorized inplace arithmetic
+    //! kernels. The levels are ordered - a CPU supporting a particular
+    //! level supports all the levels below it.
+    //!
+    enum class simd_isa_t { NONE,   //!< no vector instructions - scalar code
+                            SSE2,   //!< 128Bit SSE2 instructions
+                            AVX2,   //!< 256Bit AVX2 instructions
+                            AVX512  //!< 512Bit AVX-512F/BW instructions
+                          };
+
+    //------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief detect the SIMD level of the CPU
+    //!
+    //! Determines at runtime the highest instruction set level supported
+    //! by the CPU (and the operating system) the program is running on.
+    //! On non-x86 platforms or with compilers other than GCC and Clang
+    //! this function always returns simd_isa_t::NONE.
+    //!
+    //! \return highest supported instruction set level
+    //!
+    inline simd_isa_t detect_simd_isa()
+    {
+#ifdef PNI_CORE_X86_SIMD
+        __builtin_cpu_init();
+        if(__builtin_cpu_supports("avx512f") &&
+           __builtin_cpu_supports("avx512bw"))
+            return simd_isa_t::AVX512;
+
+        if(__builtin_cpu_supports("avx2")) return simd_isa_t::AVX2;
+        if(__builtin_cpu_supports("sse2")) return simd_isa_t::SSE2;
+#endif
+        return simd_isa_t::NONE;
+    }
+
+    //------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief storage for the active SIMD level
+    //!
+    //! The level is initialized with the result of detect_simd_isa() on
+    //! first use.
+    //!
+    inline std::atomic<int> &simd_isa_storage()
+    {
+        static std::atomic<int> isa(static_cast<int>(detect_simd_isa()));
+        return isa;
+    }
+
+    //------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief get the active SIMD level
+    //!
+    //! \return instruction set level currently used by the kernels
+    //!
+    inline simd_isa_t simd_isa()
+    {
+        return static_cast<simd_isa_t>(
+                simd_isa_storage().load(std::memory_order_relaxed));
+    }
+
+    //------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief set the active SIMD level
+    //!
+    //! Restricts the kernels to a particular instruction set level. This is
+    //! mainly useful for testing and benchmarking. A level above the one
+    //! supported by the CPU is reduced to the highest supported level.
+    //!
+    //! \param isa the requested instruction set level
+    //!
+    inline void simd_isa(simd_isa_t isa)
+    {
+        simd_isa_t max = detect_simd_isa();
+        if(isa > max) isa = max;
+        simd_isa_storage().store(static_cast<int>(isa),
+                                 std::memory_order_relaxed);
+    }
+
+    //========================================================================
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief inplace addition operation
+    //!
+    struct simd_add
+    {
+        template<
+                 typename A,
+                 typename B
+                >
+        static void apply(A &a,const B &b) { a += b; }
+    };
+
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief inplace subtraction operation
+    //!
+    struct simd_sub
+    {
+        template<
+                 typename A,
+                 typename B
+                >
+        static void apply(A &a,const B &b) { a -= b; }
+    };
+
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief inplace multiplication operation
+    //!
+    struct simd_mult
+    {
+        template<
+                 typename A,
+                 typename B
+                >
+        static void apply(A &a,const B &b) { a *= b; }
+    };
+
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief inplace division operation
+    //!
+    struct simd_div
+    {
+        template<
+                 typename A,
+                 typename B
+                >
+        static void apply(A &a,const B &b) { a /= b; }
+    };
+
+    //========================================================================
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief vector kernel for a particular lane type
+    //!
+    //! The default template is used for all combinations of instruction set,
+    //! lane type and operation for which no vector kernel exists.
+    //! Specializations provide two static member functions
+    //!
+    //! \li array(a,b,n) computing a[i] OP= b[i]
+    //! \li pattern(a,p,n) computing a[i] OP= p[i%W] where W is the number
+    //! of lanes in a vector register
+    //!
+    //! \tparam ISA instruction set level
+    //! \tparam LANE lane type (a primitive arithmetic type)
+    //! \tparam OP operation type
+    //!
+    template<
+             simd_isa_t ISA,
+             typename   LANE,
+             typename   OP
+            >
+    struct simd_lane_kernel
+    {
+        //! no kernel available
+        static const bool available = false;
+
+        //! number of lanes in a vector register
+        static const size_t width = 1;
+
+        //! dummy array kernel
+        static void array(LANE *,const LANE *,size_t) {}
+
+        //! dummy pattern kernel
+        static void pattern(LANE *,const LANE *,size_t) {}
+    };
+
+#ifdef PNI_CORE_X86_SIMD
+
+#define PNI_SIMD_KERNEL(ISA,TARGET,LANE,REG,PTR,LOAD,STORE,OP,INTRIN)\
+    template<> struct simd_lane_kernel<simd_isa_t::ISA,LANE,OP>\
+    {\
+        static const bool available = true;\
+        static const size_t width = sizeof(REG)/sizeof(LANE);\
+        __attribute__((target(TARGET)))\
+        static void array(LANE *a,const LANE *b,size_t n)\
+        {\
+            size_t i = 0;\
+            for(;i+width<=n;i+=width)\
+                STORE((PTR*)(a+i),INTRIN(LOAD((const PTR*)(a+i)),\
+                                         LOAD((const PTR*)(b+i))));\
+            for(;i<n;++i) OP::apply(a[i],b[i]);\
+        }\
+        __attribute__((target(TARGET)))\
+        static void pattern(LANE *a,const LANE *p,size_t n)\
+        {\
+            size_t i = 0;\
+            REG r = LOAD((const PTR*)p);\
+            for(;i+width<=n;i+=width)\
+                STORE((PTR*)(a+i),INTRIN(LOAD((const PTR*)(a+i)),r));\
+            for(size_t j=0;i<n;++i,++j) OP::apply(a[i],p[j]);\
+        }\
+    }
+
+#define PNI_SIMD_INT_KERNELS(ISA,TARGET,BITS,REG,LOAD,STORE,ADD,SUB)\
+    PNI_SIMD_KERNEL(ISA,TARGET,int##BITS##_t,REG,REG,LOAD,STORE,simd_add,ADD);\
+    PNI_SIMD_KERNEL(ISA,TARGET,int##BITS##_t,REG,REG,LOAD,STORE,simd_sub,SUB);\
+    PNI_SIMD_KERNEL(ISA,TARGET,uint##BITS##_t,REG,REG,LOAD,STORE,simd_add,ADD);\
+    PNI_SIMD_KERNEL(ISA,TARGET,uint##BITS##_t,REG,REG,LOAD,STORE,simd_sub,SUB)
+
+#define PNI_SIMD_INT_MULT_KERNELS(ISA,TARGET,BITS,REG,LOAD,STORE,MULT)\
+    PNI_SIMD_KERNEL(ISA,TARGET,int##BITS##_t,REG,REG,LOAD,STORE,simd_mult,MULT);\
+    PNI_SIMD_KERNEL(ISA,TARGET,uint##BITS##_t,REG,REG,LOAD,STORE,simd_mult,MULT)
+
+#define PNI_SIMD_FLOAT_KERNELS(ISA,TARGET,LANE,REG,LOAD,STORE,ADD,SUB,MULT,DIV)\
+    PNI_SIMD_KERNEL(ISA,TARGET,LANE,REG,LANE,LOAD,STORE,simd_add,ADD);\
+    PNI_SIMD_KERNEL(ISA,TARGET,LANE,REG,LANE,LOAD,STORE,simd_sub,SUB);\
+    PNI_SIMD_KERNEL(ISA,TARGET,LANE,REG,LANE,LOAD,STORE,simd_mult,MULT);\
+    PNI_SIMD_KERNEL(ISA,TARGET,LANE,REG,LANE,LOAD,STORE,simd_div,DIV)
+
+    //--------------------------SSE2 kernels----------------------------------
+    PNI_SIMD_FLOAT_KERNELS(SSE2,"sse2",float,__m128,_mm_loadu_ps,_mm_storeu_ps,
+                           _mm_add_ps,_mm_sub_ps,_mm_mul_ps,_mm_div_ps);
+    PNI_SIMD_FLOAT_KERNELS(SSE2,"sse2",double,__m128d,_mm_loadu_pd,
+                           _mm_storeu_pd,
+                           _mm_add_pd,_mm_sub_pd,_mm_mul_pd,_mm_div_pd);
+    PNI_SIMD_INT_KERNELS(SSE2,"sse2",8,__m128i,_mm_loadu_si128,_mm_storeu_si128,
+                         _mm_add_epi8,_mm_sub_epi8);
+    PNI_SIMD_INT_KERNELS(SSE2,"sse2",16,__m128i,_mm_loadu_si128,
+                         _mm_storeu_si128,_mm_add_epi16,_mm_sub_epi16);
+    PNI_SIMD_INT_KERNELS(SSE2,"sse2",32,__m128i,_mm_loadu_si128,
+                         _mm_storeu_si128,_mm_add_epi32,_mm_sub_epi32);
+    PNI_SIMD_INT_KERNELS(SSE2,"sse2",64,__m128i,_mm_loadu_si128,
+                         _mm_storeu_si128,_mm_add_epi64,_mm_sub_epi64);
+    PNI_SIMD_INT_MULT_KERNELS(SSE2,"sse2",16,__m128i,_mm_loadu_si128,
+                              _mm_storeu_si128,_mm_mullo_epi16);
+
+    //--------------------------AVX2 kernels----------------------------------
+    PNI_SIMD_FLOAT_KERNELS(AVX2,"avx2",float,__m256,_mm256_loadu_ps,
+                           _mm256_storeu_ps,_mm256_add_ps,_mm256_sub_ps,
+                           _mm256_mul_ps,_mm256_div_ps);
+    PNI_SIMD_FLOAT_KERNELS(AVX2,"avx2",double,__m256d,_mm256_loadu_pd,
+                           _mm256_storeu_pd,_mm256_add_pd,_mm256_sub_pd,
+                           _mm256_mul_pd,_mm256_div_pd);
+    PNI_SIMD_INT_KERNELS(AVX2,"avx2",8,__m256i,_mm256_loadu_si256,
+                         _mm256_storeu_si256,_mm256_add_epi8,_mm256_sub_epi8);
+    PNI_SIMD_INT_KERNELS(AVX2,"avx2",16,__m256i,_mm256_loadu_si256,
+                         _mm256_storeu_si256,_mm256_add_epi16,_mm256_sub_epi16);
+    PNI_SIMD_INT_KERNELS(AVX2,"avx2",32,__m256i,_mm256_loadu_si256,
+                         _mm256_storeu_si256,_mm256_add_epi32,_mm256_sub_epi32);
+    PNI_SIMD_INT_KERNELS(AVX2,"avx2",64,__m256i,_mm256_loadu_si256,
+                         _mm256_storeu_si256,_mm256_add_epi64,_mm256_sub_epi64);
+    PNI_SIMD_INT_MULT_KERNELS(AVX2,"avx2",16,__m256i,_mm256_loadu_si256,
+                              _mm256_storeu_si256,_mm256_mullo_epi16);
+    PNI_SIMD_INT_MULT_KERNELS(AVX2,"avx2",32,__m256i,_mm256_loadu_si256,
+                              _mm256_storeu_si256,_mm256_mullo_epi32);
+
+    //-------------------------AVX-512 kernels--------------------------------
+    PNI_SIMD_FLOAT_KERNELS(AVX512,"avx512f,avx512bw",float,__m512,
+                           _mm512_loadu_ps,_mm512_storeu_ps,
+                           _mm512_add_ps,_mm512_sub_ps,
+                           _mm512_mul_ps,_mm512_div_ps);
+    PNI_SIMD_FLOAT_KERNELS(AVX512,"avx512f,avx512bw",double,__m512d,
+                           _mm512_loadu_pd,_mm512_storeu_pd,
+                           _mm512_add_pd,_mm512_sub_pd,
+                           _mm512_mul_pd,_mm512_div_pd);
+    PNI_SIMD_INT_KERNELS(AVX512,"avx512f,avx512bw",8,__m512i,_mm512_loadu_si512,
+                         _mm512_storeu_si512,_mm512_add_epi8,_mm512_sub_epi8);
+    PNI_SIMD_INT_KERNELS(AVX512,"avx512f,avx512bw",16,__m512i,
+                         _mm512_loadu_si512,_mm512_storeu_si512,
+                         _mm512_add_epi16,_mm512_sub_epi16);
+    PNI_SIMD_INT_KERNELS(AVX512,"avx512f,avx512bw",32,__m512i,
+                         _mm512_loadu_si512,_mm512_storeu_si512,
+                         _mm512_add_epi32,_mm512_sub_epi32);
+    PNI_SIMD_INT_KERNELS(AVX512,"avx512f,avx512bw",64,__m512i,
+                         _mm512_loadu_si512,_mm512_storeu_si512,
+                         _mm512_add_epi64,_mm512_sub_epi64);
+    PNI_SIMD_INT_MULT_KERNELS(AVX512,"avx512f,avx512bw",16,__m512i,
+                              _mm512_loadu_si512,_mm512_storeu_si512,
+                              _mm512_mullo_epi16);
+    PNI_SIMD_INT_MULT_KERNELS(AVX512,"avx512f,avx512bw",32,__m512i,
+                              _mm512_loadu_si512,_mm512_storeu_si512,
+                              _mm512_mullo_epi32);
+
+#undef PNI_SIMD_FLOAT_KERNELS
+#undef PNI_SIMD_INT_MULT_KERNELS
+#undef PNI_SIMD_INT_KERNELS
+#undef PNI_SIMD_KERNEL
+
+#endif
+
+    //========================================================================
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief map element types to lane types
+    //!
+    //! Arithmetic types are processed as a single lane. Complex numbers are
+    //! processed as two lanes of their base type. As complex multiplication
+    //! and division do not operate lane by lane only addition and
+    //! subtraction are vectorized for complex types.
+    //!
+    //! \tparam T element type
+    //! \tparam OP operation type
+    //!
+    template<
+             typename T,
+             typename OP
+            >
+    struct simd_element_trait
+    {
+        //! the lane type
+        typedef T lane_type;
+        //! number of lanes per element
+        static const size_t lanes = 1;
+        //! true if the operation can be done lane by lane
+        static const bool lane_wise = true;
+    };
+
+    //------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief map complex element types to lane types
+    //!
+    template<
+             typename T,
+             typename OP
+            >
+    struct simd_element_trait<std::complex<T>,OP>
+    {
+        //! the lane type
+        typedef T lane_type;
+        //! number of lanes per element
+        static const size_t lanes = 2;
+        //! true if the operation can be done lane by lane
+        static const bool lane_wise = std::is_same<OP,simd_add>::value ||
+                                      std::is_same<OP,simd_sub>::value;
+    };
+
+    //------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief run the best vector kernel available
+    //!
+    //! Selects at runtime the kernel for the highest instruction set level
+    //! which is enabled and for which a kernel exists.
+    //!
+    //! \tparam LANE lane type
+    //! \tparam OP operation type
+    //!
+    template<
+             typename LANE,
+             typename OP
+            >
+    struct simd_dispatch
+    {
+        typedef simd_lane_kernel<simd_isa_t::AVX512,LANE,OP> avx512_kernel;
+        typedef simd_lane_kernel<simd_isa_t::AVX2,LANE,OP>   avx2_kernel;
+        typedef simd_lane_kernel<simd_isa_t::SSE2,LANE,OP>   sse2_kernel;
+
+        //--------------------------------------------------------------------
+        //!
+        //! \brief get the active register width
+        //!
+        //! \return number of lanes of the kernel used or 0 if there is no
+        //!         vector kernel
+        //!
+        static size_t width()
+        {
+            simd_isa_t isa = simd_isa();
+            if(avx512_kernel::available && isa>=simd_isa_t::AVX512)
+                return avx512_kernel::width;
+            if(avx2_kernel::available && isa>=simd_isa_t::AVX2)
+                return avx2_kernel::width;
+            if(sse2_kernel::available && isa>=simd_isa_t::SSE2)
+                return sse2_kernel::width;
+            return 0;
+        }
+
+        //--------------------------------------------------------------------
+        //!
+        //! \brief array kernel
+        //!
+        //! \return true if a vector kernel was used, false otherwise
+        //!
+        static bool array(LANE *a,const LANE *b,size_t n)
+        {
+            simd_isa_t isa = simd_isa();
+            if(avx512_kernel::available && isa>=simd_isa_t::AVX512)
+                avx512_kernel::array(a,b,n);
+            else if(avx2_kernel::available && isa>=simd_isa_t::AVX2)
+                avx2_kernel::array(a,b,n);
+            else if(sse2_kernel::available && isa>=simd_isa_t::SSE2)
+                sse2_kernel::array(a,b,n);
+            else
+                return false;
+
+            return true;
+        }
+
+        //--------------------------------------------------------------------
+        //!
+        //! \brief pattern kernel
+        //!
+        //! The pattern p must provide at least width() lanes.
+        //!
+        //! \return true if a vector kernel was used, false otherwise
+        //!
+        static bool pattern(LANE *a,const LANE *p,size_t n)
+        {
+            simd_isa_t isa = simd_isa();
+            if(avx512_kernel::available && isa>=simd_isa_t::AVX512)
+                avx512_kernel::pattern(a,p,n);
+            else if(avx2_kernel::available && isa>=simd_isa_t::AVX2)
+                avx2_kernel::pattern(a,p,n);
+            else if(sse2_kernel::available && isa>=simd_isa_t::SSE2)
+                sse2_kernel::pattern(a,p,n);
+            else
+                return false;
+
+            return true;
+        }
+    };
+
+    //------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief vectorized inplace operation on two buffers
+    //!
+    //! Computes a[i] OP= b[i] for n elements using the best available
+    //! vector kernel. If there is no kernel for the element type a plain
+    //! loop is used.
+    //!
+    //! \tparam OP operation type
+    //! \tparam T element type
+    //! \param a pointer to the l.h.s. buffer
+    //! \param b pointer to the r.h.s. buffer
+    //! \param n number of elements
+    //!
+    template<
+             typename OP,
+             typename T
+            >
+    void simd_apply(T *a,const T *b,size_t n)
+    {
+        typedef simd_element_trait<T,OP> trait_type;
+        typedef typename trait_type::lane_type lane_type;
+
+        if(trait_type::lane_wise &&
+           simd_dispatch<lane_type,OP>::array(
+                   reinterpret_cast<lane_type*>(a),
+                   reinterpret_cast<const lane_type*>(b),
+                   n*trait_type::lanes))
+            return;
+
+        for(size_t i=0;i<n;++i) OP::apply(a[i],b[i]);
+    }
+
+    //------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief vectorized inplace operation with a scalar
+    //!
+    //! Computes a[i] OP= s for n elements using the best available
+    //! vector kernel. If there is no kernel for the element type a plain
+    //! loop is used.
+    //!
+    //! \tparam OP operation type
+    //! \tparam T element type
+    //! \param a pointer to the l.h.s. buffer
+    //! \param s the scalar r.h.s.
+    //! \param n number of elements
+    //!
+    template<
+             typename OP,
+             typename T
+            >
+    void simd_apply(T *a,const T &s,size_t n)
+    {
+        typedef simd_element_trait<T,OP> trait_type;
+        typedef typename trait_type::lane_type lane_type;
+        typedef simd_dispatch<lane_type,OP> dispatch_type;
+
+        if(trait_type::lane_wise)
+        {
+            //the pattern must be able to hold a 512Bit register
+            const size_t np = 64/sizeof(lane_type);
+            lane_type pattern[64/sizeof(lane_type)];
+            const lane_type *sp = reinterpret_cast<const lane_type*>(&s);
+            for(size_t i=0;i<np;++i) pattern[i] = sp[i%trait_type::lanes];
+
+            if(dispatch_type::pattern(reinterpret_cast<lane_type*>(a),
+                                      pattern,n*trait_type::lanes))
+                return;
+        }
+
+        for(size_t i=0;i<n;++i) OP::apply(a[i],s);
+    }
+
+//end of namespace
+}
+}
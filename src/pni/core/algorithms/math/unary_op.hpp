@@ -0,0 +1,500 @@
+//
+// (c) Copyright 2026 DESY, Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+// This file is part of libpnicore.
+//
+// libpnicore is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpnicore is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpnicore.  If not, see <http://www.gnu.org/licenses/>.
+//
+// ============================================================================
+//
+// Created on: Oct 16, 2026
+//     Author: Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+#pragma once
+
+#include <cmath>
+#include <complex>
+#include <type_traits>
+
+#include <pni/core/types/types.hpp>
+#include <pni/core/types/type_info.hpp>
+#include <pni/core/error/exceptions.hpp>
+#include <pni/core/algorithms/math/op_traits.hpp>
+#include <pni/core/utilities/container_iterator.hpp>
+
+namespace pni{
+namespace core{
+
+    template<typename ATYPE> class array_view;
+
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief result type of transcendental functions
+    //!
+    //! Integer arguments are promoted to float64, floating point and complex
+    //! arguments keep their type.
+    //!
+    //! \tparam T argument type
+    //!
+    template<typename T>
+    struct unary_float_type
+    {
+        //! result type
+        typedef typename std::conditional<std::is_integral<T>::value,
+                                          float64,T>::type type;
+    };
+
+    //=========================unary functions=================================
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief square root function
+    //!
+    struct unary_sqrt
+    {
+        //! result type for argument type T
+        template<typename T> struct result
+        {
+            //! result type
+            typedef typename unary_float_type<T>::type type;
+        };
+
+        //! compute the square root of v
+        template<typename T>
+        typename result<T>::type operator()(const T &v) const
+        {
+            typedef typename result<T>::type result_type;
+            return std::sqrt(result_type(v));
+        }
+    };
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief exponential function
+    //!
+    struct unary_exp
+    {
+        //! result type for argument type T
+        template<typename T> struct result
+        {
+            //! result type
+            typedef typename unary_float_type<T>::type type;
+        };
+
+        //! compute the exponential of v
+        template<typename T>
+        typename result<T>::type operator()(const T &v) const
+        {
+            typedef typename result<T>::type result_type;
+            return std::exp(result_type(v));
+        }
+    };
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief natural logarithm
+    //!
+    struct unary_log
+    {
+        //! result type for argument type T
+        template<typename T> struct result
+        {
+            //! result type
+            typedef typename unary_float_type<T>::type type;
+        };
+
+        //! compute the natural logarithm of v
+        template<typename T>
+        typename result<T>::type operator()(const T &v) const
+        {
+            typedef typename result<T>::type result_type;
+            return std::log(result_type(v));
+        }
+    };
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief power function
+    //!
+    //! Raises every element to a fixed exponent. The exponent has the
+    //! result type of the operation.
+    //!
+    //! \tparam E exponent type
+    //!
+    template<typename E>
+    struct unary_pow
+    {
+        //! the exponent
+        E exponent;
+
+        //! result type for argument type T
+        template<typename T> struct result
+        {
+            //! result type
+            typedef E type;
+        };
+
+        //! compute v to the power of exponent
+        template<typename T> E operator()(const T &v) const
+        {
+            return std::pow(E(v),exponent);
+        }
+    };
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief absolute value
+    //!
+    //! For complex numbers the result is the magnitude with the base type
+    //! of the complex type. For all other types the type is preserved.
+    //!
+    struct unary_abs
+    {
+        //! result type for argument type T
+        template<typename T> struct result
+        {
+            //! result type
+            typedef typename type_info<T>::base_type type;
+        };
+
+        //! absolute value of a real number
+        template<typename T> T operator()(const T &v) const
+        {
+            return type_info<T>::is_negative(v) ? T(-v) : v;
+        }
+
+        //! magnitude of a complex number
+        template<typename T> T operator()(const std::complex<T> &v) const
+        {
+            return std::abs(v);
+        }
+    };
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief clamp values to an interval
+    //!
+    //! \tparam T element type
+    //!
+    template<typename T>
+    struct unary_clamp
+    {
+        static_assert(!type_info<T>::is_complex,
+                      "complex numbers cannot be clamped!");
+
+        //! lower limit
+        T lower;
+        //! upper limit
+        T upper;
+
+        //! result type for argument type T
+        template<typename VT> struct result
+        {
+            //! result type
+            typedef T type;
+        };
+
+        //! clamp v to [lower,upper]
+        T operator()(const T &v) const
+        {
+            return v<lower ? lower : (upper<v ? upper : v);
+        }
+    };
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief complex conjugate
+    //!
+    //! For real numbers this is the identity.
+    //!
+    struct unary_conj
+    {
+        //! result type for argument type T
+        template<typename T> struct result
+        {
+            //! result type
+            typedef T type;
+        };
+
+        //! conjugate of a real number
+        template<typename T> T operator()(const T &v) const { return v; }
+
+        //! conjugate of a complex number
+        template<typename T>
+        std::complex<T> operator()(const std::complex<T> &v) const
+        {
+            return std::conj(v);
+        }
+    };
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief real part
+    //!
+    //! For real numbers this is the identity.
+    //!
+    struct unary_real
+    {
+        //! result type for argument type T
+        template<typename T> struct result
+        {
+            //! result type
+            typedef typename type_info<T>::base_type type;
+        };
+
+        //! real part of a real number
+        template<typename T> T operator()(const T &v) const { return v; }
+
+        //! real part of a complex number
+        template<typename T> T operator()(const std::complex<T> &v) const
+        {
+            return v.real();
+        }
+    };
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief imaginary part
+    //!
+    //! For real numbers the imaginary part is always 0.
+    //!
+    struct unary_imag
+    {
+        //! result type for argument type T
+        template<typename T> struct result
+        {
+            //! result type
+            typedef typename type_info<T>::base_type type;
+        };
+
+        //! imaginary part of a real number
+        template<typename T> T operator()(const T &) const { return T(0); }
+
+        //! imaginary part of a complex number
+        template<typename T> T operator()(const std::complex<T> &v) const
+        {
+            return v.imag();
+        }
+    };
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief squared magnitude
+    //!
+    //! Like std::norm this function computes the square of the absolute
+    //! value.
+    //!
+    struct unary_norm
+    {
+        //! result type for argument type T
+        template<typename T> struct result
+        {
+            //! result type
+            typedef typename type_info<T>::base_type type;
+        };
+
+        //! squared magnitude of a real number
+        template<typename T> T operator()(const T &v) const
+        {
+            return T(v*v);
+        }
+
+        //! squared magnitude of a complex number
+        template<typename T> T operator()(const std::complex<T> &v) const
+        {
+            return std::norm(v);
+        }
+    };
+
+    //=========================expression template=============================
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief unary expression template
+    //!
+    //! Applies a function to every element of its operand. Like the binary
+    //! expression templates the result is computed lazily on element
+    //! access so that for instance sqrt(a*a+b*b) requires no temporary
+    //! arrays.
+    //!
+    //! \tparam OPT type of the operand
+    //! \tparam FUNCT function type
+    //!
+    template<
+             typename OPT,
+             typename FUNCT
+            >
+    class unary_op
+    {
+        private:
+            //! reference to the operand
+            typename op_trait<OPT>::ref_type _op;
+            //! the function
+            FUNCT _func;
+        public:
+            //--------------------public types---------------------------------
+            //! result type of the operation
+            typedef typename FUNCT::template
+                    result<typename OPT::value_type>::type value_type;
+            //! type of the expression template
+            typedef unary_op<OPT,FUNCT> array_type;
+            //! storage type
+            typedef void storage_type;
+            //! non-const iterator type - just for interface
+            typedef container_iterator<array_type> iterator;
+            //! const iterator type
+            typedef container_iterator<const array_type> const_iterator;
+
+            //! reverse iterator type
+            typedef container_iterator<array_type> reverse_iterator;
+            //! const reverse iterator type
+            typedef container_iterator<const array_type> const_reverse_iterator;
+            //! view type
+            typedef array_view<array_type> view_type;
+
+            //! index map type
+            typedef typename OPT::map_type map_type;
+            //! inplace arithmetic type
+            typedef typename OPT::inplace_arithmetic inplace_arithmetic;
+
+            //===================constructors==================================
+            //!
+            //! \brief constructor
+            //!
+            //! \param o operand
+            //! \param f function instance
+            //!
+            unary_op(const OPT &o,const FUNCT &f = FUNCT()):
+                _op(o),
+                _func(f)
+            { }
+
+            //====================public methods===============================
+            //!
+            //! \brief get result at i
+            //!
+            //! Return the result of f(a[i]).
+            //! \param i index at which to perform the operation
+            //! \return result of the operation
+            //!
+            value_type operator[](size_t i) const
+            {
+                return _func(_op[i]);
+            }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief get result at i
+            //!
+            //! \throws index_error if i>=size()
+            //! \param i index for which to compute the result
+            //! \return result of operation
+            //!
+            value_type at(size_t i) const
+            {
+                if(i>=size())
+                    throw index_error(EXCEPTION_RECORD,"array index exceeded!");
+
+                return (*this)[i];
+            }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief get size
+            //!
+            //! \return number of elements of result
+            //!
+            size_t size() const { return _op.size(); }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief get rank
+            //!
+            //! \return number of dimensions of the result
+            //!
+            size_t rank() const { return _op.rank(); }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief get shape
+            //!
+            //! \tparam CTYPE container type for the shape
+            //! \return shape of the result
+            //!
+            template<typename CTYPE> CTYPE shape() const
+            {
+                return _op.template shape<CTYPE>();
+            }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief get operand
+            //!
+            const OPT &operand() const { return _op; }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief get function
+            //!
+            const FUNCT &function() const { return _func; }
+
+            //=====================iterators===================================
+            //!
+            //! \brief get const iterator to the first element
+            //!
+            const_iterator begin() const
+            {
+                return const_iterator(this,0);
+            }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief get const iterator to last+1 element
+            //!
+            const_iterator end() const
+            {
+                return const_iterator(this,this->size());
+            }
+
+    };
+
+    //! \cond NO_API_DOC
+    template<typename OPT> using sqrt_op = unary_op<OPT,unary_sqrt>;
+    template<typename OPT> using exp_op  = unary_op<OPT,unary_exp>;
+    template<typename OPT> using log_op  = unary_op<OPT,unary_log>;
+    template<typename OPT> using abs_op  = unary_op<OPT,unary_abs>;
+    template<typename OPT> using conj_op = unary_op<OPT,unary_conj>;
+    template<typename OPT> using real_op = unary_op<OPT,unary_real>;
+    template<typename OPT> using imag_op = unary_op<OPT,unary_imag>;
+    template<typename OPT> using norm_op = unary_op<OPT,unary_norm>;
+
+    template<typename OPT>
+    using pow_op = unary_op<OPT,unary_pow<typename
+                            unary_float_type<typename OPT::value_type>::type>>;
+
+    template<typename OPT>
+    using clamp_op = unary_op<OPT,unary_clamp<typename OPT::value_type>>;
+    //! \endcond
+
+
+//end of namespace
+}
+}
@@ -0,0 +1,540 @@
+//
+// (c) Copyright 2026 DESY, Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+// This file is part of libpnicore.
+//
+// libpnicore is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpnicore is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpnicore.  If not, see <http://www.gnu.org/licenses/>.
+//
+// ============================================================================
+//
+// Created on: Oct 16, 2026
+//     Author: Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+#pragma once
+
+#include <vector>
+#include <sstream>
+#include <algorithm>
+#include <type_traits>
+
+#include <pni/core/types.hpp>
+#include <pni/core/error/exceptions.hpp>
+#include <pni/core/arrays.hpp>
+#include <pni/core/algorithms/reductions/reduction_ops.hpp>
+#include <pni/core/algorithms/reductions/reduction_engine.hpp>
+
+namespace pni{
+namespace core{
+
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief pointer to contiguous array data
+    //!
+    //! Arrays with contiguous storage are used in place. 
+    //!
+    template<typename ATYPE>
+    const typename ATYPE::value_type *
+    reduction_data(const ATYPE &a,std::vector<typename ATYPE::value_type> &,
+                   std::true_type)
+    {
+        return a.data();
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief pointer to array data
+    //!
+    //! All other types (for instance expression templates) are evaluated 
+    //! into a buffer.
+    //!
+    template<typename ATYPE>
+    const typename ATYPE::value_type *
+    reduction_data(const ATYPE &a,
+                   std::vector<typename ATYPE::value_type> &buffer,
+                   std::false_type)
+    {
+        buffer.resize(a.size());
+        for(size_t i=0;i<buffer.size();++i) buffer[i] = a[i];
+        return buffer.data();
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief pointer to the data of an array 
+    //!
+    //! Returns a pointer to the data of a in the storage order of its index
+    //! map. If a has no contiguous storage the data is copied to buffer.
+    //!
+    //! \tparam ATYPE array type
+    //! \param a reference to the array
+    //! \param buffer buffer for the data
+    //! \return pointer to the first element
+    //!
+    template<typename ATYPE>
+    const typename ATYPE::value_type *
+    reduction_data(const ATYPE &a,std::vector<typename ATYPE::value_type> &buffer)
+    {
+        typedef container_trait<ATYPE> trait_type;
+        return reduction_data(a,buffer,
+                   std::integral_constant<bool,trait_type::is_contiguous>());
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief pointer to the data of a view
+    //!
+    //! Non-contiguous views are copied run by run in the storage order of 
+    //! the parent array.
+    //!
+    template<typename ATYPE>
+    const typename ATYPE::value_type *
+    reduction_data(const array_view<ATYPE> &a,
+                   std::vector<typename ATYPE::value_type> &buffer)
+    {
+        typedef typename ATYPE::value_type value_type;
+        if(a.is_contiguous()) return a.data();
+
+        buffer.resize(a.size());
+        value_type *dest = buffer.data();
+        for_each_contiguous_run(a,[&dest](const value_type *ptr,size_t n)
+        {
+            dest = std::copy(ptr,ptr+n,dest);
+        });
+        return buffer.data();
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief store the results of an axis reduction
+    //!
+    //! The accumulators follow the storage order of the input array. They 
+    //! are written to the C-ordered result by index.
+    //!
+    //! \tparam OP reduction operation
+    //! \tparam IMPT index map implementation of the input
+    //! \tparam RTYPE result array type
+    //! \param accumulators reduction results in storage order
+    //! \param result the result array
+    //!
+    template<
+             typename OP,
+             typename IMPT,
+             typename RTYPE
+            >
+    void store_reduction(const std::vector<typename OP::reduction_type> 
+                         &accumulators,RTYPE &result,std::false_type)
+    {
+        auto shape = result.template shape<shape_t>();
+        shape_t index(shape.size());
+        for(size_t i=0;i<accumulators.size();++i)
+        {
+            IMPT::index(shape,index,i);
+            result(index) = OP::result(accumulators[i]);
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief store the results of an axis reduction
+    //!
+    //! For C-ordered input the accumulators are already in the order of the
+    //! result.
+    //!
+    template<
+             typename OP,
+             typename IMPT,
+             typename RTYPE
+            >
+    void store_reduction(const std::vector<typename OP::reduction_type> 
+                         &accumulators,RTYPE &result,std::true_type)
+    {
+        std::transform(accumulators.begin(),accumulators.end(),result.begin(),
+                       [](const typename OP::reduction_type &v) 
+                       { return OP::result(v); });
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief convert a linear index to C-order
+    //!
+    //! Converts a linear index in the storage order of IMPT to the linear 
+    //! index of the same element in C-order.
+    //!
+    //! \tparam IMPT index map implementation
+    //! \param shape the shape of the array
+    //! \param offset linear index in storage order
+    //! \return linear index in C-order
+    //!
+    template<typename IMPT>
+    size_t c_order_index(const shape_t &shape,size_t offset,IMPT)
+    {
+        if(shape.empty()) return offset;
+
+        shape_t index(shape.size());
+        IMPT::index(shape,index,offset);
+        return c_index_map_imp::offset(shape,index);
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief convert a linear index to C-order
+    //!
+    //! Nothing to do for C-ordered arrays.
+    //!
+    inline size_t c_order_index(const shape_t &,size_t offset,c_index_map_imp)
+    {
+        return offset;
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief reduce all elements
+    //!
+    //! \tparam OP reduction operation
+    //! \tparam ATYPE array type
+    //! \param a array to reduce
+    //! \return accumulator 
+    //!
+    template<
+             typename OP,
+             typename ATYPE
+            >
+    typename OP::reduction_type reduce_all(const ATYPE &a)
+    {
+        typedef typename ATYPE::value_type value_type;
+
+        std::vector<value_type> buffer;
+        const value_type *data = reduction_data(a,buffer);
+        reduction_layout layout(shape_t{a.size()},std::vector<bool>{true});
+
+        typename OP::reduction_type result;
+        reduction_engine<OP,value_type>(data,layout)(&result);
+        return result;
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief reduce along axes
+    //!
+    //! Reduces an array along the given axes. The result has the shape of 
+    //! the input without the reduced axes. If all axes are reduced the 
+    //! result has shape (1). The data is reduced in the storage order of 
+    //! the input array, the result is always C-ordered.
+    //! 
+    //! \throws index_error if an axis exceeds the rank of the array
+    //! \tparam OP reduction operation 
+    //! \tparam ATYPE array type 
+    //! \param a array to reduce
+    //! \param axes axes along which to reduce
+    //! \param count returns the number of elements reduced for every output
+    //! \return array with the results 
+    //!
+    template<
+             typename OP,
+             typename ATYPE
+            >
+    dynamic_array<typename OP::result_type> 
+    reduce_axes(const ATYPE &a,const shape_t &axes,size_t &count)
+    {
+        typedef typename ATYPE::value_type value_type;
+        typedef typename OP::reduction_type reduction_type;
+        typedef typename ATYPE::map_type::implementation_type 
+                implementation_type;
+        typedef dynamic_array<typename OP::result_type> result_type;
+
+        auto shape = a.template shape<shape_t>();
+        std::vector<bool> reduced(shape.size(),false);
+        for(auto axis: axes)
+        {
+            if(axis>=shape.size())
+            {
+                std::stringstream ss;
+                ss<<"Reduction axis "<<axis<<" exceeds array rank ";
+                ss<<shape.size()<<"!";
+                throw index_error(EXCEPTION_RECORD,ss.str());
+            }
+            reduced[axis] = true;
+        }
+
+        shape_t result_shape;
+        count = 1;
+        for(size_t d=0;d<shape.size();++d)
+            if(reduced[d]) count *= shape[d];
+            else result_shape.push_back(shape[d]);
+        if(result_shape.empty()) result_shape.push_back(1);
+
+        std::vector<value_type> buffer;
+        const value_type *data = reduction_data(a,buffer);
+        reduction_layout layout(implementation_type::linear_order(shape),
+                                implementation_type::linear_order(reduced));
+
+        std::vector<reduction_type> accumulators(layout.size());
+        reduction_engine<OP,value_type>(data,layout)(accumulators.data());
+
+        auto result = result_type::create(result_shape);
+        store_reduction<OP,implementation_type>(accumulators,result,
+                std::is_same<implementation_type,c_index_map_imp>());
+        return result;
+    }
+
+    //=========================================================================
+    //!
+    //! \ingroup mdim_array_classes
+    //! \brief sum of all elements
+    //!
+    //! Floating point and complex sums use pairwise summation. Integers are
+    //! summed up in 64Bit integers. 
+    //!
+    /*!
+    \code
+    auto stack = dynamic_array<float32>::create(shape_t{100,2048,2048});
+    //...
+    auto total = sum(stack);
+    auto frame_sum = sum(stack,{0});   //shape (2048,2048)
+    auto counts = sum(stack,{1,2});    //shape (100)
+    \endcode
+    !*/
+    //!
+    //! \tparam ATYPE array, view, or expression type
+    //! \param a input data
+    //! \return sum of all elements
+    //!
+    template<typename ATYPE>
+    typename sum_trait<typename ATYPE::value_type>::type sum(const ATYPE &a)
+    {
+        return reduce_all<sum_reduction<typename ATYPE::value_type>>(a);
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_classes
+    //! \brief sum along axes
+    //!
+    //! \throws index_error if an axis exceeds the rank of the array
+    //! \tparam ATYPE array, view, or expression type
+    //! \param a input data
+    //! \param axes axes along which to sum
+    //! \return array with the reduced shape 
+    //!
+    template<typename ATYPE>
+    dynamic_array<typename sum_trait<typename ATYPE::value_type>::type> 
+    sum(const ATYPE &a,const shape_t &axes)
+    {
+        size_t count;
+        return reduce_axes<sum_reduction<typename ATYPE::value_type>>(a,axes,
+                                                                      count);
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_classes
+    //! \brief mean of all elements
+    //!
+    //! The mean of integer arrays is a float64 value. 
+    //!
+    //! \tparam ATYPE array, view, or expression type
+    //! \param a input data
+    //! \return mean value
+    //!
+    template<typename ATYPE>
+    typename mean_trait<typename ATYPE::value_type>::type mean(const ATYPE &a)
+    {
+        typedef typename ATYPE::value_type value_type;
+        typedef typename mean_trait<value_type>::type result_type;
+        typedef sum_reduction<value_type,result_type> op_type;
+
+        return reduce_all<op_type>(a)/result_type(a.size());
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_classes
+    //! \brief mean along axes
+    //!
+    //! \throws index_error if an axis exceeds the rank of the array
+    //! \tparam ATYPE array, view, or expression type
+    //! \param a input data
+    //! \param axes axes along which to compute the mean
+    //! \return array with the reduced shape
+    //!
+    template<typename ATYPE>
+    dynamic_array<typename mean_trait<typename ATYPE::value_type>::type> 
+    mean(const ATYPE &a,const shape_t &axes)
+    {
+        typedef typename ATYPE::value_type value_type;
+        typedef typename mean_trait<value_type>::type result_type;
+        typedef sum_reduction<value_type,result_type> op_type;
+
+        size_t count;
+        auto result = reduce_axes<op_type>(a,axes,count);
+        for(auto &v: result) v /= result_type(count);
+        return result;
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_classes
+    //! \brief minimum of all elements
+    //!
+    //! This function does not work for complex numbers as there is no 
+    //! order relation for them.
+    //!
+    //! \throws size_mismatch_error if the array is empty
+    //! \tparam ATYPE array, view, or expression type
+    //! \param a input data
+    //! \return minimum value
+    //!
+    template<typename ATYPE>
+    typename ATYPE::value_type min(const ATYPE &a)
+    {
+        return reduce_all<min_reduction<typename ATYPE::value_type>>(a);
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_classes
+    //! \brief minimum along axes
+    //!
+    //! \throws index_error if an axis exceeds the rank of the array
+    //! \throws size_mismatch_error if an axis has no elements
+    //! \tparam ATYPE array, view, or expression type
+    //! \param a input data
+    //! \param axes axes along which to search 
+    //! \return array with the reduced shape
+    //!
+    template<typename ATYPE>
+    dynamic_array<typename ATYPE::value_type> 
+    min(const ATYPE &a,const shape_t &axes)
+    {
+        size_t count;
+        return reduce_axes<min_reduction<typename ATYPE::value_type>>(a,axes,
+                                                                      count);
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_classes
+    //! \brief maximum of all elements
+    //!
+    //! This function does not work for complex numbers as there is no 
+    //! order relation for them.
+    //!
+    //! \throws size_mismatch_error if the array is empty
+    //! \tparam ATYPE array, view, or expression type
+    //! \param a input data
+    //! \return maximum value
+    //!
+    template<typename ATYPE>
+    typename ATYPE::value_type max(const ATYPE &a)
+    {
+        return reduce_all<max_reduction<typename ATYPE::value_type>>(a);
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_classes
+    //! \brief maximum along axes
+    //!
+    //! \throws index_error if an axis exceeds the rank of the array
+    //! \throws size_mismatch_error if an axis has no elements
+    //! \tparam ATYPE array, view, or expression type
+    //! \param a input data
+    //! \param axes axes along which to search
+    //! \return array with the reduced shape
+    //!
+    template<typename ATYPE>
+    dynamic_array<typename ATYPE::value_type> 
+    max(const ATYPE &a,const shape_t &axes)
+    {
+        size_t count;
+        return reduce_axes<max_reduction<typename ATYPE::value_type>>(a,axes,
+                                                                      count);
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_classes
+    //! \brief linear index of the maximum
+    //!
+    //! Returns the linear index (C-order) of the first occurrence of the 
+    //! maximum value. For arrays with a different storage order the first 
+    //! occurrence in storage order is taken.
+    //!
+    //! \throws size_mismatch_error if the array is empty
+    //! \tparam ATYPE array, view, or expression type
+    //! \param a input data
+    //! \return linear index of the maximum
+    //!
+    template<typename ATYPE>
+    size_t argmax(const ATYPE &a)
+    {
+        typedef argmax_reduction<typename ATYPE::value_type> op_type;
+        typedef typename ATYPE::map_type::implementation_type 
+                implementation_type;
+
+        return c_order_index(a.template shape<shape_t>(),
+                             op_type::result(reduce_all<op_type>(a)),
+                             implementation_type());
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_classes
+    //! \brief index of the maximum along axes
+    //!
+    //! For every element of the result the linear index (C-order) of the 
+    //! maximum within the reduced axes is returned. For a single axis this
+    //! is the index along this axis.
+    //!
+    //! \throws index_error if an axis exceeds the rank of the array
+    //! \throws size_mismatch_error if an axis has no elements
+    //! \tparam ATYPE array, view, or expression type
+    //! \param a input data
+    //! \param axes axes along which to search
+    //! \return array with the reduced shape
+    //!
+    template<typename ATYPE>
+    dynamic_array<size_t> argmax(const ATYPE &a,const shape_t &axes)
+    {
+        typedef typename ATYPE::map_type::implementation_type 
+                implementation_type;
+
+        size_t count;
+        auto result = reduce_axes<argmax_reduction<typename ATYPE::value_type>>(
+                                                              a,axes,count);
+
+        //the indices refer to the reduced axes in storage order
+        auto shape = a.template shape<shape_t>();
+        shape_t reduced_shape;
+        for(size_t d=0;d<shape.size();++d)
+            if(std::find(axes.begin(),axes.end(),d)!=axes.end()) 
+                reduced_shape.push_back(shape[d]);
+
+        for(auto &index: result)
+            index = c_order_index(reduced_shape,index,implementation_type());
+        return result;
+    }
+
+//end of namespace
+}
+}
@@ -0,0 +1,440 @@
+//
+// (c) Copyright 2026 DESY, Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+// This file is part of libpnicore.
+//
+// libpnicore is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpnicore is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpnicore.  If not, see <http://www.gnu.org/licenses/>.
+//
+// ============================================================================
+//
+// Created on: Oct 16, 2026
+//     Author: Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+#pragma once
+
+#include <vector>
+#include <algorithm>
+
+#include <pni/core/types.hpp>
+#include <pni/core/utilities/thread_pool.hpp>
+
+namespace pni{
+namespace core{
+
+    //! minimum number of elements processed by a single task
+    const size_t reduction_grain = size_t(1)<<16;
+
+    //! number of columns processed at once when reducing outer dimensions
+    const size_t reduction_block = 1024;
+
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief memory layout of a reduction
+    //!
+    //! Describes the reduction of a C-ordered contiguous block of memory 
+    //! along a set of dimensions. Adjacent dimensions which are either both
+    //! reduced or both kept are merged and dimensions with a single element
+    //! are dropped. The innermost of the merged dimensions (stride 1) is 
+    //! stored separately as it is processed by the vectorized kernels:
+    //!
+    //! \li if it is reduced every output element is computed from rows() 
+    //! contiguous blocks of inner elements
+    //! \li if it is kept every block of inner output elements is computed 
+    //! from rows() contiguous blocks of inner input elements
+    //!
+    struct reduction_layout
+    {
+        //! shape of the kept dimensions without the inner one
+        shape_t outer_shape;
+        //! strides of the kept dimensions without the inner one
+        shape_t outer_strides;
+        //! shape of the reduced dimensions without the inner one
+        shape_t row_shape;
+        //! strides of the reduced dimensions without the inner one
+        shape_t row_strides;
+        //! number of elements along the innermost dimension
+        size_t inner;
+        //! true if the innermost dimension is reduced
+        bool inner_reduced;
+
+        //---------------------------------------------------------------------
+        //!
+        //! \brief constructor
+        //!
+        //! \param shape shape of the data
+        //! \param reduced flags for each dimension, true if reduced
+        //!
+        reduction_layout(const shape_t &shape,const std::vector<bool> &reduced):
+            outer_shape(),
+            outer_strides(),
+            row_shape(),
+            row_strides(),
+            inner(1),
+            inner_reduced(true)
+        {
+            //merged dimensions from the innermost to the outermost
+            std::vector<size_t> sizes,strides;
+            std::vector<bool> kinds;
+            size_t stride = 1;
+            for(size_t d=shape.size();d!=0;--d)
+            {
+                size_t n = shape[d-1];
+                if(n==1) continue;
+
+                if(!kinds.empty() && kinds.back()==reduced[d-1])
+                    sizes.back() *= n;
+                else
+                {
+                    sizes.push_back(n);
+                    strides.push_back(stride);
+                    kinds.push_back(reduced[d-1]);
+                }
+                stride *= n;
+            }
+
+            if(sizes.empty()) return;
+
+            inner         = sizes.front();
+            inner_reduced = kinds.front();
+            for(size_t i=sizes.size()-1;i!=0;--i)
+            {
+                if(kinds[i])
+                {
+                    row_shape.push_back(sizes[i]);
+                    row_strides.push_back(strides[i]);
+                }
+                else
+                {
+                    outer_shape.push_back(sizes[i]);
+                    outer_strides.push_back(strides[i]);
+                }
+            }
+        }
+
+        //---------------------------------------------------------------------
+        //!
+        //! \brief compute memory offset
+        //!
+        //! \param shape shape of the dimensions
+        //! \param strides strides of the dimensions
+        //! \param i linear index (C-order) within the dimensions
+        //! \return offset in memory
+        //!
+        static size_t offset(const shape_t &shape,const shape_t &strides,
+                             size_t i)
+        {
+            size_t offset = 0;
+            for(size_t d=shape.size();d!=0;--d)
+            {
+                offset += (i%shape[d-1])*strides[d-1];
+                i /= shape[d-1];
+            }
+            return offset;
+        }
+
+        //---------------------------------------------------------------------
+        //! memory offset of the k-th output block
+        size_t output_offset(size_t k) const 
+        { 
+            return offset(outer_shape,outer_strides,k);
+        }
+
+        //---------------------------------------------------------------------
+        //! memory offset of the r-th row
+        size_t row_offset(size_t r) const
+        {
+            return offset(row_shape,row_strides,r);
+        }
+
+        //---------------------------------------------------------------------
+        //! number of output blocks
+        size_t outputs() const
+        {
+            size_t n = 1;
+            for(auto s: outer_shape) n*=s;
+            return n;
+        }
+
+        //---------------------------------------------------------------------
+        //! number of rows reduced for each output block
+        size_t rows() const
+        {
+            size_t n = 1;
+            for(auto s: row_shape) n*=s;
+            return n;
+        }
+        
+        //---------------------------------------------------------------------
+        //! total number of output elements
+        size_t size() const
+        {
+            return inner_reduced ? outputs() : outputs()*inner;
+        }
+    };
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief reduction engine
+    //!
+    //! Reduces a contiguous block of memory according to a 
+    //! reduction_layout. Partial results are combined pairwise. The work 
+    //! is split into tasks of at least reduction_grain elements which are 
+    //! distributed over the library thread pool. The splitting depends 
+    //! only on the layout and not on the number of threads so results are
+    //! reproducible.
+    //!
+    //! \tparam OP reduction operation
+    //! \tparam T element type
+    //!
+    template<
+             typename OP,
+             typename T
+            >
+    class reduction_engine
+    {
+        public:
+            //! accumulator type
+            typedef typename OP::reduction_type reduction_type;
+        private:
+            //! pointer to the data
+            const T *_data;
+            //! layout of the reduction
+            const reduction_layout &_layout;
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief reduce rows with an inner reduced dimension
+            //!
+            //! Reduces the elements [first,last) of a row range [lo,hi) 
+            //! pairwise. 
+            //!
+            reduction_type _reduce_rows(size_t offset,size_t lo,size_t hi,
+                                        size_t first,size_t last) const
+            {
+                if(hi-lo==1)
+                    return OP::reduce(_data+offset+_layout.row_offset(lo)+first,
+                                      last-first,lo*_layout.inner+first);
+
+                size_t mid = lo+(hi-lo)/2;
+                reduction_type result = _reduce_rows(offset,lo,mid,first,last);
+                OP::combine(result,_reduce_rows(offset,mid,hi,first,last));
+                return result;
+            }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief reduce rows with an inner kept dimension
+            //!
+            //! Reduces n columns of the row range [lo,hi) pairwise into 
+            //! dest.
+            //!
+            void _reduce_columns(reduction_type *dest,size_t offset,size_t n,
+                                 size_t lo,size_t hi) const
+            {
+                if(hi-lo>8)
+                {
+                    size_t mid = lo+(hi-lo)/2;
+                    std::vector<reduction_type> buffer(n);
+                    _reduce_columns(dest,offset,n,lo,mid);
+                    _reduce_columns(buffer.data(),offset,n,mid,hi);
+                    OP::combine(dest,buffer.data(),n);
+                    return;
+                }
+
+                OP::assign(dest,_data+offset+_layout.row_offset(lo),n,lo);
+                for(size_t r=lo+1;r<hi;++r)
+                    OP::accumulate(dest,_data+offset+_layout.row_offset(r),n,r);
+            }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief combine partial results pairwise
+            //!
+            static reduction_type _combine(const reduction_type *p,size_t n)
+            {
+                if(n==1) return p[0];
+
+                reduction_type result = _combine(p,n/2);
+                OP::combine(result,_combine(p+n/2,n-n/2));
+                return result;
+            }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief reduce a single output with several tasks
+            //!
+            //! Splits the reduction of a large output element either along 
+            //! the rows or along the inner dimension.
+            //!
+            reduction_type _reduce_split(size_t k) const
+            {
+                size_t offset = _layout.output_offset(k);
+                size_t rows   = _layout.rows();
+                size_t inner  = _layout.inner;
+                std::vector<reduction_type> partials;
+
+                if(rows==1)
+                {
+                    size_t chunk = reduction_grain;
+                    partials.resize((inner+chunk-1)/chunk);
+                    parallel_for(partials.size(),1,
+                    [&](size_t begin,size_t end)
+                    {
+                        for(size_t c=begin;c<end;++c)
+                            partials[c] = _reduce_rows(offset,0,1,c*chunk,
+                                                std::min(inner,(c+1)*chunk));
+                    });
+                }
+                else
+                {
+                    size_t chunk = std::max(size_t(1),reduction_grain/inner);
+                    partials.resize((rows+chunk-1)/chunk);
+                    parallel_for(partials.size(),1,
+                    [&](size_t begin,size_t end)
+                    {
+                        for(size_t c=begin;c<end;++c)
+                            partials[c] = _reduce_rows(offset,c*chunk,
+                                                std::min(rows,(c+1)*chunk),
+                                                0,inner);
+                    });
+                }
+
+                return _combine(partials.data(),partials.size());
+            }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief reduce a block of columns with several tasks
+            //!
+            //! Splits the rows of a block of columns in chunks which are 
+            //! reduced in parallel. The partial results are combined in 
+            //! order.
+            //!
+            void _reduce_columns_split(reduction_type *dest,size_t offset,
+                                       size_t n) const
+            {
+                size_t rows  = _layout.rows();
+                size_t chunk = std::max(size_t(8),reduction_grain/n);
+                size_t chunks = (rows+chunk-1)/chunk;
+                std::vector<std::vector<reduction_type>> partials(chunks);
+
+                parallel_for(chunks,1,[&](size_t begin,size_t end)
+                {
+                    for(size_t c=begin;c<end;++c)
+                    {
+                        partials[c].resize(n);
+                        _reduce_columns(partials[c].data(),offset,n,c*chunk,
+                                        std::min(rows,(c+1)*chunk));
+                    }
+                });
+
+                std::copy(partials[0].begin(),partials[0].end(),dest);
+                for(size_t c=1;c<chunks;++c)
+                    OP::combine(dest,partials[c].data(),n);
+            }
+
+        public:
+            //-----------------------------------------------------------------
+            //!
+            //! \brief constructor
+            //!
+            //! \param data pointer to the first element 
+            //! \param layout reduction layout
+            //!
+            reduction_engine(const T *data,const reduction_layout &layout):
+                _data(data),
+                _layout(layout)
+            {}
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief run the reduction
+            //!
+            //! \param result pointer to layout.size() accumulators
+            //!
+            void operator()(reduction_type *result) const
+            {
+                size_t outputs = _layout.outputs();
+                size_t rows    = _layout.rows();
+                size_t inner   = _layout.inner;
+
+                if(_layout.size()==0) return;
+                if(rows==0 || (_layout.inner_reduced && inner==0))
+                {
+                    std::fill(result,result+_layout.size(),OP::empty());
+                    return;
+                }
+
+                size_t work = rows*inner;
+                if(_layout.inner_reduced)
+                {
+                    //a few large outputs - split every output
+                    if(outputs<16 && work>=2*reduction_grain)
+                    {
+                        for(size_t k=0;k<outputs;++k) 
+                            result[k] = _reduce_split(k);
+                        return;
+                    }
+
+                    parallel_for(outputs,
+                                 std::max(size_t(1),reduction_grain/work),
+                    [&](size_t begin,size_t end)
+                    {
+                        for(size_t k=begin;k<end;++k)
+                            result[k] = _reduce_rows(_layout.output_offset(k),
+                                                     0,rows,0,inner);
+                    });
+                }
+                else
+                {
+                    //tasks are blocks of columns of an output block
+                    size_t blocks = (inner+reduction_block-1)/reduction_block;
+                    size_t block_work = rows*std::min(inner,reduction_block);
+
+                    //a few large blocks - split the rows
+                    if(outputs*blocks<16 && block_work>=2*reduction_grain)
+                    {
+                        for(size_t t=0;t<outputs*blocks;++t)
+                        {
+                            size_t k = t/blocks;
+                            size_t first = (t%blocks)*reduction_block;
+                            _reduce_columns_split(result+k*inner+first,
+                                        _layout.output_offset(k)+first,
+                                        std::min(inner-first,reduction_block));
+                        }
+                        return;
+                    }
+
+                    parallel_for(outputs*blocks,
+                                 std::max(size_t(1),reduction_grain/block_work),
+                    [&](size_t begin,size_t end)
+                    {
+                        for(size_t t=begin;t<end;++t)
+                        {
+                            size_t k = t/blocks;
+                            size_t first = (t%blocks)*reduction_block;
+                            size_t n = std::min(inner-first,reduction_block);
+                            _reduce_columns(result+k*inner+first,
+                                            _layout.output_offset(k)+first,
+                                            n,0,rows);
+                        }
+                    });
+                }
+            }
+    };
+
+//end of namespace
+}
+}
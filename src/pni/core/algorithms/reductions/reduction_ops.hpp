@@ -0,0 +1,358 @@
+//
+// (c) Copyright 2026 DESY, Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+// This file is part of libpnicore.
+//
+// libpnicore is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpnicore is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpnicore.  If not, see <http://www.gnu.org/licenses/>.
+//
+// ============================================================================
+//
+// Created on: Oct 16, 2026
+//     Author: Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+#pragma once
+
+#include <utility>
+#include <algorithm>
+#include <functional>
+#include <type_traits>
+
+#include <pni/core/types.hpp>
+#include <pni/core/utilities/sfinae_macros.hpp>
+#include <pni/core/error/exceptions.hpp>
+
+namespace pni{
+namespace core{
+
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief accumulator type for sums
+    //!
+    //! Integer sums are accumulated in 64Bit integers of the same 
+    //! signedness. Floating point and complex sums use the element type.
+    //!
+    //! \tparam T element type
+    //!
+    template<
+             typename T,
+             bool is_int = std::is_integral<T>::value,
+             bool is_signed = std::is_signed<T>::value
+            >
+    struct sum_trait
+    {
+        //! accumulator type
+        typedef T type;
+    };
+
+    //! \cond NO_API_DOC
+    template<typename T> struct sum_trait<T,true,true> 
+    { 
+        typedef int64 type; 
+    };
+
+    template<typename T> struct sum_trait<T,true,false> 
+    { 
+        typedef uint64 type; 
+    };
+    //! \endcond
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief result type of a mean
+    //!
+    //! The mean of an integer array is a 64Bit float. For all other types 
+    //! the element type is used.
+    //!
+    //! \tparam T element type
+    //!
+    template<
+             typename T,
+             bool is_int = std::is_integral<T>::value
+            >
+    struct mean_trait
+    {
+        //! result type
+        typedef T type;
+    };
+
+    //! \cond NO_API_DOC
+    template<typename T> struct mean_trait<T,true>
+    {
+        typedef float64 type;
+    };
+    //! \endcond
+
+    //! number of elements below which pairwise summation stops recursing
+    const size_t pairwise_block = 128;
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief pairwise summation
+    //!
+    //! Sums up n elements by recursively splitting the range in halves. 
+    //! The rounding error grows with O(log n) instead of O(n) for the naive 
+    //! loop. Blocks of up to pairwise_block elements are summed with eight 
+    //! independent accumulators which the compiler maps to vector lanes.
+    //!
+    //! \tparam R accumulator type
+    //! \tparam T element type
+    //! \param p pointer to the first element
+    //! \param n number of elements
+    //! \return sum of the elements
+    //!
+    template<
+             typename R,
+             typename T
+            >
+    R pairwise_sum(const T *p,size_t n)
+    {
+        if(n>pairwise_block)
+        {
+            size_t m = (n/2)&~size_t(7);
+            return pairwise_sum<R>(p,m)+pairwise_sum<R>(p+m,n-m);
+        }
+
+        R acc[8] = {R(),R(),R(),R(),R(),R(),R(),R()};
+        size_t i=0;
+        for(;i+8<=n;i+=8)
+            for(size_t k=0;k<8;++k) acc[k] += R(p[i+k]);
+
+        R result = ((acc[0]+acc[1])+(acc[2]+acc[3]))+
+                   ((acc[4]+acc[5])+(acc[6]+acc[7]));
+        for(;i<n;++i) result += R(p[i]);
+        return result;
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief sum reduction 
+    //!
+    //! Reduction operations provide the kernels used by the reduction 
+    //! engine. The engine calls them on contiguous blocks of memory. 
+    //! The index arguments are the linear index of the first element of 
+    //! the block within the reduced dimensions (only used by argmax_reduction).
+    //!
+    //! \tparam T element type
+    //! \tparam R accumulator type
+    //!
+    template<
+             typename T,
+             typename R = typename sum_trait<T>::type
+            >
+    struct sum_reduction
+    {
+        //! accumulator type
+        typedef R reduction_type;
+        //! result type
+        typedef R result_type;
+
+        //! result for an empty reduction
+        static R empty() { return R(); }
+
+        //! reduce a block of n elements
+        static R reduce(const T *p,size_t n,size_t)
+        {
+            return pairwise_sum<R>(p,n);
+        }
+
+        //! combine two partial results
+        static void combine(R &a,const R &b) { a += b; }
+
+        //! initialize n accumulators
+        static void assign(R *a,const T *p,size_t n,size_t)
+        {
+            for(size_t i=0;i<n;++i) a[i] = R(p[i]);
+        }
+
+        //! add n elements to n accumulators
+        static void accumulate(R *a,const T *p,size_t n,size_t)
+        {
+            for(size_t i=0;i<n;++i) a[i] += R(p[i]);
+        }
+
+        //! combine n partial results
+        static void combine(R *a,const R *b,size_t n)
+        {
+            for(size_t i=0;i<n;++i) a[i] += b[i];
+        }
+
+        //! get the result from the accumulator
+        static R result(const R &a) { return a; }
+    };
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief minimum and maximum reduction
+    //!
+    //! \tparam T element type
+    //! \tparam COMP comparison selecting the new value (std::less for the 
+    //!              minimum, std::greater for the maximum)
+    //!
+    template<
+             typename T,
+             typename COMP
+            >
+    struct extremum_reduction
+    {
+        static_assert(!is_complex_type<T>::value,
+                      "Complex numbers have no order relation!");
+
+        //! accumulator type
+        typedef T reduction_type;
+        //! result type
+        typedef T result_type;
+
+        //! an empty reduction has no extremum
+        static T empty()
+        {
+            throw size_mismatch_error(EXCEPTION_RECORD,
+                    "Cannot compute the extremum of an empty array!");
+        }
+
+        //! reduce a block of n elements
+        static T reduce(const T *p,size_t n,size_t)
+        {
+            COMP comp;
+            size_t lanes = n<8 ? n : 8;
+            T acc[8];
+            for(size_t k=0;k<lanes;++k) acc[k] = p[k];
+
+            size_t i=lanes;
+            for(;i+8<=n;i+=8)
+                for(size_t k=0;k<8;++k) 
+                    acc[k] = comp(p[i+k],acc[k]) ? p[i+k] : acc[k];
+
+            for(size_t k=1;k<lanes;++k) combine(acc[0],acc[k]);
+            for(;i<n;++i) combine(acc[0],p[i]);
+            return acc[0];
+        }
+
+        //! combine two partial results
+        static void combine(T &a,const T &b) { if(COMP()(b,a)) a = b; }
+
+        //! initialize n accumulators
+        static void assign(T *a,const T *p,size_t n,size_t)
+        {
+            std::copy(p,p+n,a);
+        }
+
+        //! update n accumulators with n elements
+        static void accumulate(T *a,const T *p,size_t n,size_t)
+        {
+            COMP comp;
+            for(size_t i=0;i<n;++i) a[i] = comp(p[i],a[i]) ? p[i] : a[i];
+        }
+
+        //! combine n partial results
+        static void combine(T *a,const T *b,size_t n)
+        {
+            accumulate(a,b,n,0);
+        }
+
+        //! get the result from the accumulator
+        static T result(const T &a) { return a; }
+    };
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief minimum reduction
+    //!
+    template<typename T> 
+    using min_reduction = extremum_reduction<T,std::less<T>>;
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief maximum reduction
+    //!
+    template<typename T> 
+    using max_reduction = extremum_reduction<T,std::greater<T>>;
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief argmax reduction
+    //!
+    //! The accumulator holds the maximum value and its index along the 
+    //! reduced dimensions. For equal values the first occurrence wins.
+    //!
+    //! \tparam T element type
+    //!
+    template<typename T> 
+    struct argmax_reduction
+    {
+        static_assert(!is_complex_type<T>::value,
+                      "Complex numbers have no order relation!");
+
+        //! accumulator type
+        typedef std::pair<T,size_t> reduction_type;
+        //! result type 
+        typedef size_t result_type;
+
+        //! an empty reduction has no maximum
+        static reduction_type empty()
+        {
+            throw size_mismatch_error(EXCEPTION_RECORD,
+                    "Cannot compute the maximum of an empty array!");
+        }
+
+        //! reduce a block of n elements
+        static reduction_type reduce(const T *p,size_t n,size_t index)
+        {
+            size_t offset = 0;
+            for(size_t i=1;i<n;++i)
+                if(p[i]>p[offset]) offset = i;
+
+            return reduction_type(p[offset],index+offset);
+        }
+
+        //! combine two partial results - a must be the lower index
+        static void combine(reduction_type &a,const reduction_type &b)
+        {
+            if(b.first>a.first) a = b;
+        }
+
+        //! initialize n accumulators
+        static void assign(reduction_type *a,const T *p,size_t n,size_t index)
+        {
+            for(size_t i=0;i<n;++i) a[i] = reduction_type(p[i],index);
+        }
+
+        //! update n accumulators with n elements
+        static void accumulate(reduction_type *a,const T *p,size_t n,
+                               size_t index)
+        {
+            for(size_t i=0;i<n;++i)
+                if(p[i]>a[i].first) a[i] = reduction_type(p[i],index);
+        }
+
+        //! combine n partial results
+        static void combine(reduction_type *a,const reduction_type *b,
+                            size_t n)
+        {
+            for(size_t i=0;i<n;++i) combine(a[i],b[i]);
+        }
+
+        //! get the result from the accumulator
+        static size_t result(const reduction_type &a) { return a.second; }
+    };
+
+//end of namespace
+}
+}
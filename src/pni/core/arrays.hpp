@@ -27,10 +27,18 @@
 #include <array>
 #include <pni/core/arrays/mdarray.hpp>
 #include <pni/core/arrays/array_view.hpp>
+#include <pni/core/arrays/array_view_runs.hpp>
+#include <pni/core/arrays/array_permutation.hpp>
+#include <pni/core/arrays/array_reshape.hpp>
 #include <pni/core/arrays/array_factory.hpp>
 #include <pni/core/arrays/slice.hpp>
 #include <pni/core/arrays/array_arithmetic.hpp>
 #include <pni/core/arrays/index_iterator.hpp>
+#include <pni/core/arrays/mapped_storage.hpp>
+#include <pni/core/arrays/external_storage.hpp>
+#include <pni/core/utilities/aligned_allocator.hpp>
+#include <pni/core/utilities/buffer_pool.hpp>
+#include <pni/core/utilities/numa_allocator.hpp>
 #include <boost/mpl/size_t.hpp>
 
 
@@ -113,6 +121,209 @@ namespace core{
                                            >,
                                  static_cindex_map<NDIMS...>
                                 >;
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_classes
+    //! \brief dynamic array with aligned storage
+    //!
+    //! Like dynamic_array but the data is aligned to the cache line size 
+    //! (64 Bytes) which is also the size of an AVX-512 register. Vector 
+    //! loads and stores thus never span two cache lines.
+    //!
+    //! \code
+    //! auto a = aligned_array<float32>::create(shape_t{1024,1024});
+    //! \endcode
+    //!
+    //! \tparam T element type
+    //!
+    template<typename T>
+    using aligned_array = mdarray<std::vector<T,aligned_allocator<T>>,
+                                  dynamic_cindex_map>;
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_classes
+    //! \brief array of fixed dimension with aligned storage
+    //!
+    //! \tparam T element type
+    //! \tparam D number of dimensions
+    //!
+    template<
+             typename T,
+             size_t   D
+            >
+    using fixed_dim_aligned_array = mdarray<std::vector<T,aligned_allocator<T>>,
+                                            fixed_dim_cindex_map<D>>;
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_classes
+    //! \brief dynamic array backed by huge pages
+    //!
+    //! Intended for multi-GB arrays like frame stacks. The data is backed 
+    //! by 2MB pages which reduces TLB misses when streaming over the data. 
+    //! By default transparent huge pages are used. Pass 
+    //! huge_page_policy::EXPLICIT to use the reserved huge page pool of the
+    //! system instead.
+    //!
+    //! \code
+    //! typedef huge_page_array<uint16> stack_type;
+    //! typedef huge_page_array<uint16,huge_page_policy::EXPLICIT> pool_type;
+    //!
+    //! auto stack = stack_type::create(shape_t{1000,2048,2048});
+    //! \endcode
+    //!
+    //! \tparam T element type
+    //! \tparam POLICY huge page policy
+    //!
+    template<
+             typename         T,
+             huge_page_policy POLICY = huge_page_policy::TRANSPARENT
+            >
+    using huge_page_array = 
+          mdarray<std::vector<T,huge_page_allocator<T,POLICY>>,
+                  dynamic_cindex_map>;
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_classes
+    //! \brief array of fixed dimension backed by huge pages
+    //!
+    //! \tparam T element type
+    //! \tparam D number of dimensions
+    //! \tparam POLICY huge page policy
+    //!
+    template<
+             typename         T,
+             size_t           D,
+             huge_page_policy POLICY = huge_page_policy::TRANSPARENT
+            >
+    using fixed_dim_huge_page_array = 
+          mdarray<std::vector<T,huge_page_allocator<T,POLICY>>,
+                  fixed_dim_cindex_map<D>>;
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_classes
+    //! \brief dynamic array backed by a memory mapped file
+    //!
+    //! Maps raw data dumps into an array without reading them. Use the 
+    //! map function of array_factory to open a file.
+    //!
+    //! \code
+    //! typedef mapped_array<uint16> array_type;
+    //! typedef array_factory<array_type> factory;
+    //!
+    //! auto frames = factory::map(shape_t{10000,2048,2048},"frames.raw");
+    //! \endcode
+    //!
+    //! \tparam T element type
+    //!
+    template<typename T>
+    using mapped_array = mdarray<mapped_storage<T>,dynamic_cindex_map>;
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_classes
+    //! \brief array of fixed dimension backed by a memory mapped file
+    //!
+    //! \tparam T element type
+    //! \tparam D number of dimensions
+    //!
+    template<
+             typename T,
+             size_t   D
+            >
+    using fixed_dim_mapped_array = mdarray<mapped_storage<T>,
+                                           fixed_dim_cindex_map<D>>;
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_classes
+    //! \brief dynamic array referring to external memory
+    //!
+    //! Puts an array interface on memory owned by somebody else. Use the 
+    //! wrap function of array_factory to create an instance.
+    //!
+    //! \code
+    //! typedef external_array<uint16> frame_type;
+    //! typedef array_factory<frame_type> factory;
+    //!
+    //! auto frame = factory::wrap(shape_t{2048,2048},buffer);
+    //! \endcode
+    //!
+    //! \tparam T element type
+    //!
+    template<typename T>
+    using external_array = mdarray<external_storage<T>,dynamic_cindex_map>;
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_classes
+    //! \brief array of fixed dimension referring to external memory
+    //!
+    //! \tparam T element type
+    //! \tparam D number of dimensions
+    //!
+    template<
+             typename T,
+             size_t   D
+            >
+    using fixed_dim_external_array = mdarray<external_storage<T>,
+                                             fixed_dim_cindex_map<D>>;
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_classes
+    //! \brief dynamic array using memory from a buffer pool
+    //!
+    //! Intended for arrays of identical shape which are created and 
+    //! destroyed at high rates like the frames of a detector. Create 
+    //! instances with array_factory passing the pool.
+    //!
+    //! \code
+    //! typedef pool_array<uint16> frame_type;
+    //! buffer_pool pool;
+    //!
+    //! auto frame = array_factory<frame_type>::create(shape_t{2048,2048},pool);
+    //! \endcode
+    //!
+    //! \tparam T element type
+    //!
+    template<typename T>
+    using pool_array = mdarray<std::vector<T,pool_allocator<T>>,
+                               dynamic_cindex_map>;
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_classes
+    //! \brief NUMA aware dynamic array
+    //!
+    //! A dynamic array for large data processed by multiple threads. 
+    //! Arithmetic operations use parallel_inplace_arithmetics. With the 
+    //! default FIRST_TOUCH policy the array should be created with 
+    //! parallel_init so that every page is placed on the node of the 
+    //! thread working on it. Alternatively the pages can be interleaved 
+    //! over all nodes or placed on the node of the allocating thread.
+    //!
+    //! \code
+    //! typedef numa_array<float32> array_type;
+    //! typedef numa_array<float32,numa_policy::INTERLEAVE> shared_type;
+    //!
+    //! auto a = array_type::create(shape_t{100,2048,2048},0.f,parallel_init);
+    //! \endcode
+    //!
+    //! \tparam T element type
+    //! \tparam POLICY NUMA placement policy
+    //!
+    template<
+             typename    T,
+             numa_policy POLICY = numa_policy::FIRST_TOUCH
+            >
+    using numa_array = mdarray<std::vector<T,numa_allocator<T,POLICY>>,
+                               dynamic_cindex_map,
+                               parallel_inplace_arithmetics>;
    
 //end of namespace
 }
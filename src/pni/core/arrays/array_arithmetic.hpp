@@ -53,13 +53,43 @@ namespace core{
     template<typename T>
     using ipa_type = typename T::inplace_arithmetic;
 
+    //!
+    //! \ingroup mdim_array_arithmetic_classes
+    //! \brief index map for a binary expression
+    //!
+    //! If the left operand is not broadcast its index map is used for the
+    //! result. Otherwise a new index map of the same type is created for 
+    //! the broadcast shape. 
+    //!
+    //! \throws shape_mismatch_error if the index map type cannot represent
+    //! the broadcast shape
+    //! \tparam LHS left operand type
+    //! \tparam OPT expression template type
+    //! \param a reference to the left operand
+    //! \param op reference to the expression template
+    //! \return index map for the result
+    //!
+    template<
+             typename LHS,
+             typename OPT
+            >
+    map_type<LHS> expression_map(const LHS &a,const OPT &op)
+    {
+        if(op.lhs_map().is_identity()) return a.map();
+
+        return map_utils<map_type<LHS>>::create(op.template shape<shape_t>());
+    }
+
 
     //======================binary addition operator===========================
     //!
     //! \ingroup mdim_array_arithmetic_classes
     //! \brief binary addition operator 
     //! 
-    //! Addition between two instaces of array like objects.
+    //! Addition between two instaces of array like objects. The shapes of 
+    //! the operands are broadcast: they are aligned at the last dimension
+    //! and along every dimension the number of elements must be equal or 1. 
+    //! The smaller operand is never copied.
     //!  
     //! \code
     //! mdarray<...> a = ...;
@@ -83,10 +113,14 @@ namespace core{
     mdarray<add_op<LHS,RHS>,map_type<LHS>,ipa_type<LHS>>
     operator+(const LHS &a,const RHS &b)
     {
+        static_assert(has_same_storage_order<LHS,RHS>::value,
+                      "Arrays must have the same storage order!");
+
         typedef add_op<LHS,RHS> operator_type;
         typedef mdarray<operator_type,map_type<LHS>,ipa_type<LHS>> return_type;
 
-        return return_type(a.map(),operator_type(a,b));
+        operator_type op(a,b);
+        return return_type(expression_map(a,op),op);
     }
 
     //-------------------------------------------------------------------------
@@ -167,7 +201,9 @@ namespace core{
     //! \ingroup mdim_array_arithmetic_classes
     //! \brief binary subtraction operator 
     //!  
-    //! Subtraction between two array like objects.
+    //! Subtraction between two array like objects. The shapes of the 
+    //! operands are broadcast, for instance to subtract a dark image from 
+    //! a stack of frames.
     //! 
     //! \code
     //! mdarray<...> a = ...;
@@ -191,10 +227,14 @@ namespace core{
     mdarray<sub_op<LHS,RHS >,map_type<LHS>,ipa_type<LHS>>
     operator-(const LHS &a, const RHS &b)
     {
+        static_assert(has_same_storage_order<LHS,RHS>::value,
+                      "Arrays must have the same storage order!");
+
         typedef sub_op<LHS,RHS> operator_type;
         typedef mdarray<operator_type,map_type<LHS>,ipa_type<LHS>> result_type;
 
-        return result_type(a.map(),operator_type(a,b));
+        operator_type op(a,b);
+        return result_type(expression_map(a,op),op);
     }
 
     //-------------------------------------------------------------------------
@@ -274,7 +314,8 @@ namespace core{
     //! \ingroup mdim_array_arithmetic_classes
     //! \brief binary division operator 
     //!
-    //! Binary division between two array objects
+    //! Binary division between two array objects. The shapes of the 
+    //! operands are broadcast.
     //! 
     //! \code
     //! mdarray<...> a = ...;
@@ -297,10 +338,14 @@ namespace core{
     mdarray<div_op<LHS,RHS>,map_type<LHS>,ipa_type<LHS>>
     operator/(const LHS &a, const RHS &b)
     {
+        static_assert(has_same_storage_order<LHS,RHS>::value,
+                      "Arrays must have the same storage order!");
+
         typedef div_op<LHS,RHS> operator_type;
         typedef mdarray<operator_type,map_type<LHS>,ipa_type<LHS>> result_type;
 
-        return result_type(a.map(),operator_type(a,b));
+        operator_type op(a,b);
+        return result_type(expression_map(a,op),op);
     }
 
     //-------------------------------------------------------------------------
@@ -380,7 +425,8 @@ namespace core{
     //! \ingroup mdim_arithemtic_classes
     //! \brief binary multiplication operator
     //!
-    //! Multiplication between two array type instances
+    //! Multiplication between two array type instances. The shapes of the
+    //! operands are broadcast.
     //! \code
     //! mdarray<...> a = ...;
     //! mdarray<...> b = ...;
@@ -402,10 +448,14 @@ namespace core{
     mdarray<mult_op<LHS,RHS>,map_type<LHS>,ipa_type<LHS>>
     operator*(const LHS &a, const RHS &b)
     {
+        static_assert(has_same_storage_order<LHS,RHS>::value,
+                      "Arrays must have the same storage order!");
+
         typedef mult_op<LHS,RHS> operator_type;
         typedef mdarray<operator_type,map_type<LHS>,ipa_type<LHS>> result_type;
 
-        return result_type(a.map(),operator_type(a,b));
+        operator_type op(a,b);
+        return result_type(expression_map(a,op),op);
     }
 
     //-------------------------------------------------------------------------
@@ -480,6 +530,313 @@ namespace core{
         return result_type(b.map(),operator_type(a,b));
     }
 
+    //======================unary math functions==============================
+    //!
+    //! \ingroup mdim_array_arithmetic_classes
+    //! \brief element wise square root
+    //!
+    //! Integer arrays yield float64 results. Like all other expression
+    //! templates the function is evaluated lazily and can be combined with
+    //! the arithmetic operators without temporary arrays.
+    //! \code
+    //! dynamic_array<float64> a = ...;
+    //! dynamic_array<float64> b = ...;
+    //! dynamic_array<float64> c = ...;
+    //!
+    //! c = sqrt(a*a+b*b);
+    //! \endcode
+    //!
+    //! \tparam ATYPE array type
+    //! \param a array instance
+    //! \return mdarray with the expression template
+    //!
+    template<
+             typename ATYPE,
+             typename = enable_if<is_array<ATYPE>>
+            >
+    mdarray<sqrt_op<ATYPE>,map_type<ATYPE>,ipa_type<ATYPE>>
+    sqrt(const ATYPE &a)
+    {
+        typedef sqrt_op<ATYPE> operator_type;
+        typedef mdarray<operator_type,map_type<ATYPE>,
+                        ipa_type<ATYPE>> result_type;
+
+        return result_type(a.map(),operator_type(a));
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_arithmetic_classes
+    //! \brief element wise exponential function
+    //!
+    //! Integer arrays yield float64 results.
+    //! \code
+    //! c = exp(a);
+    //! \endcode
+    //!
+    //! \tparam ATYPE array type
+    //! \param a array instance
+    //! \return mdarray with the expression template
+    //!
+    template<
+             typename ATYPE,
+             typename = enable_if<is_array<ATYPE>>
+            >
+    mdarray<exp_op<ATYPE>,map_type<ATYPE>,ipa_type<ATYPE>>
+    exp(const ATYPE &a)
+    {
+        typedef exp_op<ATYPE> operator_type;
+        typedef mdarray<operator_type,map_type<ATYPE>,
+                        ipa_type<ATYPE>> result_type;
+
+        return result_type(a.map(),operator_type(a));
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_arithmetic_classes
+    //! \brief element wise natural logarithm
+    //!
+    //! Integer arrays yield float64 results.
+    //! \code
+    //! c = log(a+1.0);
+    //! \endcode
+    //!
+    //! \tparam ATYPE array type
+    //! \param a array instance
+    //! \return mdarray with the expression template
+    //!
+    template<
+             typename ATYPE,
+             typename = enable_if<is_array<ATYPE>>
+            >
+    mdarray<log_op<ATYPE>,map_type<ATYPE>,ipa_type<ATYPE>>
+    log(const ATYPE &a)
+    {
+        typedef log_op<ATYPE> operator_type;
+        typedef mdarray<operator_type,map_type<ATYPE>,
+                        ipa_type<ATYPE>> result_type;
+
+        return result_type(a.map(),operator_type(a));
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_arithmetic_classes
+    //! \brief element wise absolute value
+    //!
+    //! For complex arrays the result is the magnitude with the base type
+    //! of the complex type. For all other arrays the type is preserved.
+    //! \code
+    //! dynamic_array<complex64> a = ...;
+    //! dynamic_array<float64> c = ...;
+    //!
+    //! c = abs(a);
+    //! \endcode
+    //!
+    //! \tparam ATYPE array type
+    //! \param a array instance
+    //! \return mdarray with the expression template
+    //!
+    template<
+             typename ATYPE,
+             typename = enable_if<is_array<ATYPE>>
+            >
+    mdarray<abs_op<ATYPE>,map_type<ATYPE>,ipa_type<ATYPE>>
+    abs(const ATYPE &a)
+    {
+        typedef abs_op<ATYPE> operator_type;
+        typedef mdarray<operator_type,map_type<ATYPE>,
+                        ipa_type<ATYPE>> result_type;
+
+        return result_type(a.map(),operator_type(a));
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_arithmetic_classes
+    //! \brief element wise power function
+    //!
+    //! Raises every element to the power of e. Integer arrays yield float64 
+    //! results.
+    //! \code
+    //! c = pow(a,2.5);
+    //! \endcode
+    //!
+    //! \tparam ATYPE array type
+    //! \tparam E exponent type
+    //! \param a array instance
+    //! \param e exponent
+    //! \return mdarray with the expression template
+    //!
+    template<
+             typename ATYPE,
+             typename E,
+             typename = enable_if<and_t<is_array<ATYPE>,not_t<is_array<E>>>>
+            >
+    mdarray<pow_op<ATYPE>,map_type<ATYPE>,ipa_type<ATYPE>>
+    pow(const ATYPE &a,const E &e)
+    {
+        typedef pow_op<ATYPE> operator_type;
+        typedef typename operator_type::value_type exponent_type;
+        typedef mdarray<operator_type,map_type<ATYPE>,
+                        ipa_type<ATYPE>> result_type;
+
+        return result_type(a.map(),operator_type(a,{exponent_type(e)}));
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_arithmetic_classes
+    //! \brief clamp array elements
+    //!
+    //! Limits every element to the interval [lower,upper]. The element type
+    //! is preserved. Complex arrays cannot be clamped.
+    //! \code
+    //! c = clamp(a-dark,0,65535);
+    //! \endcode
+    //!
+    //! \tparam ATYPE array type
+    //! \tparam T limit type
+    //! \param a array instance
+    //! \param lower lower limit
+    //! \param upper upper limit
+    //! \return mdarray with the expression template
+    //!
+    template<
+             typename ATYPE,
+             typename T,
+             typename = enable_if<and_t<is_array<ATYPE>,not_t<is_array<T>>>>
+            >
+    mdarray<clamp_op<ATYPE>,map_type<ATYPE>,ipa_type<ATYPE>>
+    clamp(const ATYPE &a,const T &lower,const T &upper)
+    {
+        typedef clamp_op<ATYPE> operator_type;
+        typedef typename ATYPE::value_type value_type;
+        typedef mdarray<operator_type,map_type<ATYPE>,
+                        ipa_type<ATYPE>> result_type;
+
+        return result_type(a.map(),operator_type(a,{value_type(lower),
+                                                    value_type(upper)}));
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_arithmetic_classes
+    //! \brief element wise complex conjugate
+    //!
+    //! For real arrays this is the identity.
+    //! \code
+    //! c = a*conj(a);
+    //! \endcode
+    //!
+    //! \tparam ATYPE array type
+    //! \param a array instance
+    //! \return mdarray with the expression template
+    //!
+    template<
+             typename ATYPE,
+             typename = enable_if<is_array<ATYPE>>
+            >
+    mdarray<conj_op<ATYPE>,map_type<ATYPE>,ipa_type<ATYPE>>
+    conj(const ATYPE &a)
+    {
+        typedef conj_op<ATYPE> operator_type;
+        typedef mdarray<operator_type,map_type<ATYPE>,
+                        ipa_type<ATYPE>> result_type;
+
+        return result_type(a.map(),operator_type(a));
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_arithmetic_classes
+    //! \brief real part of array elements
+    //!
+    //! The result has the base type of the complex type.
+    //! \code
+    //! dynamic_array<complex64> a = ...;
+    //! dynamic_array<float64> c = ...;
+    //!
+    //! c = real(a);
+    //! \endcode
+    //!
+    //! \tparam ATYPE array type
+    //! \param a array instance
+    //! \return mdarray with the expression template
+    //!
+    template<
+             typename ATYPE,
+             typename = enable_if<is_array<ATYPE>>
+            >
+    mdarray<real_op<ATYPE>,map_type<ATYPE>,ipa_type<ATYPE>>
+    real(const ATYPE &a)
+    {
+        typedef real_op<ATYPE> operator_type;
+        typedef mdarray<operator_type,map_type<ATYPE>,
+                        ipa_type<ATYPE>> result_type;
+
+        return result_type(a.map(),operator_type(a));
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_arithmetic_classes
+    //! \brief imaginary part of array elements
+    //!
+    //! The result has the base type of the complex type. For real arrays 
+    //! all elements are 0.
+    //! \code
+    //! c = imag(a);
+    //! \endcode
+    //!
+    //! \tparam ATYPE array type
+    //! \param a array instance
+    //! \return mdarray with the expression template
+    //!
+    template<
+             typename ATYPE,
+             typename = enable_if<is_array<ATYPE>>
+            >
+    mdarray<imag_op<ATYPE>,map_type<ATYPE>,ipa_type<ATYPE>>
+    imag(const ATYPE &a)
+    {
+        typedef imag_op<ATYPE> operator_type;
+        typedef mdarray<operator_type,map_type<ATYPE>,
+                        ipa_type<ATYPE>> result_type;
+
+        return result_type(a.map(),operator_type(a));
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_arithmetic_classes
+    //! \brief element wise squared magnitude
+    //!
+    //! Like std::norm this computes the square of the absolute value. The 
+    //! result has the base type of the complex type.
+    //! \code
+    //! c = norm(a);
+    //! \endcode
+    //!
+    //! \tparam ATYPE array type
+    //! \param a array instance
+    //! \return mdarray with the expression template
+    //!
+    template<
+             typename ATYPE,
+             typename = enable_if<is_array<ATYPE>>
+            >
+    mdarray<norm_op<ATYPE>,map_type<ATYPE>,ipa_type<ATYPE>>
+    norm(const ATYPE &a)
+    {
+        typedef norm_op<ATYPE> operator_type;
+        typedef mdarray<operator_type,map_type<ATYPE>,
+                        ipa_type<ATYPE>> result_type;
+
+        return result_type(a.map(),operator_type(a));
+    }
+
 //end of namespace
 }
 }
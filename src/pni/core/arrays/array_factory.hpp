@@ -24,11 +24,30 @@
 #pragma once
 
 #include <sstream>
+#include <type_traits>
 #include <pni/core/utilities/container_utils.hpp>
+#include <pni/core/utilities/buffer_pool.hpp>
+#include <pni/core/algorithms/math/parallel_inplace_arithmetics.hpp>
+#include <pni/core/arrays/mapped_storage.hpp>
+#include <pni/core/arrays/external_storage.hpp>
 
 namespace pni{
 namespace core{
 
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief tag for parallel initialization
+    //!
+    //! Passed to array_factory::create to request that the elements of a 
+    //! new array are initialized in parallel.
+    //!
+    struct parallel_init_t {};
+
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief instance of parallel_init_t
+    //!
+    const parallel_init_t parallel_init = parallel_init_t();
 
     //-------------------------------------------------------------------------
     //!
@@ -91,6 +110,63 @@ namespace core{
             return array_type(std::move(map),std::move(storage));
         }
 
+        //---------------------------------------------------------------------
+        //!
+        //! \brief create array and initialize it in parallel
+        //!
+        //! Like create(s,def_val) but the elements are initialized by the 
+        //! library thread pool with the partitioning used by 
+        //! parallel_inplace_arithmetics and the expression evaluator. On 
+        //! NUMA systems every page is thus placed on the node of the thread 
+        //! which later works on it. 
+        //!
+        //! This requires a storage which does not touch its memory on 
+        //! allocation (like numa_array, aligned_array or huge_page_array). 
+        //! std::vector with the default allocator initializes the memory 
+        //! with a single thread.
+        /*!
+        \code
+        typedef numa_array<float64>       array_type;
+        typedef array_factory<array_type> factory;
+
+        auto a = factory::create(shape_t{20000,20000},0.,parallel_init);
+        \endcode
+        */
+        //!
+        //! \tparam STYPE container type for shape information
+        //! \param s shape of the array
+        //! \param def_val default value for data
+        //! \return instance of array_type
+        //!
+        template<typename STYPE> 
+        static array_type create(const STYPE &s,const value_type &def_val,
+                                 parallel_init_t)
+        {
+            auto map = map_utils<map_type>::create(s);
+            auto storage = container_utils<storage_type>::create(
+                                                map.max_elements(),no_init);
+            parallel_inplace_arithmetics::fill(storage.data(),storage.size(),
+                                               def_val);
+            return array_type(std::move(map),std::move(storage));
+        }
+
+        //---------------------------------------------------------------------
+        //!
+        //! \brief create array and initialize it in parallel
+        //!
+        //! Initializes all elements in parallel with a default constructed 
+        //! value.
+        //!
+        //! \tparam STYPE container type for shape information
+        //! \param s shape of the array
+        //! \return instance of array_type
+        //!
+        template<typename STYPE> 
+        static array_type create(const STYPE &s,parallel_init_t)
+        {
+            return create(s,value_type(),parallel_init);
+        }
+
         //---------------------------------------------------------------------
         //!
         //! \brief create array from shape and data
@@ -142,6 +218,87 @@ namespace core{
             return array_type(std::move(map),std::move(storage));
         }
 
+        //---------------------------------------------------------------------
+        //!
+        //! \brief create array without initialization
+        //!
+        //! Create an array whose elements are not initialized. This is 
+        //! intended for large arrays which are immediately filled by a read 
+        //! operation or a computation. Only the allocation is done - for 
+        //! storages using one of the allocators of the library (like 
+        //! aligned_array or huge_page_array) the memory is not touched at 
+        //! all. std::vector with the default allocator still initializes 
+        //! its elements with 0 but the additional fill with a default value 
+        //! is skipped.
+        /*!
+        \code
+        typedef huge_page_array<uint16>   array_type;
+        typedef array_factory<array_type> factory;
+
+        auto stack = factory::create(shape_t{1000,2048,2048},no_init);
+        stream.read(reinterpret_cast<char*>(stack.data()),
+                    stack.size()*sizeof(uint16));
+        \endcode
+        */
+        //!
+        //! \tparam STYPE container type for shape information
+        //! \param s shape of the array
+        //! \return instance of array_type
+        //!
+        template<typename STYPE>
+        static array_type create(const STYPE &s,no_init_t)
+        {
+            static_assert(std::is_trivially_default_constructible<
+                          value_type>::value,
+                          "Only arrays of trivial types can be created "
+                          "without initialization!");
+
+            auto map = map_utils<map_type>::create(s);
+            auto storage = container_utils<storage_type>::create(
+                                                map.max_elements(),no_init);
+            return array_type(std::move(map),std::move(storage));
+        }
+
+        //---------------------------------------------------------------------
+        //!
+        //! \brief create array from a buffer pool
+        //!
+        //! Creates an array whose memory is taken from a buffer pool. This 
+        //! is only available for arrays whose storage is a std::vector using
+        //! pool_allocator. The elements are default initialized - for 
+        //! trivial types their memory is not touched. Creating and 
+        //! destroying arrays of the same shape in a loop thus reuses the 
+        //! same buffers.
+        /*!
+        \code
+        typedef pool_array<uint16>        array_type;
+        typedef array_factory<array_type> factory;
+
+        buffer_pool pool;
+        while(acquiring)
+        {
+            auto frame = factory::create(shape_t{2048,2048},pool);
+            ....
+        }
+        \endcode
+        */
+        //!
+        //! \tparam STYPE container type for shape information
+        //! \param s shape of the array
+        //! \param pool the buffer pool
+        //! \return instance of array_type
+        //!
+        template<typename STYPE>
+        static array_type create(const STYPE &s,buffer_pool &pool)
+        {
+            typedef typename storage_type::allocator_type allocator_type;
+
+            auto map = map_utils<map_type>::create(s);
+            auto storage = storage_type(allocator_type(pool));
+            storage.resize(map.max_elements());
+            return array_type(std::move(map),std::move(storage));
+        }
+
         //---------------------------------------------------------------------
         //!
         //! \brief construct from initializer list 
@@ -187,6 +344,75 @@ namespace core{
             std::copy(data.begin(),data.end(),storage.begin());
             return array_type(std::move(map),std::move(storage));
         }
+
+        //---------------------------------------------------------------------
+        //!
+        //! \brief create array from a file
+        //!
+        //! Maps the raw data of a file into an array. This is only available 
+        //! for arrays using mapped_storage. The data is not read - pages of 
+        //! the file are loaded when they are accessed.
+        /*!
+        \code
+        typedef mdarray<mapped_storage<uint16>,dynamic_cindex_map> array_type;
+        typedef array_factory<array_type> factory;
+
+        auto frames = factory::map(shape_t{1000,2048,2048},"frames.raw");
+
+        //skip a 512 byte file header
+        auto data = factory::map(shape_t{100,1024},"data.raw",
+                                 map_mode::COPY_ON_WRITE,512);
+        \endcode
+        */
+        //!
+        //! \throws file_error if the file cannot be opened or mapped
+        //! \throws size_mismatch_error if the file is too short
+        //! \tparam STYPE container type for shape information
+        //! \param s shape of the array
+        //! \param path path to the file
+        //! \param mode mapping mode
+        //! \param offset offset of the first element in the file in bytes
+        //! \return instance of array_type
+        //!
+        template<typename STYPE>
+        static array_type map(const STYPE &s,const string &path,
+                              map_mode mode = map_mode::READ_ONLY,
+                              size_t offset = 0)
+        {
+            auto map = map_utils<map_type>::create(s);
+            storage_type storage(path,mode,map.max_elements(),offset);
+            return array_type(std::move(map),std::move(storage));
+        }
+
+        //---------------------------------------------------------------------
+        //!
+        //! \brief wrap external memory
+        //!
+        //! Creates an array referring to memory owned by somebody else. No 
+        //! data is copied. This is only available for arrays using 
+        //! external_storage. The memory must remain valid as long as the 
+        //! array (or any copy of it) is in use.
+        /*!
+        \code
+        typedef mdarray<external_storage<uint16>,dynamic_cindex_map> array_type;
+        typedef array_factory<array_type> factory;
+
+        auto frame = factory::wrap(shape_t{2048,2048},dma_buffer);
+        \endcode
+        */
+        //!
+        //! \tparam STYPE container type for shape information
+        //! \param s shape of the array
+        //! \param ptr pointer to the first element
+        //! \return instance of array_type
+        //!
+        template<typename STYPE>
+        static array_type wrap(const STYPE &s,value_type *ptr)
+        {
+            auto map = map_utils<map_type>::create(s);
+            storage_type storage(ptr,map.max_elements());
+            return array_type(std::move(map),std::move(storage));
+        }
         
     };
     
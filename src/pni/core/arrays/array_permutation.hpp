@@ -0,0 +1,464 @@
+//
+// (c) Copyright 2026 DESY, Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+// This file is part of libpnicore.
+//
+// libpnicore is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpnicore is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpnicore.  If not, see <http://www.gnu.org/licenses/>.
+//
+// ============================================================================
+//
+// Created on: Oct 16, 2026
+//     Author: Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+#pragma once
+
+#include <vector>
+#include <sstream>
+#include <algorithm>
+#include <functional>
+#include <type_traits>
+
+#include <pni/core/error/exceptions.hpp>
+#include <pni/core/types/container_trait.hpp>
+#include <pni/core/utilities/thread_pool.hpp>
+#include <pni/core/arrays/slice.hpp>
+#include <pni/core/arrays/array_selection.hpp>
+#include <pni/core/arrays/array_view.hpp>
+#include <pni/core/arrays/array_factory.hpp>
+
+namespace pni{
+namespace core{
+
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief cache blocked permutation kernel
+    //!
+    //! Copies the elements of a strided source into a contiguous 
+    //! destination. The layout of the source is described by the shape and
+    //! the source strides of every dimension ordered from the slowest to the
+    //! fastest varying dimension of the destination. 
+    //!
+    //! Adjacent dimensions which are contiguous in the source are merged 
+    //! first. If the fastest dimension of the destination is contiguous in 
+    //! the source as well, the data is copied in runs. Otherwise the fastest
+    //! destination dimension and the dimension with the smallest source 
+    //! stride are traversed in square tiles of about tile_bytes bytes. 
+    //! Within a tile both the reads and the writes stay in the cache. 
+    //!
+    //! Large copies are distributed over the library thread pool.
+    //!
+    struct permutation_kernel
+    {
+        //! maximum number of bytes of a tile
+        static const size_t tile_bytes = 1ul<<14;
+
+        //! minimum number of elements for parallel execution
+        static const size_t min_size = 1ul<<16;
+
+        //! number of bytes processed by a single chunk of work
+        static const size_t chunk_bytes = 1ul<<18;
+
+        //--------------------------------------------------------------------
+        //!
+        //! \brief edge length of a tile
+        //!
+        //! \tparam T element type
+        //! \return number of elements along each edge of a tile
+        //!
+        template<typename T> static size_t block_size()
+        {
+            size_t block = 8;
+            while(4*block*block*sizeof(T)<=tile_bytes) block *= 2;
+            return block;
+        }
+
+        //--------------------------------------------------------------------
+        //!
+        //! \brief copy with permutation 
+        //!
+        //! \tparam T element type
+        //! \param dst pointer to the contiguous destination
+        //! \param src pointer to the first element of the source
+        //! \param shape shape of the destination in linear order
+        //! \param strides source strides in the same order as shape
+        //!
+        template<typename T>
+        static void run(T *dst,const T *src,const std::vector<size_t> &shape,
+                        const std::vector<size_t> &strides)
+        {
+            //drop unit dimensions and merge dimensions contiguous in the 
+            //source
+            std::vector<size_t> n,s;
+            size_t total = 1;
+            for(size_t d=0;d<shape.size();++d)
+            {
+                total *= shape[d];
+                if(shape[d]==1) continue;
+
+                if(!n.empty() && s.back()==shape[d]*strides[d])
+                {
+                    n.back() *= shape[d];
+                    s.back() = strides[d];
+                }
+                else
+                {
+                    n.push_back(shape[d]);
+                    s.push_back(strides[d]);
+                }
+            }
+
+            if(!total) return;
+            if(n.empty()) { *dst = *src; return; }
+
+            //destination strides
+            size_t rank = n.size();
+            std::vector<size_t> ds(rank,1);
+            for(size_t d=rank-1;d!=0;--d) ds[d-1] = ds[d]*n[d];
+
+            //the fastest destination dimension is always traversed in the 
+            //innermost loop - k is the dimension of the tile rows
+            size_t f = rank-1;
+            size_t k = f;
+            if(s[f]!=1)
+                for(size_t d=0;d<f;++d)
+                    if(k==f || s[d]<s[k]) k = d;
+
+            std::vector<size_t> outer;
+            for(size_t d=0;d<rank;++d) 
+                if(d!=f && d!=k) outer.push_back(d);
+
+            //compute the origin of an outer iteration
+            auto origin = [&](size_t o,size_t &soffset,size_t &doffset)
+            {
+                soffset = doffset = 0;
+                for(size_t d=outer.size();d!=0;--d)
+                {
+                    size_t dim = outer[d-1];
+                    soffset += (o%n[dim])*s[dim];
+                    doffset += (o%n[dim])*ds[dim];
+                    o /= n[dim];
+                }
+            };
+
+            size_t units,unit_size;
+            std::function<void(size_t,size_t)> work;
+            if(k==f)
+            {
+                //copy runs along the fastest dimension
+                units = total/n[f];
+                unit_size = n[f];
+                work = [&](size_t begin,size_t end)
+                {
+                    size_t soffset,doffset;
+                    for(size_t u=begin;u<end;++u)
+                    {
+                        origin(u,soffset,doffset);
+                        if(s[f]==1)
+                            std::copy(src+soffset,src+soffset+n[f],
+                                      dst+doffset);
+                        else
+                            for(size_t j=0;j<n[f];++j)
+                                dst[doffset+j] = src[soffset+j*s[f]];
+                    }
+                };
+            }
+            else
+            {
+                //a unit is a row of tiles
+                size_t block = block_size<T>();
+                size_t rows = (n[k]+block-1)/block;
+                units = total/(n[k]*n[f])*rows;
+                unit_size = block*n[f];
+                work = [&,block,rows](size_t begin,size_t end)
+                {
+                    size_t soffset,doffset;
+                    for(size_t u=begin;u<end;++u)
+                    {
+                        origin(u/rows,soffset,doffset);
+                        size_t i0 = (u%rows)*block;
+                        size_t i1 = std::min(i0+block,n[k]);
+
+                        for(size_t j0=0;j0<n[f];j0+=block)
+                        {
+                            size_t j1 = std::min(j0+block,n[f]);
+                            for(size_t i=i0;i<i1;++i)
+                            {
+                                const T *sp = src+soffset+i*s[k];
+                                T *dp = dst+doffset+i*ds[k];
+                                for(size_t j=j0;j<j1;++j)
+                                    dp[j] = sp[j*s[f]];
+                            }
+                        }
+                    }
+                };
+            }
+
+            if(total<min_size)
+                work(0,units);
+            else
+                parallel_for(units,
+                             std::max(size_t(1),
+                                      chunk_bytes/(unit_size*sizeof(T))),
+                             work);
+        }
+    };
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief check a permutation
+    //!
+    //! \throws shape_mismatch_error if the number of axes does not match 
+    //! the rank
+    //! \throws index_error if axes is not a permutation of 0 to rank-1
+    //! \tparam CTYPE container type of the axes
+    //! \param axes the axes to check
+    //! \param rank number of dimensions of the array
+    //!
+    template<typename CTYPE>
+    void check_permutation(const CTYPE &axes,size_t rank)
+    {
+        if(axes.size()!=rank)
+        {
+            std::stringstream ss;
+            ss<<"Permutation has "<<axes.size()<<" axes but the array has "
+              <<"rank "<<rank<<"!";
+            throw shape_mismatch_error(EXCEPTION_RECORD,ss.str());
+        }
+
+        std::vector<bool> used(rank,false);
+        for(auto axis: axes)
+        {
+            if(size_t(axis)>=rank || used[axis])
+                throw index_error(EXCEPTION_RECORD,
+                        "Axes do not form a permutation!");
+            used[axis] = true;
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_classes
+    //! \brief permute the dimensions of an array
+    //!
+    //! Returns a view whose dimension d is dimension axes[d] of the array. 
+    //! The view addresses the memory of the array - no data is copied. As 
+    //! for all views dimensions with a single element are not part of the 
+    //! view.
+    /*!
+    \code
+    auto stack = dynamic_array<uint16>::create(shape_t{100,2048,2048});
+
+    //(frames,y,x) -> (y,x,frames)
+    auto series = permute(stack,shape_t{1,2,0});
+    \endcode
+    !*/
+    //!
+    //! \throws shape_mismatch_error if the number of axes does not match 
+    //! the rank of the array
+    //! \throws index_error if axes is not a permutation
+    //! \tparam ATYPE array type
+    //! \tparam CTYPE container type of the axes
+    //! \param a reference to the array
+    //! \param axes new order of the dimensions
+    //! \return view on the array with permuted dimensions
+    //!
+    template<
+             typename ATYPE,
+             typename CTYPE
+            >
+    array_view<ATYPE> permute(ATYPE &a,const CTYPE &axes)
+    {
+        typedef std::vector<size_t> index_type;
+
+        auto shape = a.template shape<index_type>();
+        check_permutation(axes,shape.size());
+
+        //dimensions with a single element are removed from the view
+        std::vector<slice> slices;
+        index_type effective(shape.size());
+        size_t rank = 0;
+        for(size_t d=0;d<shape.size();++d)
+        {
+            slices.push_back(slice(0,shape[d]));
+            effective[d] = rank;
+            if(shape[d]!=1) ++rank;
+        }
+
+        index_type view_axes;
+        for(auto axis: axes)
+            if(shape[axis]!=1) view_axes.push_back(effective[axis]);
+
+        return array_view<ATYPE>(a,array_selection::create(slices),
+                                 view_axes);
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_classes
+    //! \brief copy an array with permuted dimensions
+    //!
+    //! Writes the array with dimension d of the destination being 
+    //! dimension axes[d] of the source. The copy is done with a cache 
+    //! blocked kernel which runs on the library thread pool for large 
+    //! arrays (see permutation_kernel). 
+    //!
+    //! \throws shape_mismatch_error if the number of axes does not match 
+    //! the rank of the array or if the shape of the destination does not 
+    //! match the permuted shape
+    //! \throws index_error if axes is not a permutation
+    //! \tparam ATYPE source array type
+    //! \tparam CTYPE container type of the axes
+    //! \tparam DTYPE destination array type
+    //! \param a the source array
+    //! \param axes new order of the dimensions
+    //! \param dest the destination array
+    //!
+    template<
+             typename ATYPE,
+             typename CTYPE,
+             typename DTYPE
+            >
+    void permute_copy(const ATYPE &a,const CTYPE &axes,DTYPE &dest)
+    {
+        typedef std::vector<size_t> index_type;
+        typedef typename DTYPE::map_type::implementation_type 
+                dest_implementation;
+        static_assert(std::is_same<typename ATYPE::value_type,
+                                   typename DTYPE::value_type>::value,
+                      "Source and destination must have the same type!");
+        static_assert(container_trait<typename ATYPE::storage_type>::
+                      is_contiguous &&
+                      container_trait<typename DTYPE::storage_type>::
+                      is_contiguous,
+                      "Arrays must have contiguous storage!");
+
+        auto shape = a.template shape<index_type>();
+        check_permutation(axes,shape.size());
+
+        //strides of the source dimensions in the order of the destination
+        index_type index(shape.size(),0);
+        index_type pshape,pstrides;
+        for(auto axis: axes)
+        {
+            index[axis] = 1;
+            pshape.push_back(shape[axis]);
+            pstrides.push_back(a.map().offset(index));
+            index[axis] = 0;
+        }
+
+        auto dshape = dest.template shape<index_type>();
+        if(dshape!=pshape)
+            throw shape_mismatch_error(EXCEPTION_RECORD,
+                    "Destination shape does not match the permuted shape!");
+
+        permutation_kernel::run(dest.data(),a.data(),
+                                dest_implementation::linear_order(pshape),
+                                dest_implementation::linear_order(pstrides));
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief create the destination of a permuted copy
+    //!
+    //! Every element is overwritten by the copy. Arrays of trivial types 
+    //! are thus created without initialization. 
+    //!
+    //! \tparam ATYPE array type
+    //! \tparam STYPE shape type
+    //! \param shape shape of the array
+    //! \return new array
+    //!
+    template<
+             typename ATYPE,
+             typename STYPE
+            >
+    ATYPE create_permute_destination(const STYPE &shape,std::true_type)
+    {
+        return array_factory<ATYPE>::create(shape,no_init);
+    }
+
+    //-------------------------------------------------------------------------
+    //! \ingroup mdim_array_internal_classes
+    //! \brief create the destination for non-trivial element types
+    template<
+             typename ATYPE,
+             typename STYPE
+            >
+    ATYPE create_permute_destination(const STYPE &shape,std::false_type)
+    {
+        return array_factory<ATYPE>::create(shape);
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_classes
+    //! \brief create a copy with permuted dimensions
+    //!
+    //! Returns a new array with dimension d being dimension axes[d] of the 
+    //! source. The new array uses the storage type and the storage order 
+    //! of the source. Its shape is dynamic.
+    /*!
+    \code
+    auto stack = dynamic_array<uint16>::create(shape_t{100,2048,2048});
+
+    //(frames,y,x) -> (y,x,frames) - the time series of each pixel is 
+    //contiguous in the result
+    auto series = permute_copy(stack,shape_t{1,2,0});
+    \endcode
+    !*/
+    //!
+    //! \throws shape_mismatch_error if the number of axes does not match 
+    //! the rank of the array
+    //! \throws index_error if axes is not a permutation
+    //! \tparam ATYPE array type
+    //! \tparam CTYPE container type of the axes
+    //! \param a the source array
+    //! \param axes new order of the dimensions
+    //! \return new array 
+    //!
+    template<
+             typename ATYPE,
+             typename CTYPE
+            >
+    mdarray<typename ATYPE::storage_type,
+            index_map<std::vector<size_t>,
+                      typename ATYPE::map_type::implementation_type>,
+            typename ATYPE::inplace_arithmetic>
+    permute_copy(const ATYPE &a,const CTYPE &axes)
+    {
+        typedef std::vector<size_t> index_type;
+        typedef mdarray<typename ATYPE::storage_type,
+                        index_map<index_type,
+                                  typename ATYPE::map_type::
+                                  implementation_type>,
+                        typename ATYPE::inplace_arithmetic> result_type;
+
+        auto shape = a.template shape<index_type>();
+        check_permutation(axes,shape.size());
+
+        index_type pshape;
+        for(auto axis: axes) pshape.push_back(shape[axis]);
+
+        auto result = create_permute_destination<result_type>(pshape,
+                          std::is_trivially_default_constructible<
+                          typename result_type::value_type>());
+        permute_copy(a,axes,result);
+        return result;
+    }
+
+//end of namespace
+}
+}
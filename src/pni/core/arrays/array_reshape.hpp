@@ -0,0 +1,257 @@
+//
+// (c) Copyright 2026 DESY, Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+// This file is part of libpnicore.
+//
+// libpnicore is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpnicore is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpnicore.  If not, see <http://www.gnu.org/licenses/>.
+//
+// ============================================================================
+//
+// Created on: Oct 16, 2026
+//     Author: Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+#pragma once
+
+#include <vector>
+#include <sstream>
+#include <utility>
+
+#include <pni/core/error/exceptions.hpp>
+#include <pni/core/types/container_trait.hpp>
+#include <pni/core/arrays/index_map/index_maps.hpp>
+#include <pni/core/arrays/array_view.hpp>
+#include <pni/core/arrays/array_factory.hpp>
+#include <pni/core/arrays/external_storage.hpp>
+#include <pni/core/arrays/mdarray.hpp>
+
+namespace pni{
+namespace core{
+
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief type of a reshaped array sharing memory
+    //!
+    //! Provides the type of an array referring to the memory of an array 
+    //! or array view of type ATYPE. The new array uses external_storage 
+    //! and a dynamic index map with the storage order of ATYPE.
+    //!
+    //! \tparam ATYPE array or view type 
+    //!
+    template<typename ATYPE> struct shared_array_trait
+    {
+        //! array type sharing the memory of ATYPE
+        typedef mdarray<external_storage<typename ATYPE::value_type>,
+                        index_map<std::vector<size_t>,
+                                  typename ATYPE::map_type::
+                                  implementation_type>,
+                        typename ATYPE::inplace_arithmetic> type;
+    };
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_classes
+    //! \brief reshape an array without copying
+    //!
+    //! Returns an array with a new shape which refers to the memory of a. 
+    //! Changes to one of the arrays are visible in the other. a must 
+    //! outlive the returned array and must not be resized meanwhile. 
+    /*!
+    \code
+    auto buffer = dynamic_array<float32>::create(shape_t{n*h*w});
+    auto stack = reshape(buffer,shape_t{n,h,w});
+    \endcode
+    !*/
+    //!
+    //! \throws size_mismatch_error if the new shape does not describe the 
+    //! number of elements of the array
+    //! \tparam STORAGE storage type
+    //! \tparam IMAP index map type
+    //! \tparam IPA inplace arithmetic type
+    //! \tparam CTYPE container type with shape information
+    //! \param a reference to the array
+    //! \param shape the new shape
+    //! \return array sharing the memory of a
+    //!
+    template<
+             typename STORAGE,
+             typename IMAP,
+             typename IPA,
+             typename CTYPE
+            >
+    typename shared_array_trait<mdarray<STORAGE,IMAP,IPA>>::type
+    reshape(mdarray<STORAGE,IMAP,IPA> &a,const CTYPE &shape)
+    {
+        typedef typename shared_array_trait<mdarray<STORAGE,IMAP,IPA>>::type
+                result_type;
+
+        static_assert(container_trait<STORAGE>::is_contiguous,
+                      "Array must have contiguous storage!");
+
+        auto result = array_factory<result_type>::wrap(
+                        std::vector<size_t>{a.size()},a.data());
+        result.reshape(shape);
+        return result;
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_classes
+    //! \brief reshape a contiguous view without copying
+    //!
+    //! Returns an array with a new shape which refers to the elements of 
+    //! a contiguous view. The parent array of the view must outlive the 
+    //! returned array.
+    /*!
+    \code
+    auto frames = reshape(buffer(slice(0,n*h*w)),shape_t{n,h,w});
+    \endcode
+    !*/
+    //!
+    //! \throws shape_mismatch_error if the view is not contiguous
+    //! \throws size_mismatch_error if the new shape does not describe the 
+    //! number of elements of the view
+    //! \tparam ATYPE parent array type of the view
+    //! \tparam CTYPE container type with shape information
+    //! \param view the view
+    //! \param shape the new shape
+    //! \return array sharing the memory of the view
+    //!
+    template<
+             typename ATYPE,
+             typename CTYPE
+            >
+    typename shared_array_trait<array_view<ATYPE>>::type
+    reshape(array_view<ATYPE> view,const CTYPE &shape)
+    {
+        typedef typename shared_array_trait<array_view<ATYPE>>::type 
+                result_type;
+
+        auto result = array_factory<result_type>::wrap(
+                        std::vector<size_t>{view.size()},view.data());
+        result.reshape(shape);
+        return result;
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_classes
+    //! \brief reshape a temporary array
+    //!
+    //! The storage of the array is moved to the result - no data is copied.
+    /*!
+    \code
+    auto stack = reshape(read_buffer(),shape_t{n,h,w});
+    \endcode
+    !*/
+    //!
+    //! \throws shape_mismatch_error if the index map type does not support
+    //! the rank of the new shape
+    //! \throws size_mismatch_error if the new shape does not describe the 
+    //! number of elements of the array
+    //! \tparam STORAGE storage type
+    //! \tparam IMAP index map type
+    //! \tparam IPA inplace arithmetic type
+    //! \tparam CTYPE container type with shape information
+    //! \param a rvalue reference to the array
+    //! \param shape the new shape
+    //! \return array with the storage of a
+    //!
+    template<
+             typename STORAGE,
+             typename IMAP,
+             typename IPA,
+             typename CTYPE
+            >
+    mdarray<STORAGE,IMAP,IPA> 
+    reshape(mdarray<STORAGE,IMAP,IPA> &&a,const CTYPE &shape)
+    {
+        a.reshape(shape);
+        return std::move(a);
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_classes
+    //! \brief remove dimensions with a single element
+    //!
+    //! Works like reshape() on arrays, temporary arrays and contiguous 
+    //! views. If all dimensions have a single element the result is an 
+    //! array with a single dimension.
+    /*!
+    \code
+    //shape (1,2048,1,2048) -> (2048,2048)
+    auto image = squeeze(frame);
+    \endcode
+    !*/
+    //!
+    //! \throws shape_mismatch_error if a is a non-contiguous view
+    //! \tparam ATYPE array or view type
+    //! \param a the array
+    //! \return array without unit dimensions
+    //!
+    template<typename ATYPE>
+    auto squeeze(ATYPE &&a) 
+        -> decltype(reshape(std::forward<ATYPE>(a),std::vector<size_t>()))
+    {
+        std::vector<size_t> shape;
+        for(auto n: a.template shape<std::vector<size_t>>())
+            if(n!=1) shape.push_back(n);
+
+        if(shape.empty()) shape.push_back(1);
+
+        return reshape(std::forward<ATYPE>(a),shape);
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_classes
+    //! \brief insert a dimension with a single element
+    //!
+    //! Works like reshape() on arrays, temporary arrays and contiguous 
+    //! views. 
+    /*!
+    \code
+    //shape (2048,2048) -> (1,2048,2048)
+    auto stack = expand_dims(image,0);
+    \endcode
+    !*/
+    //!
+    //! \throws index_error if axis exceeds the rank of the array
+    //! \throws shape_mismatch_error if a is a non-contiguous view or if 
+    //! the index map of a temporary array has a fixed rank
+    //! \tparam ATYPE array or view type
+    //! \param a the array
+    //! \param axis position of the new dimension in the result
+    //! \return array with an additional dimension
+    //!
+    template<typename ATYPE>
+    auto expand_dims(ATYPE &&a,size_t axis)
+        -> decltype(reshape(std::forward<ATYPE>(a),std::vector<size_t>()))
+    {
+        auto shape = a.template shape<std::vector<size_t>>();
+        if(axis>shape.size())
+        {
+            std::stringstream ss;
+            ss<<"Axis "<<axis<<" exceeds the rank "<<shape.size()
+              <<" of the array!";
+            throw index_error(EXCEPTION_RECORD,ss.str());
+        }
+
+        shape.insert(shape.begin()+axis,1);
+        return reshape(std::forward<ATYPE>(a),shape);
+    }
+
+//end of namespace
+}
+}
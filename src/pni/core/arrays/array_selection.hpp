@@ -535,6 +535,49 @@ namespace core{
 
     }
 
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief compute effective strides of a selection
+    //!
+    //! Computes for every effective dimension of a selection (those with more
+    //! than one element) the distance in memory between two adjacent 
+    //! selection elements in the original array. Together with the 
+    //! start_offset() of the selection the linear offset of a selection 
+    //! element with index (i,j,k,...) is 
+    //! 
+    //! start_offset + i*strides[0] + j*strides[1] + k*strides[2] + ...
+    //!
+    //! \tparam MAPT index map type of the original array
+    //! \param map reference to the original index map
+    //! \param s reference to the selection object
+    //! \return vector with one stride for each effective dimension
+    //!
+    template<typename MAPT>
+    std::vector<size_t> effective_strides(const MAPT &map,
+                                          const array_selection &s)
+    {
+        typedef std::vector<size_t> index_type;
+
+        const index_type &shape = s.full_shape();
+        const index_type &stride = s.stride();
+        index_type index(shape.size(),0);
+        index_type strides;
+        strides.reserve(s.rank());
+
+        size_t origin = map.offset(index);
+        for(size_t d=0;d<shape.size();++d)
+        {
+            if(shape[d]==1) continue;
+
+            index[d] = 1;
+            strides.push_back((map.offset(index)-origin)*stride[d]);
+            index[d] = 0;
+        }
+
+        return strides;
+    }
+
     //-------------------------------------------------------------------------
     //! 
     //! \ingroup mdim_array_internal_classes
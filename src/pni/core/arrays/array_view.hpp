@@ -26,11 +26,13 @@
 #pragma once
 
 #include <memory>
+#include <sstream>
 #include <functional>
 #include <pni/core/arrays/index_map/index_maps.hpp>
 #include <pni/core/utilities.hpp>
 #include <pni/core/arrays/array_selection.hpp>
 #include <pni/core/arrays/index_utilities.hpp>
+#include <pni/core/arrays/array_view_iterator.hpp>
 #include <pni/core/algorithms/math/inplace_arithmetics.hpp>
 #include <pni/core/types/types.hpp>
 #include <pni/core/types/container_trait.hpp>
@@ -79,9 +81,9 @@ namespace core{
             //! unique pointer type
             using unique_ptr =  std::unique_ptr<array_type>;
             //! iterator type
-            using iterator = container_iterator<array_type>;
+            using iterator = array_view_iterator<array_type>;
             //! const iterator type
-            using const_iterator = container_iterator<const array_type>;
+            using const_iterator = array_view_iterator<const array_type>;
             //! view type
             using view_type = array_view<array_type>;
             //! index type
@@ -90,10 +92,17 @@ namespace core{
             using inplace_arithmetic = typename ATYPE::inplace_arithmetic;
             //! map type
             using map_type =  index_map<index_type,typename ATYPE::map_type::implementation_type>;
+            //! index map implementation - determines the storage order
+            using implementation_type = typename map_type::implementation_type;
             //========================public members===========================
             //! type id of the value_type
             static const type_id_t type_id = ATYPE::type_id;
         private:
+            //! the iterators access the offset information directly
+            template<typename ITERABLE> friend class array_view_iterator;
+            //! the run decomposition needs the strides of the view
+            template<typename VTYPE> friend struct contiguous_run_decomposition;
+
             //! parent array from which to draw data
             std::reference_wrapper<ATYPE> _parray; 
             //! selection object for index transformation 
@@ -109,6 +118,113 @@ namespace core{
             //! offset of the first element
             size_t _start_offset;
 
+            //! distance in memory between adjacent elements along each 
+            //! dimension of the view
+            index_type _strides;
+
+            //! shape of the view from the slowest to the fastest varying 
+            //! dimension of the parent array
+            index_type _linear_shape;
+
+            //! strides in the same order as _linear_shape
+            index_type _linear_strides;
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief offset from a multidimensional index
+            //!
+            //! Computes the offset of an element in the original array from 
+            //! its multidimensional index in the view. 
+            //!
+            //! \tparam CTYPE index container type
+            //! \param index multidimensional index in the view
+            //! \return linear offset in the original array
+            //!
+            template<typename CTYPE>
+            size_t _index_offset(const CTYPE &index) const
+            {
+#ifdef DEBUG
+                check_equal_size(_strides,index,EXCEPTION_RECORD);
+#endif
+                size_t offset = _start_offset;
+                auto stride = _strides.begin();
+                for(auto i: index) offset += size_t(i)*(*stride++);
+
+                return offset;
+            }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief offset from a linear index
+            //!
+            //! Computes the offset of an element in the original array from
+            //! its linear index in the view. The linear index follows the 
+            //! storage order of the parent array.
+            //!
+            //! \param i linear index in the view
+            //! \return linear offset in the original array
+            //!
+            size_t _linear_offset(size_t i) const
+            {
+                size_t offset = _start_offset;
+                auto shape = _linear_shape.end();
+                for(auto stride = _linear_strides.rbegin();
+                    stride!=_linear_strides.rend();++stride)
+                {
+                    size_t n = *(--shape);
+                    offset += (i%n)*(*stride);
+                    i /= n;
+                }
+
+                return offset;
+            }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief permute the dimensions of the view
+            //!
+            //! Dimension d of the view becomes dimension axes[d] of the 
+            //! selection. Only shape and strides are rearranged - no data 
+            //! is moved.
+            //!
+            //! \throws shape_mismatch_error if the number of axes does not 
+            //! match the rank of the view
+            //! \throws index_error if axes is not a permutation
+            //! \param axes new order of the dimensions
+            //!
+            void _permute(const index_type &axes)
+            {
+                if(axes.size()!=_strides.size())
+                {
+                    std::stringstream ss;
+                    ss<<"Permutation has "<<axes.size()<<" axes but the view "
+                      <<"has rank "<<_strides.size()<<"!";
+                    throw shape_mismatch_error(EXCEPTION_RECORD,ss.str());
+                }
+
+                index_type shape(_strides.size()),strides(_strides.size());
+                std::vector<bool> used(_strides.size(),false);
+                bool identity = true;
+                for(size_t d=0;d<axes.size();++d)
+                {
+                    size_t axis = axes[d];
+                    if(axis>=axes.size() || used[axis])
+                        throw index_error(EXCEPTION_RECORD,
+                                "Axes do not form a permutation!");
+
+                    used[axis] = true;
+                    identity = identity && axis==d;
+                    shape[d] = _imap.begin()[axis];
+                    strides[d] = _strides[axis];
+                }
+
+                _imap = map_utils<map_type>::create(shape);
+                _strides = std::move(strides);
+                _linear_shape = implementation_type::linear_order(shape);
+                _linear_strides = implementation_type::linear_order(_strides);
+                _is_contiguous = _is_contiguous && identity;
+            }
+
         public:
             //-----------------------------------------------------------------
             //! 
@@ -125,7 +241,11 @@ namespace core{
                 _imap(map_utils<map_type>::create(_selection.shape<index_type>())),
                 _index(a.rank()),
                 _is_contiguous(pni::core::is_contiguous(a.map(),_selection)),
-                _start_offset(start_offset(a.map(),_selection))
+                _start_offset(start_offset(a.map(),_selection)),
+                _strides(effective_strides(a.map(),_selection)),
+                _linear_shape(implementation_type::linear_order(
+                              _selection.shape<index_type>())),
+                _linear_strides(implementation_type::linear_order(_strides))
             { }
 
             //------------------------------------------------------------------
@@ -145,9 +265,36 @@ namespace core{
                 _imap(map_utils<map_type>::create(_selection.shape<index_type>())),
                 _index(a.rank()),
                 _is_contiguous(pni::core::is_contiguous(a.map(),_selection)),
-                _start_offset(start_offset(a.map(),_selection))
+                _start_offset(start_offset(a.map(),_selection)),
+                _strides(effective_strides(a.map(),_selection)),
+                _linear_shape(implementation_type::linear_order(
+                              _selection.shape<index_type>())),
+                _linear_strides(implementation_type::linear_order(_strides))
             {}
 
+            //-----------------------------------------------------------------
+            //!
+            //! \brief constructor
+            //!
+            //! Constructs a view with permuted dimensions. Dimension d of 
+            //! the view corresponds to dimension axes[d] of the selection. 
+            //! Elements are still addressed in the memory of the parent 
+            //! array - no data is copied.
+            //!
+            //! \throws shape_mismatch_error if the number of axes does not 
+            //! match the rank of the selection
+            //! \throws index_error if axes is not a permutation
+            //! \param a reference to the original array
+            //! \param s selection object defining the description dimension
+            //! \param axes order of the selection dimensions in the view
+            //!
+            array_view(storage_type &a,const array_selection &s,
+                       const index_type &axes):
+                array_view(a,s)
+            {
+                _permute(axes);
+            }
+
 
             //-----------------------------------------------------------------
             //!
@@ -159,7 +306,10 @@ namespace core{
                 _imap(c._imap),
                 _index(c._index),
                 _is_contiguous(c._is_contiguous),
-                _start_offset(c._start_offset)
+                _start_offset(c._start_offset),
+                _strides(c._strides),
+                _linear_shape(c._linear_shape),
+                _linear_strides(c._linear_strides)
             {}
 
             //-----------------------------------------------------------------
@@ -172,7 +322,10 @@ namespace core{
                 _imap(std::move(c._imap)),
                 _index(std::move(c._index)),
                 _is_contiguous(c._is_contiguous),
-                _start_offset(c._start_offset)
+                _start_offset(c._start_offset),
+                _strides(std::move(c._strides)),
+                _linear_shape(std::move(c._linear_shape)),
+                _linear_strides(std::move(c._linear_strides))
             {}
 
             //-----------------------------------------------------------------
@@ -182,6 +335,8 @@ namespace core{
             template<typename ETYPE>
             array_type &operator=(const ETYPE &e)
             {
+                static_assert(has_same_storage_order<array_type,ETYPE>::value,
+                              "Arrays must have the same storage order!");
                 if((void*)this == (void*)&e) return *this;
                
                 //for(size_t i=0;i<size();++i) (*this)[i] = e[i];
@@ -205,6 +360,9 @@ namespace core{
                 _index = std::move(a._index);
                 _is_contiguous = a._is_contiguous;
                 _start_offset  = a._start_offset;
+                _strides = std::move(a._strides);
+                _linear_shape = std::move(a._linear_shape);
+                _linear_strides = std::move(a._linear_strides);
 
                 return *this;
             }
@@ -228,17 +386,12 @@ namespace core{
                     >
             value_type &operator()(const CTYPE &index)
             {
-                typedef typename ATYPE::map_type omap_type;
                 auto &ref = _parray.get();
 
                 if(_is_contiguous)
                     return ref[_start_offset + _imap.offset(index)];
                 else
-                {
-                    auto  map = const_cast<omap_type&>(ref.map());
-                    size_t o = map.offset(_selection,index);
-                    return ref[o];
-                }
+                    return ref[_index_offset(index)];
             }
 
             //-----------------------------------------------------------------
@@ -260,17 +413,12 @@ namespace core{
                     >
             value_type operator()(const CTYPE &index) const
             {
-                typedef typename ATYPE::map_type omap_type;
                 auto &ref = _parray.get();
 
                 if(_is_contiguous)
                     return ref[_start_offset + _imap.offset(index)];
                 else
-                {
-                    auto  map = const_cast<omap_type&>(ref.map());
-                    size_t o = map.offset(_selection,index);
-                    return ref[o];
-                }
+                    return ref[_index_offset(index)];
             }
 
 
@@ -295,19 +443,13 @@ namespace core{
             template<typename ...ITypes> 
             value_type & operator()(ITypes ...indices)
             {
-                typedef typename ATYPE::map_type omap_type;
                 auto &ref = _parray.get();
 
                 if(_is_contiguous)
                     return ref[_start_offset +
                                _imap.offset(IDX_ARRAY(ITypes,indices))];
                 else
-                {
-                    auto  map = const_cast<omap_type&>(ref.map());
-                    size_t o = map.offset(_selection,IDX_ARRAY(ITypes,indices));
-                    return ref[o];
-                }
-
+                    return ref[_index_offset(IDX_ARRAY(ITypes,indices))];
             }
 
             //-----------------------------------------------------------------
@@ -332,18 +474,13 @@ namespace core{
             template<typename ...ITypes> 
             value_type operator()(ITypes ...indices) const
             {
-                typedef typename ATYPE::map_type omap_type;
                 auto &ref = _parray.get();
 
                 if(_is_contiguous)
                     return ref[_start_offset + 
                                _imap.offset(IDX_ARRAY(ITypes,indices))];
                 else
-                {
-                    //have to do some more work here
-                    auto map = const_cast<omap_type&>(ref.map());
-                    return ref[map.offset(_selection,IDX_ARRAY(ITypes,indices))];
-                }
+                    return ref[_index_offset(IDX_ARRAY(ITypes,indices))];
             }
 
             //-----------------------------------------------------------------
@@ -358,7 +495,8 @@ namespace core{
             //!
             template<typename CTYPE> CTYPE shape() const
             {
-                return _selection.template shape<CTYPE>();
+                return container_utils<CTYPE>::create(_imap.begin(),
+                                                      _imap.end());
             }
 
             //-----------------------------------------------------------------
@@ -377,14 +515,8 @@ namespace core{
 #ifdef DEBUG
                 check_index_in_dim(i,size(),EXCEPTION_RECORD);
 #endif
-                //compute the multidimensional index in the original array for
-                //the linear index i in the view
                 if(_is_contiguous) return _parray.get()[i+_start_offset];
-                else
-                {
-                    auto index = _imap.template index<index_type>(i);
-                    return (*this)(index); 
-                }
+                else               return _parray.get()[_linear_offset(i)];
             }
 
             //-----------------------------------------------------------------
@@ -406,13 +538,7 @@ namespace core{
                 check_index_in_dim(i,size(),EXCEPTION_RECORD);
 #endif
                 if(_is_contiguous) return _parray.get()[i+_start_offset];
-                else
-                {
-                    //compute the multidimensional index in the original array for
-                    //the linear index i in the view
-                    auto index = _imap.template index<index_type>(i);
-                    return (*this)(index); 
-                }
+                else               return _parray.get()[_linear_offset(i)];
             }
 
             //-----------------------------------------------------------------
@@ -643,6 +769,8 @@ namespace core{
             template<typename RTYPE> 
             array_type &operator+=(const RTYPE &v) 
             { 
+                static_assert(has_same_storage_order<array_type,RTYPE>::value,
+                              "Arrays must have the same storage order!");
                 storage_type::inplace_arithmetic::add(*this,v); 
                 return *this;
             }
@@ -691,6 +819,8 @@ namespace core{
             template<typename RTYPE> 
             array_type &operator-=(const RTYPE &v) 
             { 
+                static_assert(has_same_storage_order<array_type,RTYPE>::value,
+                              "Arrays must have the same storage order!");
                 storage_type::inplace_arithmetic::sub(*this,v); 
                 return *this;
             }
@@ -738,6 +868,8 @@ namespace core{
             template<typename RTYPE>
             array_type &operator*=(const RTYPE &v) 
             { 
+                static_assert(has_same_storage_order<array_type,RTYPE>::value,
+                              "Arrays must have the same storage order!");
                 storage_type::inplace_arithmetic::mult(*this,v); 
                 return *this;
             }
@@ -785,6 +917,8 @@ namespace core{
             template<typename RTYPE>
             array_type &operator/=(const RTYPE &v) 
             { 
+                static_assert(has_same_storage_order<array_type,RTYPE>::value,
+                              "Arrays must have the same storage order!");
                 storage_type::inplace_arithmetic::div(*this,v); 
                 return *this;
             }
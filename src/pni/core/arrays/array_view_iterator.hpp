@@ -0,0 +1,444 @@
+//
+// (c) Copyright 2026 DESY, Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+// This file is part of libpnicore.
+//
+// libpnicore is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpnicore is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpnicore.  If not, see <http://www.gnu.org/licenses/>.
+//
+// ============================================================================
+//
+// Created on: Oct 16, 2026
+//     Author: Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+#pragma once
+
+#include <vector>
+#include <iterator>
+#include <type_traits>
+#include <pni/core/error/exceptions.hpp>
+
+namespace pni{
+namespace core{
+
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief iterator for array views
+    //!
+    //! A random access iterator over the elements of an array_view. Unlike
+    //! container_iterator, which calls operator[] of the view for every 
+    //! element, this iterator keeps the current multidimensional index and 
+    //! the corresponding offset in the original array. Incrementing or 
+    //! decrementing the iterator updates both like an odometer: the offset 
+    //! is advanced by the stride of the last dimension and only carries 
+    //! into the next dimension when the index wraps. No divisions are 
+    //! required for sequential access. Random jumps (+=, -=) recompute the 
+    //! index from the linear position.
+    //!
+    //! For contiguous views the index is not maintained at all and the 
+    //! offset is simply incremented.
+    //!
+    //! \tparam ITERABLE array_view type (can be const)
+    //!
+    template<typename ITERABLE> class array_view_iterator
+    {
+        private:
+            //! view type without const
+            typedef typename std::remove_const<ITERABLE>::type view_type;
+            //! index type
+            typedef std::vector<size_t> index_type;
+
+            //! pointer to the view
+            ITERABLE *_view;
+            //! linear position of the iterator in the view
+            ssize_t _state;
+            //! size of the view
+            ssize_t _maxsize;
+            //! offset of the current element in the original array
+            size_t _offset;
+            //! multidimensional index of the current element (slowest 
+            //! varying dimension first)
+            index_type _index;
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief set the iterator position
+            //!
+            //! Computes the multidimensional index and the offset in the 
+            //! original array for a linear position. Positions outside the 
+            //! view are mapped onto the first element.
+            //!
+            //! \param state new linear position
+            //!
+            void _set_state(ssize_t state)
+            {
+                _state = state;
+                if(!_view) return;
+
+                _offset = _view->_start_offset;
+                if(_view->_is_contiguous)
+                {
+                    _offset += _state;
+                    return;
+                }
+
+                size_t i = (state<0 || state>=_maxsize) ? 0 : size_t(state);
+                auto shape = _view->_linear_shape.end();
+                auto index = _index.rbegin();
+                for(auto stride = _view->_linear_strides.rbegin();
+                    stride!=_view->_linear_strides.rend();++stride,++index)
+                {
+                    size_t n = *(--shape);
+                    *index = i%n;
+                    _offset += (*index)*(*stride);
+                    i /= n;
+                }
+            }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief advance by one element
+            //!
+            void _increment()
+            {
+                ++_state;
+                if(_view->_is_contiguous) { ++_offset; return; }
+
+                auto shape = _view->_linear_shape.end();
+                auto index = _index.rbegin();
+                for(auto stride = _view->_linear_strides.rbegin();
+                    stride!=_view->_linear_strides.rend();++stride,++index)
+                {
+                    size_t n = *(--shape);
+                    _offset += *stride;
+                    if(++(*index)<n) return;
+
+                    //carry into the next dimension
+                    _offset -= n*(*stride);
+                    *index = 0;
+                }
+            }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief go back by one element
+            //!
+            void _decrement()
+            {
+                --_state;
+                if(_view->_is_contiguous) { --_offset; return; }
+
+                auto shape = _view->_linear_shape.end();
+                auto index = _index.rbegin();
+                for(auto stride = _view->_linear_strides.rbegin();
+                    stride!=_view->_linear_strides.rend();++stride,++index)
+                {
+                    size_t n = *(--shape);
+                    if(*index>0)
+                    {
+                        --(*index);
+                        _offset -= *stride;
+                        return;
+                    }
+
+                    //borrow from the next dimension
+                    *index = n-1;
+                    _offset += (n-1)*(*stride);
+                }
+            }
+
+        public:
+            //====================public types=================================
+            //! value type of the container
+            typedef typename view_type::value_type value_type;
+            //! pointer type the iterator provides
+            typedef typename std::conditional<std::is_const<ITERABLE>::value,
+                             const value_type*,value_type*>::type pointer;
+            //! reference type the iterator provides
+            typedef typename std::conditional<std::is_const<ITERABLE>::value,
+                             const value_type&,value_type&>::type reference;
+            //! difference type of the iterator
+            typedef ssize_t difference_type;
+            //! type of iterator
+            typedef std::random_access_iterator_tag iterator_category;
+            //! iterator type
+            typedef array_view_iterator<ITERABLE> iterator_type;
+
+            //================constructor and destructor=======================
+            //! default constructor
+            array_view_iterator():
+                _view(nullptr),
+                _state(0),
+                _maxsize(0),
+                _offset(0),
+                _index()
+            {}
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief standard constructor
+            //!
+            //! \param view pointer to the view
+            //! \param state initial linear position of the iterator
+            //!
+            explicit array_view_iterator(ITERABLE *view,size_t state=0):
+                _view(view),
+                _state(0),
+                _maxsize(view->size()),
+                _offset(0),
+                _index(view->_is_contiguous ? 0 : view->_strides.size(),0)
+            {
+                _set_state(state);
+            }
+
+            //=================public member functions=========================
+            //!
+            //! \brief check iterator validity
+            //!
+            //! \return true if the iterator points to an element of the view
+            //!
+            explicit operator bool() const
+            {
+                return !(!_view || (_state>=_maxsize) || (_state<0));
+            }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief dereferencing operator
+            //!
+            //! \throws iterator_error if the iterator is invalid
+            //! \return reference or value of the actual element
+            //!
+            typename std::conditional<std::is_const<ITERABLE>::value,
+                                      value_type,reference>::type
+            operator*()
+            {
+                if(!(*this))
+                    throw iterator_error(EXCEPTION_RECORD,"Iterator invalid!");
+
+                return _view->_parray.get()[_offset];
+            }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief dereferencing operator
+            //!
+            //! \throws iterator_error if the iterator is invalid
+            //! \return value of the actual element
+            //!
+            value_type operator*() const
+            {
+                if(!(*this))
+                    throw iterator_error(EXCEPTION_RECORD,"Iterator invalid!");
+
+                return _view->_parray.get()[_offset];
+            }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief pointer access operator
+            //!
+            //! \throws iterator_error if the iterator is invalid
+            //! \return pointer to the actual element
+            //!
+            pointer operator->()
+            {
+                if(!(*this))
+                    throw iterator_error(EXCEPTION_RECORD,"Iterator invalid!");
+
+                return &(_view->_parray.get()[_offset]);
+            }
+
+            //-----------------------------------------------------------------
+            //! increment iterator position
+            iterator_type &operator++()
+            {
+                _increment();
+                return *this;
+            }
+
+            //-----------------------------------------------------------------
+            //! increment iterator position
+            iterator_type operator++(int)
+            {
+                iterator_type temp = *this;
+                ++(*this);
+                return temp;
+            }
+
+            //-----------------------------------------------------------------
+            //! decrement operators
+            iterator_type &operator--()
+            {
+                _decrement();
+                return *this;
+            }
+
+            //-----------------------------------------------------------------
+            //! decrement operators
+            iterator_type operator--(int)
+            {
+                iterator_type tmp = *this;
+                --(*this);
+                return tmp;
+            }
+
+            //-----------------------------------------------------------------
+            //! compound assignment with +=
+            iterator_type &operator+=(ssize_t i)
+            {
+                _set_state(_state+i);
+                return *this;
+            }
+
+            //-----------------------------------------------------------------
+            //! compound assignment with -=
+            iterator_type &operator-=(ssize_t i)
+            {
+                _set_state(_state-i);
+                return *this;
+            }
+
+            //-----------------------------------------------------------------
+            //! random access to an element relative to the iterator
+            typename std::conditional<std::is_const<ITERABLE>::value,
+                                      value_type,reference>::type
+            operator[](ssize_t i) const
+            {
+                iterator_type tmp = *this;
+                tmp += i;
+                return *tmp;
+            }
+
+            //-----------------------------------------------------------------
+            //! comparsion operator - equality
+            bool operator==(const iterator_type &a) const 
+            {
+                return (_view == a._view) && (_state == a._state);
+            }
+
+            //-----------------------------------------------------------------
+            //! comparison operator - inequality
+            bool operator!=(const iterator_type &a) const
+            {
+                return !((*this)==a);
+            }
+
+            //-----------------------------------------------------------------
+            //! lesser than operator
+            bool operator<(const iterator_type &b) const
+            {
+                return _state < b._state;
+            }
+
+            //-----------------------------------------------------------------
+            //! lesser than equal operator
+            bool operator<=(const iterator_type &b) const
+            {
+                return _state <= b._state;
+            }
+
+            //-----------------------------------------------------------------
+            //! greater than operator
+            bool operator>(const iterator_type &b) const
+            {
+                return _state > b._state;
+            }
+
+            //-----------------------------------------------------------------
+            //! greater equal than operator
+            bool operator>=(const iterator_type &b) const
+            {
+                return _state >= b._state;
+            }
+
+            //-----------------------------------------------------------------
+            //! return the actual state (linear position) of the iterator
+            ssize_t state() const { return _state; }
+    };
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief add scalar to iterator
+    //!
+    //! \tparam ITER iterable type
+    //! \param a original iterator
+    //! \param b offset to add
+    //! \return new iterator
+    //!
+    template<typename ITER> 
+    array_view_iterator<ITER> operator+(const array_view_iterator<ITER> &a,
+                                        ssize_t b)
+    {
+        array_view_iterator<ITER> iter = a;
+        iter += b;
+        return iter;
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief add iterator to scalar
+    //!
+    //! \tparam ITER iterable type
+    //! \param a offset to add
+    //! \param b original iterator
+    //! \return new iterator
+    //!
+    template<typename ITER> 
+    array_view_iterator<ITER> operator+(ssize_t a, 
+                                        const array_view_iterator<ITER> &b)
+    {
+        return b+a;
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief subtract scalar from iterator
+    //!
+    //! \tparam ITER iterable type
+    //! \param a original iterator
+    //! \param b offset to subtract
+    //! \return new iterator
+    //!
+    template<typename ITER> 
+    array_view_iterator<ITER> operator-(const array_view_iterator<ITER> &a,
+                                        ssize_t b)
+    {
+        array_view_iterator<ITER> iter = a;
+        iter -= b;
+        return iter;
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief subtract two iterators
+    //! 
+    //! \tparam ITER iterable type
+    //! \param a first iterator
+    //! \param b second iterator
+    //! \return offset difference
+    //!
+    template<typename ITER> 
+    ssize_t operator-(const array_view_iterator<ITER> &a, 
+                      const array_view_iterator<ITER> &b)
+    {
+        return a.state() - b.state();
+    }
+
+//end of namespace
+}
+}
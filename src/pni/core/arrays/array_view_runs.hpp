@@ -0,0 +1,230 @@
+//
+// (c) Copyright 2026 DESY, Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+// This file is part of libpnicore.
+//
+// libpnicore is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpnicore is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpnicore.  If not, see <http://www.gnu.org/licenses/>.
+//
+// ============================================================================
+//
+// Created on: Oct 16, 2026
+//     Author: Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+
+#pragma once
+
+#include <vector>
+#include <type_traits>
+
+#include <pni/core/types/container_trait.hpp>
+#include <pni/core/arrays/array_view.hpp>
+
+namespace pni{
+namespace core{
+
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief splits an array view into contiguous runs
+    //!
+    //! The selection of a view is described by the shape of the view and 
+    //! the stride of every dimension in the storage of the parent array, 
+    //! both ordered from the slowest to the fastest varying dimension.
+    //! Two adjacent dimensions k-1 and k can be merged to a single dimension
+    //! if stride[k-1] = shape[k]*stride[k]. After all possible merges the 
+    //! innermost dimension (if its stride is 1) denotes a block of elements 
+    //! which is contiguous in memory. The outer dimensions are traversed 
+    //! with an odometer.
+    //!
+    //! \tparam VTYPE array view type (const for read only access)
+    //!
+    template<typename VTYPE> 
+    struct contiguous_run_decomposition
+    {
+        //! element type of the view
+        typedef typename VTYPE::value_type value_type;
+        //! parent array type 
+        typedef typename VTYPE::storage_type storage_type;
+        //! pointer type - const for views on const arrays 
+        typedef typename std::conditional<std::is_const<storage_type>::value||
+                                          std::is_const<VTYPE>::value,
+                                          const value_type*,
+                                          value_type*>::type pointer_type;
+
+        //! shape of the merged dimensions
+        std::vector<size_t> shape;
+        //! strides of the merged dimensions 
+        std::vector<size_t> strides;
+        //! pointer to the first element of the view
+        pointer_type origin;
+
+        //---------------------------------------------------------------------
+        //!
+        //! \brief constructor
+        //!
+        //! Merges all dimensions of the view which are contiguous in the 
+        //! storage of the parent array.
+        //!
+        //! \param view reference to the view
+        //!
+        explicit contiguous_run_decomposition(VTYPE &view):
+            shape(),
+            strides(),
+            origin(view._parray.get().data()+view._start_offset)
+        {
+            static_assert(container_trait<
+                          typename std::remove_const<storage_type>::type
+                          >::is_contiguous,
+                          "Parent array must have contiguous storage!");
+
+            if(view._is_contiguous)
+            {
+                shape.push_back(view.size());
+                strides.push_back(1);
+                return;
+            }
+
+            auto s = view._linear_shape.begin();
+            for(auto stride: view._linear_strides)
+            {
+                size_t n = *s++;
+                if(!shape.empty() && strides.back()==n*stride)
+                {
+                    shape.back() *= n;
+                    strides.back() = stride;
+                }
+                else
+                {
+                    shape.push_back(n);
+                    strides.push_back(stride);
+                }
+            }
+        }
+
+        //---------------------------------------------------------------------
+        //!
+        //! \brief length of a single run
+        //!
+        //! \return number of contiguous elements in a run
+        //!
+        size_t run_length() const
+        {
+            return strides.back()==1 ? shape.back() : 1;
+        }
+
+        //---------------------------------------------------------------------
+        //!
+        //! \brief iterate over runs
+        //!
+        //! Calls f(ptr,n) for every contiguous run of the view in storage 
+        //! order. 
+        //!
+        //! \tparam FUNC callable type
+        //! \param f callable
+        //!
+        template<typename FUNC> void for_each(FUNC &&f) const
+        {
+            size_t length = run_length();
+            //number of dimensions traversed by the odometer
+            size_t rank = strides.back()==1 ? shape.size()-1 : shape.size();
+
+            size_t total = 1;
+            for(auto n: shape) total *= n;
+            if(!total) return;
+
+            std::vector<size_t> index(rank,0);
+            pointer_type ptr = origin;
+            for(size_t run=0;run<total/length;++run)
+            {
+                f(ptr,length);
+
+                //increment the odometer
+                for(size_t d=rank;d!=0;--d)
+                {
+                    ptr += strides[d-1];
+                    if(++index[d-1]!=shape[d-1]) break;
+
+                    ptr -= shape[d-1]*strides[d-1];
+                    index[d-1] = 0;
+                }
+            }
+        }
+    };
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_classes
+    //! \brief apply a function to all contiguous runs of a view
+    //!
+    //! Splits the selection of a view into maximal blocks of elements which 
+    //! are contiguous in the memory of the parent array and calls f(ptr,n) 
+    //! for each of them in storage order. ptr is a pointer to the first 
+    //! element of the run and n the number of elements in it. 
+    //! Fastest varying dimensions which are contiguous in the parent are 
+    //! merged. 
+    //! For a view selecting a row range of an image stack every run thus 
+    //! covers a full block of rows. 
+    //!
+    /*!
+    \code
+    auto view = stack(slice(0,100),slice(10,20),slice(0,2048));
+
+    //copy the view to a buffer
+    float64 *dest = buffer.data();
+    for_each_contiguous_run(view,[&dest](const float64 *ptr,size_t n)
+    {
+        std::copy(ptr,ptr+n,dest);
+        dest += n;
+    });
+    \endcode
+    !*/
+    //!
+    //! \tparam ATYPE parent array type
+    //! \tparam FUNC callable with signature void(pointer,size_t)
+    //! \param view the view to decompose
+    //! \param f callable applied to each run
+    //!
+    template<
+             typename ATYPE,
+             typename FUNC
+            >
+    void for_each_contiguous_run(array_view<ATYPE> &view,FUNC &&f)
+    {
+        contiguous_run_decomposition<array_view<ATYPE>>(view).for_each(f);
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_classes
+    //! \brief apply a function to all contiguous runs of a const view
+    //!
+    //! Same as above but passes const pointers to f. 
+    //!
+    //! \tparam ATYPE parent array type
+    //! \tparam FUNC callable with signature void(const pointer,size_t)
+    //! \param view the view to decompose
+    //! \param f callable applied to each run
+    //!
+    template<
+             typename ATYPE,
+             typename FUNC
+            >
+    void for_each_contiguous_run(const array_view<ATYPE> &view,FUNC &&f)
+    {
+        typedef const array_view<ATYPE> view_type;
+        contiguous_run_decomposition<view_type>(view).for_each(f);
+    }
+
+//end of namespace
+}
+}
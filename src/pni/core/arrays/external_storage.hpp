@@ -0,0 +1,268 @@
+//
+// (c) Copyright 2026 DESY, Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+// This file is part of libpnicore.
+//
+// libpnicore is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpnicore is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpnicore.  If not, see <http://www.gnu.org/licenses/>.
+//
+// ============================================================================
+//
+// Created on: Oct 16, 2026
+//     Author: Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+#pragma once
+
+#include <memory>
+#include <iterator>
+#include <sstream>
+
+#include <pni/core/types/types.hpp>
+#include <pni/core/types/container_trait.hpp>
+#include <pni/core/error/exceptions.hpp>
+
+namespace pni{
+namespace core{
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_classes
+    //! \brief storage for external memory
+    //!
+    //! A contiguous storage type for mdarray referring to memory owned by 
+    //! somebody else - for instance a DMA buffer, a shared memory segment 
+    //! or a buffer provided by another library. Wrapping a buffer does not 
+    //! copy any data. The owner must keep the memory alive as long as any 
+    //! storage refers to it. Copies of a storage refer to the same memory.
+    //!
+    //! mdarray has to allocate new storage for instance when it is 
+    //! constructed from a view or an expression. Storages created from a 
+    //! number of elements (as container_utils does) thus own a reference 
+    //! counted buffer.
+    /*!
+    \code
+    typedef mdarray<external_storage<uint16>,dynamic_cindex_map> array_type;
+    typedef array_factory<array_type> factory_type;
+
+    uint16 *buffer = receiver.next_frame();
+    auto frame = factory_type::wrap(shape_t{2048,2048},buffer);
+    \endcode
+    */
+    //!
+    //! \tparam T element type
+    //!
+    template<typename T> class external_storage
+    {
+        private:
+            //! buffer owned by the storage (empty for external memory)
+            std::shared_ptr<T> _buffer;
+            //! pointer to the first element
+            T *_data;
+            //! number of elements
+            size_t _size;
+        public:
+            //================public types=====================================
+            //! element type
+            typedef T value_type;
+            //! iterator type
+            typedef T *iterator;
+            //! const iterator type
+            typedef const T *const_iterator;
+            //! reverse iterator type
+            typedef std::reverse_iterator<iterator> reverse_iterator;
+            //! const reverse iterator type
+            typedef std::reverse_iterator<const_iterator>
+                    const_reverse_iterator;
+
+            //================constructors=====================================
+            //! default constructor - an empty storage
+            external_storage():
+                _buffer(),
+                _data(nullptr),
+                _size(0)
+            {}
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief construct owning storage
+            //!
+            //! Allocates a buffer for n elements which is released when the 
+            //! last storage referring to it is destroyed.
+            //!
+            //! \param n number of elements
+            //!
+            explicit external_storage(size_t n):
+                _buffer(new T[n](),std::default_delete<T[]>()),
+                _data(_buffer.get()),
+                _size(n)
+            {}
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief wrap external memory
+            //!
+            //! \param ptr pointer to the first element
+            //! \param n number of elements
+            //!
+            external_storage(T *ptr,size_t n):
+                _buffer(),
+                _data(ptr),
+                _size(n)
+            {}
+
+            //================public member functions==========================
+            //! get number of elements
+            size_t size() const { return _size; }
+
+            //-----------------------------------------------------------------
+            //! get pointer to the data
+            T *data() { return _data; }
+
+            //-----------------------------------------------------------------
+            //! get const pointer to the data
+            const T *data() const { return _data; }
+
+            //-----------------------------------------------------------------
+            //! get reference to element i
+            T &operator[](size_t i) { return _data[i]; }
+
+            //-----------------------------------------------------------------
+            //! get value of element i
+            const T &operator[](size_t i) const { return _data[i]; }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief get reference to element i with index check
+            //!
+            //! \throws index_error if i exceeds the size of the storage
+            //! \param i index of the element
+            //! \return reference to the element
+            //!
+            T &at(size_t i)
+            {
+                check_index(i);
+                return _data[i];
+            }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief get value of element i with index check
+            //!
+            //! \throws index_error if i exceeds the size of the storage
+            //! \param i index of the element
+            //! \return reference to the element
+            //!
+            const T &at(size_t i) const
+            {
+                check_index(i);
+                return _data[i];
+            }
+
+            //-----------------------------------------------------------------
+            //! get reference to the first element
+            T &front() { return _data[0]; }
+
+            //-----------------------------------------------------------------
+            //! get reference to the first element
+            const T &front() const { return _data[0]; }
+
+            //-----------------------------------------------------------------
+            //! get reference to the last element
+            T &back() { return _data[_size-1]; }
+
+            //-----------------------------------------------------------------
+            //! get reference to the last element
+            const T &back() const { return _data[_size-1]; }
+
+            //-----------------------------------------------------------------
+            //! get iterator to the first element
+            iterator begin() { return _data; }
+
+            //-----------------------------------------------------------------
+            //! get iterator to the last element
+            iterator end() { return _data+_size; }
+
+            //-----------------------------------------------------------------
+            //! get const iterator to the first element
+            const_iterator begin() const { return _data; }
+
+            //-----------------------------------------------------------------
+            //! get const iterator to the last element
+            const_iterator end() const { return _data+_size; }
+
+            //-----------------------------------------------------------------
+            //! get reverse iterator to the last element
+            reverse_iterator rbegin() { return reverse_iterator(end()); }
+
+            //-----------------------------------------------------------------
+            //! get reverse iterator to the first element
+            reverse_iterator rend() { return reverse_iterator(begin()); }
+
+            //-----------------------------------------------------------------
+            //! get const reverse iterator to the last element
+            const_reverse_iterator rbegin() const
+            {
+                return const_reverse_iterator(end());
+            }
+
+            //-----------------------------------------------------------------
+            //! get const reverse iterator to the first element
+            const_reverse_iterator rend() const
+            {
+                return const_reverse_iterator(begin());
+            }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief check if the storage owns its memory
+            //!
+            //! \return true if the memory was allocated by the storage, false
+            //! if it refers to external memory
+            //!
+            bool owns_memory() const { return bool(_buffer); }
+
+        private:
+            //-----------------------------------------------------------------
+            //! throw index_error if i is out of bounds
+            void check_index(size_t i) const
+            {
+                if(i<_size) return;
+
+                std::stringstream ss;
+                ss<<"Index "<<i<<" exceeds storage size ("<<_size<<")!";
+                throw index_error(EXCEPTION_RECORD,ss.str());
+            }
+    };
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup type_classes
+    //! \brief container trait for external_storage
+    //!
+    //! \tparam T element type
+    //!
+    template<typename T> struct container_trait<external_storage<T>>
+    {
+        //! external_storage provides random access
+        static const bool is_random_access = true;
+        //! external_storage is iterable
+        static const bool is_iterable   = true;
+        //! external_storage is contiguous
+        static const bool is_contiguous = true;
+        //! external_storage is not multidimensional
+        static const bool is_multidim   = false;
+    };
+
+//end of namespace
+}
+}
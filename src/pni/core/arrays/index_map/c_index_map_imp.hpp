@@ -265,6 +265,25 @@ namespace core{
                 index(shape.begin(),shape.end(),idx.begin(),offset); 
             }
 
+            //-----------------------------------------------------------------
+            //!
+            //! \brief order dimensions by their variation
+            //!
+            //! Returns a copy of per-dimension data (like a shape or 
+            //! strides) with the slowest varying dimension first and the 
+            //! fastest varying dimension last. For a C map this is the 
+            //! index order.
+            //!
+            //! \tparam CTYPE container type
+            //! \param c per-dimension data in index order
+            //! \return data in linear order
+            //!
+            template<typename CTYPE> 
+            static CTYPE linear_order(const CTYPE &c)
+            {
+                return c;
+            }
+
 
     };
 //end of namespace
@@ -0,0 +1,239 @@
+//
+// (c) Copyright 2026 DESY, Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+// This file is part of libpnicore.
+//
+// libpnicore is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpnicore is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpnicore.  If not, see <http://www.gnu.org/licenses/>.
+//
+// ============================================================================
+// 
+// Created on: Oct 16, 2026
+//     Author: Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+
+#pragma once
+
+#include <numeric>
+#include <algorithm>
+#include <functional>
+
+
+namespace pni{
+namespace core{
+
+    //!
+    //! \ingroup index_mapping_classes
+    //! \brief Fortran index map implementation
+    //! 
+    //! This class implements common functions for Fortran (column major)
+    //! index maps. Indices are mapped to a linear offset with the first 
+    //! index varying fastest. Thus the elements of a 3x2 array are stored 
+    //! in the order (0,0), (1,0), (2,0), (0,1), (1,1), (2,1).
+    //! 
+    class f_index_map_imp
+    {
+        private:
+            //!
+            //! \brief compute the offset 
+            //! 
+            //! Compute the offset for an index range and a given shape.
+            //!
+            //! \tparam IITERT index iterator type
+            //! \tparam SITERT shape iterator type
+            //! \param index_start start iterator for the index range
+            //! \param index_stop   stop iterator for the index range
+            //! \param shape_start start iterator for the shape range
+            //! \return offset value
+            //! 
+            template<typename IITERT,
+                     typename SITERT> 
+            static size_t offset(IITERT &&index_start,
+                                 IITERT &&index_stop, 
+                                 SITERT &&shape_start)
+            {
+                size_t offset = *index_start++,stride=1;
+
+                while(index_start!=index_stop)
+                {
+                    stride *= *shape_start++;
+                    offset += stride*(*index_start++);
+                }
+
+                return offset;
+            }
+
+            //------------------------------------------------------------------
+            //!
+            //! \brief compute selection offset 
+            //! 
+            //! Compute the linear offset for an index range and a particular
+            //! selection. The index passed is the effective index of the 
+            //! selection and must not have the same rank as the original 
+            //! array.
+            //!
+            //! \tparam SELITER selection iterator
+            //! \tparam SITER   iterator type of the original shape
+            //! \tparam IITER   index container iterator
+            //! \param sel_shape_start begin of selection shape
+            //! \param sel_shape_end   end of selection shape
+            //! \param sel_offset begin of selection offset
+            //! \param sel_stride begin of selection stride
+            //! \param shape_start begin of original shape
+            //! \param sel_index begin of selection index
+            //! \return linear offset
+            //!
+            template<
+                     typename SELITER,
+                     typename SITER,
+                     typename IITER
+                    > 
+            static size_t offset(SELITER &&sel_shape_start,
+                                 SELITER &&sel_shape_end,
+                                 SELITER &&sel_offset, 
+                                 SELITER &&sel_stride,
+                                 SITER   &&shape_start,
+                                 IITER   &&sel_index)
+            {
+                size_t offset = 0,dim_stride=1;
+
+                while(sel_shape_start!=sel_shape_end)
+                {
+                    //compute the index from the selection
+                    size_t index = *sel_offset++;
+                    if(*sel_shape_start++ != 1) 
+                        index += (*sel_index++)*(*sel_stride);
+
+                    ++sel_stride; 
+
+                    offset += dim_stride*index;
+                    dim_stride *= *shape_start++;
+                }
+
+                return offset;
+            }
+
+        public:
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief compute the offset
+            //!
+            //! Compute the linear offset for a given shape and index. The 
+            //! functions assumes that the index and the shape container are 
+            //! of equal size.  However, this must be ensured by the calling 
+            //! function.
+            //!
+            //! \tparam CSHAPE container type for the shape data
+            //! \tparam CINDEX container type for the index data
+            //! \param shape instance of CSHAPE with shape data
+            //! \param index instance of CINDEX with index data
+            //! \return linear offset
+            //!
+            template<
+                     typename CSHAPE,
+                     typename CINDEX
+                    >
+            static size_t offset(const CSHAPE &shape,const CINDEX &index)
+            {
+                //forward iterators as the first index varies fastest
+                return offset(index.begin(),index.end(),shape.begin());
+            }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief compute offset for selection
+            //! 
+            //! Computes the linear offset for a given selection index. The
+            //! selection index is not required to have the same rank as the
+            //! original array. 
+            //! 
+            //! \tparam SELTYPE selection type
+            //! \tparam CSHAPE original shape of the array
+            //! \tparam SINDEX selection index type
+            //! \param sel reference to the selection
+            //! \param shape the original shape
+            //! \param index selection index
+            //! \return linear offset
+            //!
+            template<
+                     typename SELTYPE,
+                     typename CSHAPE,
+                     typename SINDEX
+                    >
+            static size_t offset(const SELTYPE &sel,const CSHAPE &shape,
+                                 const SINDEX &index)
+            {
+                return offset(sel.full_shape().begin(),
+                              sel.full_shape().end(),
+                              sel.offset().begin(),
+                              sel.stride().begin(),
+                              shape.begin(),
+                              index.begin());
+            }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief compute index
+            //!
+            //! Compute the multidimensional index for a given shape and 
+            //! offset. The function assumes that the index container is of 
+            //! appropriate size (the size of the shape container) which must
+            //! be ensured by the calling function.
+            //! 
+            //! \tparam CINDEX container type for index values
+            //! \tparam CSHAPE container type for shape values
+            //! \param shape instance of CSHAPE with shape information
+            //! \param idx instance of CINDEX for index data
+            //! \param offset linear offset 
+            //!
+            template<
+                     typename CINDEX,
+                     typename CSHAPE
+                    >
+            static void index(const CSHAPE &shape,CINDEX &idx,size_t offset)
+            {
+                size_t stride = std::accumulate(shape.begin(),shape.end(),
+                                                size_t(1),
+                                                std::multiplies<size_t>());
+                auto i = idx.rbegin();
+                for(auto s = shape.rbegin();s!=shape.rend();++s,++i)
+                {
+                    stride /= *s;
+                    *i = offset/stride;
+                    offset %= stride;
+                }
+            }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief order dimensions by their variation
+            //!
+            //! Returns a copy of per-dimension data (like a shape or 
+            //! strides) with the slowest varying dimension first and the 
+            //! fastest varying dimension last. For a Fortran map this 
+            //! reverses the container.
+            //!
+            //! \tparam CTYPE container type
+            //! \param c per-dimension data in index order
+            //! \return data in linear order
+            //!
+            template<typename CTYPE> 
+            static CTYPE linear_order(const CTYPE &c)
+            {
+                return CTYPE(c.rbegin(),c.rend());
+            }
+    };
+//end of namespace
+}
+}
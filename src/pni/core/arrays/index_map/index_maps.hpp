@@ -24,11 +24,14 @@
 
 #pragma once
 #include <sstream>
+#include <type_traits>
 #include <boost/lexical_cast.hpp>
 #include <pni/core/arrays/index_map/index_map.hpp>
 #include <pni/core/arrays/index_map/static_index_map.hpp>
 #include <pni/core/arrays/index_map/c_index_map_imp.hpp>
+#include <pni/core/arrays/index_map/f_index_map_imp.hpp>
 #include <pni/core/utilities/container_utils.hpp>
+#include <pni/core/types/container_trait.hpp>
 
 namespace pni{
 namespace core{
@@ -80,6 +83,116 @@ namespace core{
     template<size_t NDIMS> 
     using fixed_dim_cindex_map = index_map<std::array<size_t,NDIMS>,c_index_map_imp>;
 
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup index_mapping_classes
+    //! \brief template for a static Fortran map
+    //!  
+    //! A template alias for a static index map with Fortran (column major)
+    //! ordering. 
+    //! 
+    //! \code
+    //! static_fmap<3,3> matrix_map; 
+    //! \endcode
+    //! 
+    //! \tparam DIMS number of elements along each dimension
+    //! 
+    template<size_t... DIMS> 
+    using static_fmap = static_index_map<f_index_map_imp,DIMS...>;
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup index_mapping_classes
+    //! \brief definition of a dynamic Fortran index map
+    //!  
+    //! Type definition of a fully dynamic Fortran index map. Use this map 
+    //! for data shared with Fortran or column major libraries. 
+    //!
+    //! \code
+    //! typedef mdarray<std::vector<float64>,dynamic_fmap> matrix_type;
+    //! \endcode
+    //!
+    //! Arrays with different storage order cannot be mixed in arithmetic 
+    //! expressions, copies or comparisons (see has_same_storage_order). 
+    //! Use permute_copy with the identity permutation to convert between 
+    //! storage orders.
+    //! 
+    typedef index_map<std::vector<size_t>,f_index_map_imp> dynamic_fmap;
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup index_mapping_classes
+    //! \brief fixed dimension dynamic Fortran index map
+    //! 
+    //! Like fixed_dim_cindex_map but with the first index varying fastest.
+    //!
+    //! \tparam NDIMS number of dimensions
+    template<size_t NDIMS> 
+    using fixed_dim_fmap = index_map<std::array<size_t,NDIMS>,f_index_map_imp>;
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup index_mapping_classes
+    //! \brief storage order of a type
+    //!
+    //! For array types (mdarray and array_view) type is the implementation
+    //! of the index map. For all other types (scalars, STL containers) it 
+    //! is void.
+    //!
+    //! \tparam T type to check
+    //!
+    template<
+             typename T,
+             bool IS_ARRAY = container_trait<T>::is_multidim
+            > 
+    struct storage_order
+    {
+        //! no storage order
+        typedef void type;
+    };
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup index_mapping_classes
+    //! \brief storage order of an array type
+    //!
+    template<typename T> 
+    struct storage_order<T,true>
+    {
+        //! index map implementation of the array
+        typedef typename T::map_type::implementation_type type;
+    };
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup index_mapping_classes
+    //! \brief check if two types can be combined element by element
+    //!
+    //! Copies, expressions and comparisons combine two arrays by their 
+    //! linear storage index. For arrays with different storage order this 
+    //! would silently transpose the data. value is false in this case. 
+    //! Operands which are not arrays are compatible with every array.
+    //!
+    //! \tparam ATYPE first operand type
+    //! \tparam BTYPE second operand type
+    //!
+    template<
+             typename ATYPE,
+             typename BTYPE
+            >
+    struct has_same_storage_order
+    {
+        //! storage order of the first operand
+        typedef typename storage_order<ATYPE>::type a_order;
+        //! storage order of the second operand
+        typedef typename storage_order<BTYPE>::type b_order;
+
+        //! true if the operands can be combined
+        static const bool value = std::is_void<a_order>::value ||
+                                  std::is_void<b_order>::value ||
+                                  std::is_same<a_order,b_order>::value;
+    };
+
     //=================define some convienance function========================
 
     /*!
@@ -0,0 +1,203 @@
+//
+// (c) Copyright 2026 DESY, Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+// This file is part of libpnicore.
+//
+// libpnicore is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpnicore is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpnicore.  If not, see <http://www.gnu.org/licenses/>.
+//
+// ============================================================================
+//
+// Created on: Oct 16, 2026
+//     Author: Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+
+#include <cstring>
+#include <cerrno>
+#include <cstdint>
+#include <pni/core/arrays/mapped_storage.hpp>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#define PNI_CORE_MMAP
+#endif
+
+namespace pni{
+namespace core{
+
+#ifdef PNI_CORE_MMAP
+    namespace {
+        //! size of a memory page
+        size_t page_size()
+        {
+            static const size_t size = size_t(sysconf(_SC_PAGESIZE));
+            return size;
+        }
+
+        //! description of the last system error
+        string system_error(const string &message)
+        {
+            return message+" ("+std::strerror(errno)+")!";
+        }
+
+        //! closes a file descriptor when leaving the scope
+        struct file_guard
+        {
+            int fd;
+            ~file_guard() { if(fd>=0) close(fd); }
+        };
+    }
+#endif
+
+    //-------------------------------------------------------------------------
+    file_mapping::file_mapping(size_t bytes):
+        _address(nullptr),
+        _length(bytes),
+        _data(nullptr),
+        _size(bytes),
+        _mode(map_mode::COPY_ON_WRITE)
+    {
+        if(!bytes) return;
+
+#ifdef PNI_CORE_MMAP
+        _address = mmap(nullptr,_length,PROT_READ|PROT_WRITE,
+                        MAP_PRIVATE|MAP_ANONYMOUS,-1,0);
+        if(_address==MAP_FAILED)
+            throw memory_allocation_error(EXCEPTION_RECORD,
+                    system_error("Cannot map anonymous memory"));
+        _data = static_cast<char*>(_address);
+#else
+        throw not_implemented_error(EXCEPTION_RECORD,
+                "Memory mapping is not supported on this platform!");
+#endif
+    }
+
+    //-------------------------------------------------------------------------
+    file_mapping::file_mapping(const string &path,map_mode mode,size_t offset,
+                               size_t bytes):
+        _address(nullptr),
+        _length(0),
+        _data(nullptr),
+        _size(bytes),
+        _mode(mode)
+    {
+#ifdef PNI_CORE_MMAP
+        int flags = mode==map_mode::SHARED ? O_RDWR|O_CREAT : O_RDONLY;
+        file_guard file{open(path.c_str(),flags,0644)};
+        if(file.fd<0)
+            throw file_error(EXCEPTION_RECORD,
+                    system_error("Cannot open file ["+path+"]"));
+
+        struct stat info;
+        if(fstat(file.fd,&info)!=0)
+            throw file_error(EXCEPTION_RECORD,
+                    system_error("Cannot stat file ["+path+"]"));
+        size_t file_size = size_t(info.st_size);
+
+        if(!_size) _size = file_size>offset ? file_size-offset : 0;
+
+        if(offset+_size>file_size)
+        {
+            if(mode!=map_mode::SHARED)
+            {
+                std::stringstream ss;
+                ss<<"File ["<<path<<"] has "<<file_size<<" bytes - cannot "
+                  <<"map "<<_size<<" bytes at offset "<<offset<<"!";
+                throw size_mismatch_error(EXCEPTION_RECORD,ss.str());
+            }
+
+            if(ftruncate(file.fd,off_t(offset+_size))!=0)
+                throw file_error(EXCEPTION_RECORD,
+                        system_error("Cannot resize file ["+path+"]"));
+        }
+
+        if(!_size) return;
+
+        //the offset passed to mmap must be page aligned
+        size_t shift = offset%page_size();
+        _length = _size+shift;
+
+        int protection = mode==map_mode::READ_ONLY ? PROT_READ
+                                                   : PROT_READ|PROT_WRITE;
+        int visibility = mode==map_mode::SHARED ? MAP_SHARED : MAP_PRIVATE;
+        _address = mmap(nullptr,_length,protection,visibility,file.fd,
+                        off_t(offset-shift));
+        if(_address==MAP_FAILED)
+        {
+            _address = nullptr;
+            throw file_error(EXCEPTION_RECORD,
+                    system_error("Cannot map file ["+path+"]"));
+        }
+        _data = static_cast<char*>(_address)+shift;
+#else
+        (void)path;
+        (void)offset;
+        throw not_implemented_error(EXCEPTION_RECORD,
+                "Memory mapping is not supported on this platform!");
+#endif
+    }
+
+    //-------------------------------------------------------------------------
+    file_mapping::~file_mapping()
+    {
+#ifdef PNI_CORE_MMAP
+        if(_address) munmap(_address,_length);
+#endif
+    }
+
+    //-------------------------------------------------------------------------
+    void file_mapping::advise(map_advice advice,size_t offset,
+                              size_t bytes) const
+    {
+#ifdef PNI_CORE_MMAP
+        if(!_address || offset>=_size) return;
+        if(offset+bytes>_size) bytes = _size-offset;
+
+        //madvise requires a page aligned address
+        uintptr_t begin = reinterpret_cast<uintptr_t>(_data+offset);
+        uintptr_t start = begin/page_size()*page_size();
+
+        int flag = MADV_NORMAL;
+        switch(advice)
+        {
+            case map_advice::SEQUENTIAL: flag = MADV_SEQUENTIAL; break;
+            case map_advice::RANDOM:     flag = MADV_RANDOM;     break;
+            case map_advice::WILLNEED:   flag = MADV_WILLNEED;   break;
+            default: break;
+        }
+        madvise(reinterpret_cast<void*>(start),bytes+(begin-start),flag);
+#else
+        (void)advice;
+        (void)offset;
+        (void)bytes;
+#endif
+    }
+
+    //-------------------------------------------------------------------------
+    void file_mapping::sync() const
+    {
+#ifdef PNI_CORE_MMAP
+        if(!_address || _mode!=map_mode::SHARED) return;
+
+        if(msync(_address,_length,MS_SYNC)!=0)
+            throw file_error(EXCEPTION_RECORD,
+                    system_error("Cannot write mapped data to file"));
+#endif
+    }
+
+//end of namespace
+}
+}
@@ -0,0 +1,453 @@
+//
+// (c) Copyright 2026 DESY, Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+// This file is part of libpnicore.
+//
+// libpnicore is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpnicore is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpnicore.  If not, see <http://www.gnu.org/licenses/>.
+//
+// ============================================================================
+//
+// Created on: Oct 16, 2026
+//     Author: Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+#pragma once
+
+#include <memory>
+#include <iterator>
+#include <sstream>
+
+#include <pni/core/types/types.hpp>
+#include <pni/core/types/container_trait.hpp>
+#include <pni/core/error/exceptions.hpp>
+#include <pni/core/windows.hpp>
+
+namespace pni{
+namespace core{
+
+    //!
+    //! \ingroup mdim_array_classes
+    //! \brief file mapping modes
+    //!
+    enum class map_mode { READ_ONLY,     //!< read only access
+                          COPY_ON_WRITE, //!< writes are not stored in the file
+                          SHARED         //!< writes are stored in the file
+                        };
+
+    //!
+    //! \ingroup mdim_array_classes
+    //! \brief access pattern hints for mapped memory
+    //!
+    enum class map_advice { NORMAL,     //!< no particular access pattern
+                            SEQUENTIAL, //!< pages are accessed in order
+                            RANDOM,     //!< pages are accessed randomly
+                            WILLNEED    //!< pages will be accessed soon
+                          };
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_internal_classes
+    //! \brief memory mapping of a file
+    //!
+    //! Maps a region of a file into memory. Pages are loaded by the
+    //! operating system on first access. Thus creating a mapping is cheap
+    //! regardless of the size of the region. The mapping is removed
+    //! when the instance is destroyed.
+    //!
+    //! If no file is given an anonymous, private mapping is created.
+    //!
+    class PNICORE_EXPORT file_mapping
+    {
+        private:
+            //! page aligned address of the mapping
+            void *_address;
+            //! length of the mapping in bytes
+            size_t _length;
+            //! pointer to the first byte of the requested region
+            char *_data;
+            //! size of the requested region in bytes
+            size_t _size;
+            //! mapping mode
+            map_mode _mode;
+        public:
+            //-----------------------------------------------------------------
+            //!
+            //! \brief create an anonymous mapping
+            //!
+            //! \throws memory_allocation_error if the mapping fails
+            //! \param bytes size of the mapping in bytes
+            //!
+            explicit file_mapping(size_t bytes);
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief map a file
+            //!
+            //! If bytes is 0 the file is mapped from offset to its end. In
+            //! SHARED mode the file is created or extended if it is too
+            //! short.
+            //!
+            //! \throws file_error if the file cannot be opened or mapped
+            //! \throws size_mismatch_error if the file is too short
+            //! \param path path to the file
+            //! \param mode mapping mode
+            //! \param offset offset of the region in bytes
+            //! \param bytes size of the region in bytes
+            //!
+            file_mapping(const string &path,map_mode mode,size_t offset,
+                         size_t bytes);
+
+            //-----------------------------------------------------------------
+            //! destructor
+            ~file_mapping();
+
+            //-----------------------------------------------------------------
+            //! copy constructor - deleted
+            file_mapping(const file_mapping &) = delete;
+
+            //-----------------------------------------------------------------
+            //! copy assignment - deleted
+            file_mapping &operator=(const file_mapping &) = delete;
+
+            //-----------------------------------------------------------------
+            //! get pointer to the mapped region
+            char *data() const { return _data; }
+
+            //-----------------------------------------------------------------
+            //! get size of the mapped region in bytes
+            size_t size() const { return _size; }
+
+            //-----------------------------------------------------------------
+            //! get mapping mode
+            map_mode mode() const { return _mode; }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief advise access pattern
+            //!
+            //! Passes a hint about the access pattern of a part of the
+            //! region to the operating system. Failures are ignored as
+            //! this is only a hint.
+            //!
+            //! \param advice the access pattern
+            //! \param offset offset of the part in bytes
+            //! \param bytes size of the part in bytes
+            //!
+            void advise(map_advice advice,size_t offset,size_t bytes) const;
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief flush modifications
+            //!
+            //! Writes modified pages of a SHARED mapping back to the file.
+            //!
+            //! \throws file_error if writing fails
+            //!
+            void sync() const;
+    };
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup mdim_array_classes
+    //! \brief storage backed by a memory mapped file
+    //!
+    //! A contiguous storage type for mdarray whose elements are stored in a
+    //! file. Opening a file is O(1) as data is only read when it is
+    //! accessed. The file must contain the raw elements in native byte
+    //! order.
+    //!
+    //! The mapping is reference counted - copies of a storage refer to the
+    //! same memory. Storages created from a number of elements (as it is
+    //! done for instance by container_utils) use anonymous memory.
+    //!
+    //! Writing to a storage in READ_ONLY mode causes a segmentation fault.
+    //! In COPY_ON_WRITE mode modified pages are private to the process.
+    //! In SHARED mode modifications are written to the file.
+    /*!
+    \code
+    typedef mdarray<mapped_storage<uint16>,dynamic_cindex_map> array_type;
+    typedef array_factory<array_type> factory_type;
+
+    auto frames = factory_type::map(shape_t{10000,2048,2048},"frames.raw");
+    frames.storage().advise(map_advice::SEQUENTIAL);
+    \endcode
+    */
+    //!
+    //! \tparam T element type
+    //!
+    template<typename T> class mapped_storage
+    {
+        private:
+            //! the mapping
+            std::shared_ptr<file_mapping> _mapping;
+            //! pointer to the first element
+            T *_data;
+            //! number of elements
+            size_t _size;
+
+            //-----------------------------------------------------------------
+            //! compute number of elements
+            static size_t elements(const std::shared_ptr<file_mapping> &m)
+            {
+                return m ? m->size()/sizeof(T) : 0;
+            }
+
+            //-----------------------------------------------------------------
+            //! get pointer to the first element
+            static T *pointer(const std::shared_ptr<file_mapping> &m)
+            {
+                return m ? reinterpret_cast<T*>(m->data()) : nullptr;
+            }
+        public:
+            //================public types=====================================
+            //! element type
+            typedef T value_type;
+            //! iterator type
+            typedef T *iterator;
+            //! const iterator type
+            typedef const T *const_iterator;
+            //! reverse iterator type
+            typedef std::reverse_iterator<iterator> reverse_iterator;
+            //! const reverse iterator type
+            typedef std::reverse_iterator<const_iterator>
+                    const_reverse_iterator;
+
+            //================constructors=====================================
+            //! default constructor - an empty storage
+            mapped_storage():
+                _mapping(),
+                _data(nullptr),
+                _size(0)
+            {}
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief construct anonymous storage
+            //!
+            //! \throws memory_allocation_error if the mapping fails
+            //! \param n number of elements
+            //!
+            explicit mapped_storage(size_t n):
+                _mapping(n ? std::make_shared<file_mapping>(n*sizeof(T))
+                           : nullptr),
+                _data(pointer(_mapping)),
+                _size(elements(_mapping))
+            {}
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief map a file
+            //!
+            //! If n is 0 all elements from offset to the end of the file
+            //! are mapped.
+            //!
+            //! \throws file_error if the file cannot be opened or mapped
+            //! \throws size_mismatch_error if the file is too short
+            //! \param path path to the file
+            //! \param mode mapping mode
+            //! \param n number of elements
+            //! \param offset offset of the first element in bytes
+            //!
+            explicit mapped_storage(const string &path,
+                                    map_mode mode = map_mode::READ_ONLY,
+                                    size_t n = 0,
+                                    size_t offset = 0):
+                _mapping(std::make_shared<file_mapping>(path,mode,offset,
+                                                        n*sizeof(T))),
+                _data(pointer(_mapping)),
+                _size(elements(_mapping))
+            {}
+
+            //================public member functions==========================
+            //! get number of elements
+            size_t size() const { return _size; }
+
+            //-----------------------------------------------------------------
+            //! get pointer to the data
+            T *data() { return _data; }
+
+            //-----------------------------------------------------------------
+            //! get const pointer to the data
+            const T *data() const { return _data; }
+
+            //-----------------------------------------------------------------
+            //! get mapping mode
+            map_mode mode() const
+            {
+                return _mapping ? _mapping->mode() : map_mode::COPY_ON_WRITE;
+            }
+
+            //-----------------------------------------------------------------
+            //! get reference to element i
+            T &operator[](size_t i) { return _data[i]; }
+
+            //-----------------------------------------------------------------
+            //! get value of element i
+            const T &operator[](size_t i) const { return _data[i]; }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief get reference to element i with index check
+            //!
+            //! \throws index_error if i exceeds the size of the storage
+            //! \param i index of the element
+            //! \return reference to the element
+            //!
+            T &at(size_t i)
+            {
+                check_index(i);
+                return _data[i];
+            }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief get value of element i with index check
+            //!
+            //! \throws index_error if i exceeds the size of the storage
+            //! \param i index of the element
+            //! \return reference to the element
+            //!
+            const T &at(size_t i) const
+            {
+                check_index(i);
+                return _data[i];
+            }
+
+            //-----------------------------------------------------------------
+            //! get reference to the first element
+            T &front() { return _data[0]; }
+
+            //-----------------------------------------------------------------
+            //! get reference to the first element
+            const T &front() const { return _data[0]; }
+
+            //-----------------------------------------------------------------
+            //! get reference to the last element
+            T &back() { return _data[_size-1]; }
+
+            //-----------------------------------------------------------------
+            //! get reference to the last element
+            const T &back() const { return _data[_size-1]; }
+
+            //-----------------------------------------------------------------
+            //! get iterator to the first element
+            iterator begin() { return _data; }
+
+            //-----------------------------------------------------------------
+            //! get iterator to the last element
+            iterator end() { return _data+_size; }
+
+            //-----------------------------------------------------------------
+            //! get const iterator to the first element
+            const_iterator begin() const { return _data; }
+
+            //-----------------------------------------------------------------
+            //! get const iterator to the last element
+            const_iterator end() const { return _data+_size; }
+
+            //-----------------------------------------------------------------
+            //! get reverse iterator to the last element
+            reverse_iterator rbegin() { return reverse_iterator(end()); }
+
+            //-----------------------------------------------------------------
+            //! get reverse iterator to the first element
+            reverse_iterator rend() { return reverse_iterator(begin()); }
+
+            //-----------------------------------------------------------------
+            //! get const reverse iterator to the last element
+            const_reverse_iterator rbegin() const
+            {
+                return const_reverse_iterator(end());
+            }
+
+            //-----------------------------------------------------------------
+            //! get const reverse iterator to the first element
+            const_reverse_iterator rend() const
+            {
+                return const_reverse_iterator(begin());
+            }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief advise access pattern
+            //!
+            //! \param advice access pattern for the entire storage
+            //!
+            void advise(map_advice advice) const
+            {
+                advise(advice,0,_size);
+            }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief advise access pattern for a range of elements
+            //!
+            //! Useful for instance to prefetch the next frames of a stack
+            //! with map_advice::WILLNEED.
+            //!
+            //! \param advice access pattern
+            //! \param first index of the first element
+            //! \param n number of elements
+            //!
+            void advise(map_advice advice,size_t first,size_t n) const
+            {
+                if(_mapping)
+                    _mapping->advise(advice,first*sizeof(T),n*sizeof(T));
+            }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief flush modifications to the file
+            //!
+            //! \throws file_error if writing fails
+            //!
+            void sync() const
+            {
+                if(_mapping) _mapping->sync();
+            }
+
+        private:
+            //-----------------------------------------------------------------
+            //! throw index_error if i is out of bounds
+            void check_index(size_t i) const
+            {
+                if(i<_size) return;
+
+                std::stringstream ss;
+                ss<<"Index "<<i<<" exceeds storage size ("<<_size<<")!";
+                throw index_error(EXCEPTION_RECORD,ss.str());
+            }
+    };
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup type_classes
+    //! \brief container trait for mapped_storage
+    //!
+    //! \tparam T element type
+    //!
+    template<typename T> struct container_trait<mapped_storage<T>>
+    {
+        //! mapped_storage provides random access
+        static const bool is_random_access = true;
+        //! mapped_storage is iterable
+        static const bool is_iterable   = true;
+        //! mapped_storage is contiguous
+        static const bool is_contiguous = true;
+        //! mapped_storage is not multidimensional
+        static const bool is_multidim   = false;
+    };
+
+//end of namespace
+}
+}
@@ -45,6 +45,7 @@
 #include <pni/core/arrays/index_map/index_maps.hpp>
 #include <pni/core/types/type_id_map.hpp>
 #include <pni/core/algorithms.hpp>
+#include <pni/core/algorithms/comparisons/comparison_kernels.hpp>
 
 
 namespace pni {
@@ -103,6 +104,67 @@ namespace core {
             IMAP _imap;  
             //! instance of STORAGE
             STORAGE _data;  
+
+            //! arrays of other types take over the storage on moves
+            template<typename,typename,typename> friend class mdarray;
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief bulk assignment
+            //!
+            //! Copies the elements of an array with contiguous storage via 
+            //! pointers. Arrays using parallel_inplace_arithmetics copy with
+            //! multiple threads.
+            //!
+            template<
+                     typename ATYPE,
+                     typename FUSED
+                    > 
+            void _assign(const ATYPE &array,std::true_type,FUSED)
+            {
+                copy_elements(_data.data(),array.data(),array.size(),
+                     std::is_same<IPA,parallel_inplace_arithmetics>::value);
+            }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief fused assignment
+            //!
+            //! Evaluates the source array (usually an expression template)
+            //! block by block with the vector kernels. Arrays using 
+            //! parallel_inplace_arithmetics evaluate with multiple threads.
+            //!
+            template<typename ATYPE> 
+            void _assign(const ATYPE &array,std::false_type,std::true_type)
+            {
+                evaluate_expression(_data.data(),array,array.size(),
+                     std::is_same<IPA,parallel_inplace_arithmetics>::value);
+            }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief element wise assignment
+            //!
+            template<typename ATYPE> 
+            void _assign(const ATYPE &array,std::false_type,std::false_type)
+            {
+                size_t s = array.size();
+                for(size_t i=0;i<s;++i) (*this)[i] = array[i];
+            }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief assign data from an other array
+            //!
+            template<typename ATYPE> void _assign(const ATYPE &array)
+            {
+                static_assert(has_same_storage_order<array_type,ATYPE>::value,
+                              "Arrays must have the same storage order!");
+                typedef is_bulk_copy<array_type,ATYPE> copy_trait;
+                typedef is_fused_evaluation<array_type,ATYPE> fused_trait;
+                _assign(array,std::integral_constant<bool,copy_trait::value>(),
+                        std::integral_constant<bool,fused_trait::value>());
+            }
         public:
 
             //=================constructors and destructor=====================
@@ -153,6 +215,9 @@ namespace core {
                 _imap(map_utils<map_type>::create(view.template shape<shape_t>())),
                 _data(container_utils<storage_type>::create(view.size()))
             {
+                static_assert(has_same_storage_order<array_type,
+                                  array_view<ATYPE>>::value,
+                              "Arrays must have the same storage order!");
                 std::copy(view.begin(),view.end(),_data.begin());
             }
 
@@ -173,9 +238,40 @@ namespace core {
                 _imap(map_utils<map_type>::create(array.template shape<shape_t>())),
                 _data(container_utils<storage_type>::create(array.size()))
             {
-                //copy data
-                for(size_t i=0;i<array.size();++i) (*this)[i] = array[i];
-                //std::copy(array.begin(),array.end(),this->begin());
+                _assign(array);
+            }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief move construction from an other array
+            //!
+            //! Takes over the storage of an array with the same storage type
+            //! but a different index map or inplace arithmetics type. No 
+            //! element is copied. 
+            /*!
+            \code
+            auto image = fixed_dim_array<float32,2>::create(shape_t{2048,2048});
+            dynamic_array<float32> data(std::move(image));
+            \endcode
+            !*/
+            //!
+            //! \throws shape_mismatch_error if the index map does not support 
+            //! the rank of the source array
+            //! \tparam SMAP index map type of the source
+            //! \tparam SIPA inplace arithmetics type of the source 
+            //! \param array rvalue reference to the source array
+            //!
+            template<
+                     typename SMAP,
+                     typename SIPA
+                    >
+            explicit mdarray(mdarray<STORAGE,SMAP,SIPA> &&array):
+                _imap(map_utils<map_type>::create(array.template shape<shape_t>())),
+                _data(std::move(array._data))
+            {
+                static_assert(has_same_storage_order<array_type,
+                                  mdarray<STORAGE,SMAP,SIPA>>::value,
+                              "Arrays must have the same storage order!");
             }
 
             //====================static methods to create arrays==============
@@ -241,9 +337,37 @@ namespace core {
             {
                 if((void*)this == (void*)&array) return *this;
     
-                size_t s = array.size();
-                for(size_t i=0;i<s;++i) (*this)[i] = array[i];
+                _assign(array);
+                return *this;
+            }
 
+            //-----------------------------------------------------------------
+            //!
+            //! \brief move assignment from a different array type
+            //!
+            //! Takes over the storage and the shape of an array with the same
+            //! storage type but a different index map or inplace arithmetics
+            //! type. No element is copied.
+            //!
+            //! \throws shape_mismatch_error if the index map does not support 
+            //! the rank of the source array
+            //! \tparam SMAP index map type of the source
+            //! \tparam SIPA inplace arithmetics type of the source 
+            //! \param array rvalue reference to the source array
+            //! \return reference to the updated array
+            //!
+            template<
+                     typename SMAP,
+                     typename SIPA
+                    >
+            array_type &operator=(mdarray<STORAGE,SMAP,SIPA> &&array)
+            {
+                static_assert(has_same_storage_order<array_type,
+                                  mdarray<STORAGE,SMAP,SIPA>>::value,
+                              "Arrays must have the same storage order!");
+                _imap = map_utils<map_type>::create(
+                            array.template shape<shape_t>());
+                _data = std::move(array._data);
                 return *this;
             }
 
@@ -322,6 +446,41 @@ namespace core {
                 return _imap.rank(); 
             }
 
+            //-----------------------------------------------------------------
+            //!
+            //! \brief change the shape of the array
+            //!
+            //! Replaces the index map of the array. The storage and thus 
+            //! the linear order of the elements remain unchanged - no data 
+            //! is copied.
+            /*!
+            \code
+            auto buffer = dynamic_array<float32>::create(shape_t{n*h*w});
+            buffer.reshape(shape_t{n,h,w});
+            \endcode
+            !*/
+            //!
+            //! \throws shape_mismatch_error if the map of the array does not 
+            //! support the rank of the new shape
+            //! \throws size_mismatch_error if the new shape does not describe
+            //! the number of elements of the array
+            //! \tparam CTYPE container type with shape information
+            //! \param shape the new shape
+            //!
+            template<typename CTYPE> void reshape(const CTYPE &shape)
+            {
+                auto map = map_utils<map_type>::create(shape);
+                if(map.max_elements()!=size())
+                {
+                    std::stringstream ss;
+                    ss<<"Cannot reshape an array of "<<size()<<" elements "
+                      <<"to a shape of "<<map.max_elements()<<" elements!";
+                    throw size_mismatch_error(EXCEPTION_RECORD,ss.str());
+                }
+
+                _imap = std::move(map);
+            }
+
             //=============operators and methods to access array data==========
             //!
             //! \brief get referece to element i
@@ -574,6 +733,20 @@ namespace core {
 
 
             
+            //-----------------------------------------------------------------
+            //!
+            //! \brief get storage
+            //!
+            //! Return a const reference to the storage object. For arrays 
+            //! representing an expression this is the expression template.
+            //!
+            //! \return reference to the storage
+            //!
+            const storage_type &storage() const
+            {
+                return _data;
+            }
+
             //-----------------------------------------------------------------
             //!
             //! \brief return const pointer 
@@ -744,6 +917,8 @@ namespace core {
             template<typename ATYPE> 
             array_type &operator+=(const ATYPE &v) 
             { 
+                static_assert(has_same_storage_order<array_type,ATYPE>::value,
+                              "Arrays must have the same storage order!");
                 IPA::add(*this,v); 
                 return *this;
             }
@@ -786,6 +961,8 @@ namespace core {
             template<typename ATYPE> 
             array_type &operator-=(const ATYPE &v) 
             { 
+                static_assert(has_same_storage_order<array_type,ATYPE>::value,
+                              "Arrays must have the same storage order!");
                 IPA::sub(*this,v); 
                 return *this; 
             }
@@ -828,6 +1005,8 @@ namespace core {
             template<typename ATYPE>
             array_type &operator*=(const ATYPE &v) 
             { 
+                static_assert(has_same_storage_order<array_type,ATYPE>::value,
+                              "Arrays must have the same storage order!");
                 IPA::mult(*this,v); 
                 return *this;
             }
@@ -870,6 +1049,8 @@ namespace core {
             template<typename ATYPE>
             array_type &operator/=(const ATYPE &v) 
             { 
+                static_assert(has_same_storage_order<array_type,ATYPE>::value,
+                              "Arrays must have the same storage order!");
                 IPA::div(*this,v); 
                 return *this;
             }
@@ -958,13 +1139,28 @@ namespace core {
         return is;
     }
    
+    //! \cond NO_API_DOC
+    template<typename ATYPE>
+    bool equal_elements(const ATYPE &b1,const ATYPE &b2,std::true_type)
+    {
+        return find_unequal(b1.data(),b2.data(),b1.size())==b1.size();
+    }
+
+    template<typename ATYPE>
+    bool equal_elements(const ATYPE &b1,const ATYPE &b2,std::false_type)
+    {
+        return std::equal(b1.begin(),b1.end(),b2.begin());
+    }
+    //! \endcond
+
     //-------------------------------------------------------------------------
     //! 
     //! \ingroup mdim_array_classes
     //! \brief equality comparison operator
     //! 
     //! Returns true if thwo arrays are equal. This is the case when all
-    //! element stored in the arrays are equal. 
+    //! element stored in the arrays are equal. Arrays with contiguous 
+    //! storage are compared with find_unequal(). 
     //! 
     //! \param b1 array on the lhs of the comparison
     //! \param b2 array on the rhs of the comparison
@@ -979,7 +1175,13 @@ namespace core {
     bool operator==(const mdarray<STORAGE,IMAP,IPA> &b1, 
                     const mdarray<STORAGE,IMAP,IPA> &b2) 
     {
-        return std::equal(b1.begin(),b1.end(),b2.begin());
+        typedef typename mdarray<STORAGE,IMAP,IPA>::value_type value_type;
+        typedef std::integral_constant<bool,
+                    container_trait<STORAGE>::is_contiguous &&
+                    !std::is_same<value_type,bool>::value> bulk_type;
+
+        if(b1.size()!=b2.size()) return false;
+        return equal_elements(b1,b2,bulk_type());
     }
 
     //-------------------------------------------------------------------------
@@ -22,6 +22,7 @@
 //     Author: Eugen Wintersberger <eugen.wintersberger@desy.de>
 //
 
+#include <sstream>
 #include <pni/core/type_erasures/array.hpp>
 
 namespace pni{
@@ -60,6 +61,20 @@ namespace core{
         return *this;
     }
 
+    //-------------------------------------------------------------------------
+    void array::_check_range(size_t offset,size_t n,
+                             const exception_record &r) const
+    {
+        size_t size = _ptr->size();
+        if(offset>size || n>size-offset)
+        {
+            std::stringstream ss;
+            ss<<"Range of "<<n<<" elements at offset "<<offset;
+            ss<<" exceeds array size "<<size<<"!";
+            throw index_error(r,ss.str());
+        }
+    }
+
     //-------------------------------------------------------------------------
     type_id_t array::type_id() const
     { 
@@ -130,6 +145,34 @@ namespace core{
         return const_cast<const array_holder_interface &>((*_ptr))(index);
     }
 
+    //-------------------------------------------------------------------------
+    array array::operator()(const view_index &index)
+    {
+        _check_pointer(_ptr,EXCEPTION_RECORD);
+
+        shape_t shape = _ptr->shape();
+        if(index.size()!=shape.size())
+        {
+            std::stringstream ss;
+            ss<<"Number of slices ("<<index.size()<<") does not match ";
+            ss<<"the rank of the array ("<<shape.size()<<")!";
+            throw shape_mismatch_error(EXCEPTION_RECORD,ss.str());
+        }
+
+        for(size_t i=0;i<shape.size();++i)
+            if(index[i].last()>shape[i])
+            {
+                std::stringstream ss;
+                ss<<"Slice "<<index[i]<<" exceeds dimension "<<i;
+                ss<<" of size "<<shape[i]<<"!";
+                throw index_error(EXCEPTION_RECORD,ss.str());
+            }
+
+        array result;
+        result._ptr = pointer_type(_ptr->view(index));
+        return result;
+    }
+
     //-------------------------------------------------------------------------
     string array::type_name() const
     {
@@ -36,6 +36,9 @@
 namespace pni{
 namespace core{
 
+    //forward declaration
+    template<typename TARGET> struct visit_access;
+
     //!
     //! \ingroup type_erasure_classes
     //! \brief type erasure array types
@@ -111,6 +114,18 @@ namespace core{
                     _throw_not_allocated_error(r);
             }
 
+            //----------------------------------------------------------------
+            //!
+            //! \brief check element range
+            //!
+            //! \throws index_error if the range exceeds the array
+            //! \param offset linear index of the first element
+            //! \param n number of elements
+            //! \param r the exception record
+            //!
+            void _check_range(size_t offset,size_t n,
+                              const exception_record &r) const;
+
             //! pointer to an instance of array_holder
 #ifdef _MSC_VER
 #pragma warning(disable:4251)
@@ -119,6 +134,9 @@ namespace core{
 #ifdef _MSC_VER
 #pragma warning(default:4251)
 #endif
+
+            //! typed access for visitors
+            friend struct visit_access<array>;
         public:
             //====================public types=================================
             typedef value value_type; //!< value type of the array
@@ -346,6 +364,126 @@ namespace core{
             //! 
             value operator()(const element_index &index) const;
 
+            //-----------------------------------------------------------------
+            //!
+            //! \brief get a view
+            //!
+            //! Returns a type erasure for the part of the array selected by
+            //! one slice per dimension. No data is copied - the view refers
+            //! to the data of this instance and thus must not be used after
+            //! this instance was destroyed or assigned a new array. Like
+            //! any other array the view provides iterators and element
+            //! access as well as bulk copies with copy_to and copy_from
+            //! which walk along the contiguous runs of the selection.
+            //! data() is only available for contiguous selections.
+            /*!
+            \code
+            array::view_index roi{slice(0,100),slice(256,512),slice(0,1024)};
+            array region = frames(roi);
+
+            std::vector<float32> buffer(region.size());
+            region.copy_to(buffer.data(),buffer.size());
+            \endcode
+            !*/
+            //!
+            //! \throws memory_not_allocated_error if the array holds no data
+            //! \throws shape_mismatch_error if the number of slices does not
+            //!                              match the rank of the array
+            //! \throws index_error if a slice exceeds the shape of the array
+            //! \throws not_implemented_error if the array is itself a view
+            //! \param index one slice per dimension
+            //! \return type erasure for the view
+            //!
+            array operator()(const view_index &index);
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief copy elements to memory
+            //!
+            //! Copies the first n elements to dst converting them to T. 
+            //! Unlike element access via operator[] the type of the array 
+            //! is resolved only once for all elements.
+            /*!
+            \code
+            std::vector<float32> frame(a.size());
+            a.copy_to(frame.data(),frame.size());
+            \endcode
+            !*/
+            //!
+            //! \throws memory_not_allocated_error if the array holds no data
+            //! \throws index_error if n exceeds the size of the array
+            //! \throws type_error if the elements cannot be converted to T
+            //! \throws range_error if an element does not fit in T
+            //! \tparam T element type of the destination
+            //! \param dst pointer to memory for n elements
+            //! \param n number of elements
+            //!
+            template<typename T> void copy_to(T *dst,size_t n) const
+            {
+                copy_to(0,dst,n);
+            }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief copy a range of elements to memory
+            //!
+            //! Copies n elements starting at linear index offset to dst.
+            //!
+            //! \throws memory_not_allocated_error if the array holds no data
+            //! \throws index_error if the range exceeds the array
+            //! \throws type_error if the elements cannot be converted to T
+            //! \throws range_error if an element does not fit in T
+            //! \tparam T element type of the destination
+            //! \param offset linear index of the first element
+            //! \param dst pointer to memory for n elements
+            //! \param n number of elements
+            //!
+            template<typename T> 
+            void copy_to(size_t offset,T *dst,size_t n) const;
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief copy elements from memory
+            //!
+            //! Copies n elements from src to the beginning of the array 
+            //! converting them to the element type of the array.
+            //!
+            //! \throws memory_not_allocated_error if the array holds no data
+            //! \throws index_error if n exceeds the size of the array
+            //! \throws type_error if T cannot be converted to the element 
+            //!                    type
+            //! \throws range_error if an element does not fit in the 
+            //!                     element type
+            //! \tparam T element type of the source
+            //! \param src pointer to n elements
+            //! \param n number of elements
+            //!
+            template<typename T> void copy_from(const T *src,size_t n)
+            {
+                copy_from(0,src,n);
+            }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief copy elements from memory to a range 
+            //!
+            //! Copies n elements from src to the array starting at linear 
+            //! index offset.
+            //!
+            //! \throws memory_not_allocated_error if the array holds no data
+            //! \throws index_error if the range exceeds the array
+            //! \throws type_error if T cannot be converted to the element 
+            //!                    type
+            //! \throws range_error if an element does not fit in the 
+            //!                     element type
+            //! \tparam T element type of the source
+            //! \param offset linear index of the first element
+            //! \param src pointer to n elements
+            //! \param n number of elements
+            //!
+            template<typename T> 
+            void copy_from(size_t offset,const T *src,size_t n);
+
             //-----------------------------------------------------------------
             //! return the type name
             string type_name() const;
@@ -385,6 +523,32 @@ namespace core{
         return c;
     }
 
+    //-------------------------------------------------------------------------
+    template<typename T> 
+    void array::copy_to(size_t offset,T *dst,size_t n) const
+    {
+        static_assert(type_id_map<T>::type_id!=type_id_t::NONE &&
+                      !std::is_same<T,bool>::value,
+                      "Element type not supported - use bool_t for bool!");
+
+        _check_pointer(_ptr,EXCEPTION_RECORD);
+        _check_range(offset,n,EXCEPTION_RECORD);
+        _ptr->copy_to(type_id_map<T>::type_id,dst,offset,n);
+    }
+
+    //-------------------------------------------------------------------------
+    template<typename T> 
+    void array::copy_from(size_t offset,const T *src,size_t n)
+    {
+        static_assert(type_id_map<T>::type_id!=type_id_t::NONE &&
+                      !std::is_same<T,bool>::value,
+                      "Element type not supported - use bool_t for bool!");
+
+        _check_pointer(_ptr,EXCEPTION_RECORD);
+        _check_range(offset,n,EXCEPTION_RECORD);
+        _ptr->copy_from(type_id_map<T>::type_id,src,offset,n);
+    }
+
     //-------------------------------------------------------------------------
     //! 
     //! \ingroup type_erasure_classes
@@ -23,7 +23,11 @@
 //
 #pragma once
 
+#include <algorithm>
 #include <pni/core/algorithms.hpp>
+#include <pni/core/algorithms/conversions/conversion_kernels.hpp>
+#include <pni/core/arrays/array_view.hpp>
+#include <pni/core/arrays/array_view_runs.hpp>
 #include <pni/core/type_erasures/array_holder_interface.hpp>
 
 namespace pni{
@@ -44,6 +48,54 @@ namespace core{
         return (void *)(a.data());
     }
 
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup type_erasure_classes_internal
+    //! \brief check the storage order
+    //!
+    //! Views follow the storage order of their parent array.
+    //!
+    //! \tparam ATYPE array type
+    //! \return true if ATYPE uses a C index map
+    //!
+    template<typename ATYPE> 
+    bool is_c_ordered(const ATYPE &)
+    {
+        return std::is_same<typename ATYPE::map_type::implementation_type,
+                            c_index_map_imp>::value;
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup type_erasure_classes_internal
+    //! \brief check for contiguous data
+    //!
+    //! All arrays held by the type erasure have contiguous storage.
+    //!
+    //! \tparam ATYPE array type
+    //! \return true
+    //!
+    template<typename ATYPE> 
+    bool has_contiguous_data(const ATYPE &)
+    {
+        return true;
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup type_erasure_classes_internal
+    //! \brief check for contiguous data
+    //!
+    //! \tparam ATYPE array type of the view
+    //! \param v reference to the view
+    //! \return true if the selection of the view is contiguous
+    //!
+    template<typename ATYPE> 
+    bool has_contiguous_data(const array_view<ATYPE> &v)
+    {
+        return v.is_contiguous();
+    }
+
 
     //-------------------------------------------------------------------------
     //!
@@ -58,6 +110,173 @@ namespace core{
     {
         private:
             OT _object; //!< the original object 
+
+            //! element type of the original object
+            typedef typename OT::value_type element_type;
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief copy elements to typed memory
+            //!
+            //! The conversion is resolved at compile time. Numeric data is
+            //! converted in blocks with convert_n().
+            //!
+            template<typename T>
+            void _copy_to(T *dst,size_t offset,size_t n) const
+            {
+                _copy_to(_object,dst,offset,n);
+            }
+
+            //-----------------------------------------------------------------
+            //! copy elements from typed memory
+            template<typename T>
+            void _copy_from(const T *src,size_t offset,size_t n)
+            {
+                _copy_from(_object,src,offset,n);
+            }
+
+            //-----------------------------------------------------------------
+            //! convert contiguous numeric data with the bulk kernels
+            template<
+                     typename TT,
+                     typename ST
+                    >
+            static void _convert(const ST *src,TT *dst,size_t n,
+                                 std::true_type)
+            {
+                convert_n(src,dst,n);
+            }
+
+            //-----------------------------------------------------------------
+            //! convert contiguous data element by element
+            template<
+                     typename TT,
+                     typename ST
+                    >
+            static void _convert(const ST *src,TT *dst,size_t n,
+                                 std::false_type)
+            {
+                typedef strategy<TT,ST> strategy_type;
+
+                for(size_t i=0;i<n;++i) dst[i] = strategy_type::convert(src[i]);
+            }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief convert contiguous data
+            //!
+            //! Numeric data is range checked and converted in blocks by
+            //! convert_n(), all other data is converted element by element.
+            //!
+            template<
+                     typename TT,
+                     typename ST
+                    >
+            static void _convert(const ST *src,TT *dst,size_t n)
+            {
+                _convert(src,dst,n,std::integral_constant<bool,
+                                        bulk_convertible<ST,TT>::value>());
+            }
+
+            //-----------------------------------------------------------------
+            //! copy elements of an array to typed memory
+            template<
+                     typename ATYPE,
+                     typename T
+                    >
+            static void _copy_to(const ATYPE &a,T *dst,size_t offset,
+                                 size_t n)
+            {
+                _convert(a.data()+offset,dst,n);
+            }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief copy elements of a view to typed memory
+            //!
+            //! Walks along the contiguous runs of the view instead of
+            //! computing the storage offset of every single element.
+            //!
+            template<
+                     typename ATYPE,
+                     typename T
+                    >
+            static void _copy_to(const array_view<ATYPE> &v,T *dst,
+                                 size_t offset,size_t n)
+            {
+                size_t end = offset+n;
+                size_t pos = 0; //linear index of the first element of a run
+
+                for_each_contiguous_run(v,
+                        [&](const element_type *ptr,size_t length)
+                        {
+                            size_t first = std::max(pos,offset);
+                            size_t last = std::min(pos+length,end);
+                            if(first<last)
+                            {
+                                _convert(ptr+(first-pos),dst,last-first);
+                                dst += last-first;
+                            }
+                            pos += length;
+                        });
+            }
+
+            //-----------------------------------------------------------------
+            //! copy elements from typed memory to an array
+            template<
+                     typename ATYPE,
+                     typename T
+                    >
+            static void _copy_from(ATYPE &a,const T *src,size_t offset,
+                                   size_t n)
+            {
+                _convert(src,a.data()+offset,n);
+            }
+
+            //-----------------------------------------------------------------
+            //! copy elements from typed memory to a view
+            template<
+                     typename ATYPE,
+                     typename T
+                    >
+            static void _copy_from(array_view<ATYPE> &v,const T *src,
+                                   size_t offset,size_t n)
+            {
+                size_t end = offset+n;
+                size_t pos = 0; //linear index of the first element of a run
+
+                for_each_contiguous_run(v,
+                        [&](element_type *ptr,size_t length)
+                        {
+                            size_t first = std::max(pos,offset);
+                            size_t last = std::min(pos+length,end);
+                            if(first<last)
+                            {
+                                _convert(src,ptr+(first-pos),last-first);
+                                src += last-first;
+                            }
+                            pos += length;
+                        });
+            }
+
+            //-----------------------------------------------------------------
+            //! create a view on an array
+            template<typename ATYPE>
+            static array_holder_interface *_view(ATYPE &a,
+                                                 const view_index &index)
+            {
+                return new array_holder<array_view<ATYPE>>(a(index));
+            }
+
+            //-----------------------------------------------------------------
+            //! views on views are not supported
+            template<typename ATYPE>
+            static array_holder_interface *_view(array_view<ATYPE> &,
+                                                 const view_index &)
+            {
+                throw not_implemented_error(EXCEPTION_RECORD,
+                        "Cannot create a view on a view!");
+            }
         public:
             //==================constructors and destructor====================
             //!construct by copying o
@@ -182,6 +401,120 @@ namespace core{
                 return value_ref(std::ref(_object.at(i)));
             }
 
+            //-----------------------------------------------------------------
+            //! copy elements to memory
+            virtual void copy_to(type_id_t tid,void *dst,size_t offset,
+                                 size_t n) const
+            {
+                switch(tid)
+                {
+                    case type_id_t::UINT8:
+                        _copy_to(static_cast<uint8*>(dst),offset,n); break;
+                    case type_id_t::INT8:
+                        _copy_to(static_cast<int8*>(dst),offset,n); break;
+                    case type_id_t::UINT16:
+                        _copy_to(static_cast<uint16*>(dst),offset,n); break;
+                    case type_id_t::INT16:
+                        _copy_to(static_cast<int16*>(dst),offset,n); break;
+                    case type_id_t::UINT32:
+                        _copy_to(static_cast<uint32*>(dst),offset,n); break;
+                    case type_id_t::INT32:
+                        _copy_to(static_cast<int32*>(dst),offset,n); break;
+                    case type_id_t::UINT64:
+                        _copy_to(static_cast<uint64*>(dst),offset,n); break;
+                    case type_id_t::INT64:
+                        _copy_to(static_cast<int64*>(dst),offset,n); break;
+                    case type_id_t::FLOAT32:
+                        _copy_to(static_cast<float32*>(dst),offset,n); break;
+                    case type_id_t::FLOAT64:
+                        _copy_to(static_cast<float64*>(dst),offset,n); break;
+                    case type_id_t::FLOAT128:
+                        _copy_to(static_cast<float128*>(dst),offset,n); break;
+                    case type_id_t::COMPLEX32:
+                        _copy_to(static_cast<complex32*>(dst),offset,n); break;
+                    case type_id_t::COMPLEX64:
+                        _copy_to(static_cast<complex64*>(dst),offset,n); break;
+                    case type_id_t::COMPLEX128:
+                        _copy_to(static_cast<complex128*>(dst),offset,n);
+                        break;
+                    case type_id_t::STRING:
+                        _copy_to(static_cast<string*>(dst),offset,n); break;
+                    case type_id_t::BINARY:
+                        _copy_to(static_cast<binary*>(dst),offset,n); break;
+                    case type_id_t::BOOL:
+                        _copy_to(static_cast<bool_t*>(dst),offset,n); break;
+                    default:
+                        throw type_error(EXCEPTION_RECORD,"Unknown type!");
+                }
+            }
+
+            //-----------------------------------------------------------------
+            //! copy elements from memory
+            virtual void copy_from(type_id_t tid,const void *src,size_t offset,
+                                   size_t n)
+            {
+                switch(tid)
+                {
+                    case type_id_t::UINT8:
+                        _copy_from(static_cast<const uint8*>(src),offset,n);
+                        break;
+                    case type_id_t::INT8:
+                        _copy_from(static_cast<const int8*>(src),offset,n);
+                        break;
+                    case type_id_t::UINT16:
+                        _copy_from(static_cast<const uint16*>(src),offset,n);
+                        break;
+                    case type_id_t::INT16:
+                        _copy_from(static_cast<const int16*>(src),offset,n);
+                        break;
+                    case type_id_t::UINT32:
+                        _copy_from(static_cast<const uint32*>(src),offset,n);
+                        break;
+                    case type_id_t::INT32:
+                        _copy_from(static_cast<const int32*>(src),offset,n);
+                        break;
+                    case type_id_t::UINT64:
+                        _copy_from(static_cast<const uint64*>(src),offset,n);
+                        break;
+                    case type_id_t::INT64:
+                        _copy_from(static_cast<const int64*>(src),offset,n);
+                        break;
+                    case type_id_t::FLOAT32:
+                        _copy_from(static_cast<const float32*>(src),offset,n);
+                        break;
+                    case type_id_t::FLOAT64:
+                        _copy_from(static_cast<const float64*>(src),offset,n);
+                        break;
+                    case type_id_t::FLOAT128:
+                        _copy_from(static_cast<const float128*>(src),offset,
+                                   n);
+                        break;
+                    case type_id_t::COMPLEX32:
+                        _copy_from(static_cast<const complex32*>(src),offset,
+                                   n);
+                        break;
+                    case type_id_t::COMPLEX64:
+                        _copy_from(static_cast<const complex64*>(src),offset,
+                                   n);
+                        break;
+                    case type_id_t::COMPLEX128:
+                        _copy_from(static_cast<const complex128*>(src),offset,
+                                   n);
+                        break;
+                    case type_id_t::STRING:
+                        _copy_from(static_cast<const string*>(src),offset,n);
+                        break;
+                    case type_id_t::BINARY:
+                        _copy_from(static_cast<const binary*>(src),offset,n);
+                        break;
+                    case type_id_t::BOOL:
+                        _copy_from(static_cast<const bool_t*>(src),offset,n);
+                        break;
+                    default:
+                        throw type_error(EXCEPTION_RECORD,"Unknown type!");
+                }
+            }
+
             //-----------------------------------------------------------------
             //! return element value
             virtual value operator()(const element_index &index) const 
@@ -196,6 +529,13 @@ namespace core{
                 return value_ref(std::ref(_object(index)));
             }
 
+            //-----------------------------------------------------------------
+            //! create a view on the array
+            virtual array_holder_interface *view(const view_index &index)
+            {
+                return _view(_object,index);
+            }
+
             //-----------------------------------------------------------------
             //! write data to output stream
             virtual std::ostream &write(std::ostream &os) const 
@@ -226,6 +566,20 @@ namespace core{
                 return get_pointer(_object);            
             }
 
+            //-----------------------------------------------------------------
+            //! true if the data is C-ordered
+            virtual bool is_c_ordered() const
+            {
+                return pni::core::is_c_ordered(_object);
+            }
+
+            //-----------------------------------------------------------------
+            //! true if the data is contiguous in memory
+            virtual bool is_contiguous() const
+            {
+                return has_contiguous_data(_object);
+            }
+
     };
 
 //end of namespace
@@ -151,6 +151,50 @@ namespace core{
             //! get pointer to data
             virtual const void *ptr() const = 0;
 
+            //-----------------------------------------------------------------
+            //! true if the linear index of the data follows C-order
+            virtual bool is_c_ordered() const = 0;
+
+            //-----------------------------------------------------------------
+            //! true if the data is contiguous in memory
+            virtual bool is_contiguous() const = 0;
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief copy elements to memory
+            //!
+            //! Copies n elements starting at linear index offset to dst
+            //! converting them to the type given by tid.
+            //!
+            //! \throws type_error if the elements cannot be converted
+            //! \throws range_error if an element does not fit in the range
+            //!                     of the target type
+            //! \param tid type ID of the elements in dst
+            //! \param dst pointer to memory for n elements
+            //! \param offset linear index of the first element
+            //! \param n number of elements
+            //!
+            virtual void copy_to(type_id_t tid,void *dst,size_t offset,
+                                 size_t n) const = 0;
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief copy elements from memory
+            //!
+            //! Copies n elements of the type given by tid from src to the
+            //! array starting at linear index offset.
+            //!
+            //! \throws type_error if the elements cannot be converted
+            //! \throws range_error if an element does not fit in the range
+            //!                     of the element type of the array
+            //! \param tid type ID of the elements in src
+            //! \param src pointer to n elements
+            //! \param offset linear index of the first element
+            //! \param n number of elements
+            //!
+            virtual void copy_from(type_id_t tid,const void *src,size_t offset,
+                                   size_t n) = 0;
+
             //-----------------------------------------------------------------
             //! get element value
             virtual value operator()(const element_index &index) const = 0;
@@ -159,6 +203,21 @@ namespace core{
             //! get element reference
             virtual value_ref operator()(const element_index &index)  = 0;
 
+            //-----------------------------------------------------------------
+            //!
+            //! \brief create a view
+            //!
+            //! Creates a holder for a view on the array selected by a
+            //! set of slices. The view refers to the data of this holder.
+            //!
+            //! \throws shape_mismatch_error if the number of slices does not
+            //!                              match the rank of the array
+            //! \throws not_implemented_error if the holder stores a view
+            //! \param index one slice per dimension
+            //! \return pointer to the new holder
+            //!
+            virtual array_holder_interface *view(const view_index &index) = 0;
+
     };
 
 
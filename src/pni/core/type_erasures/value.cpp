@@ -34,16 +34,18 @@ namespace core{
     // Implementation of constructors
     //-------------------------------------------------------------------------
     value::value():
-        _ptr(new value_holder<none>(none()))
+        _ptr(value_holder<none>(none()))
     {}
 
     //-------------------------------------------------------------------------
     value::value(const value &o)
-        :_ptr(o._ptr ? o._ptr->clone() : new value_holder<none>(none())) 
-    {}
+        :_ptr(o._ptr)
+    {
+        if(!_ptr) _ptr = pointer_type(value_holder<none>(none()));
+    }
    
     //------------------------------------------------------------------------
-    value::value(value &&o)
+    value::value(value &&o) noexcept
         :_ptr(std::move(o._ptr)) 
     {
         o = value();
@@ -58,14 +60,13 @@ namespace core{
     {
         if(this == &o) return *this;
 
-        //we have to clone here as we cannot copy a unique pointer
-        _ptr = std::unique_ptr<value_holder_interface>(o._ptr->clone());
+        _ptr = o._ptr;
 
         return *this;
     }
     
     //-------------------------------------------------------------------------
-    value &value::operator=(value &&o)
+    value &value::operator=(value &&o) noexcept
     {
         if(this == &o) return *this;
         std::swap(_ptr,o._ptr);
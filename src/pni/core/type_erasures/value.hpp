@@ -28,6 +28,7 @@
 #include <pni/core/error/exceptions.hpp>
 #include <pni/core/types/types.hpp>
 #include <pni/core/type_erasures/value_holder.hpp>
+#include <pni/core/type_erasures/value_storage.hpp>
 #include <pni/core/type_erasures/utils.hpp>
 #include <pni/core/types/traits.hpp>
 #include <pni/core/windows.hpp>
@@ -38,6 +39,7 @@ namespace core{
 
     //forward declaration
     class value_ref;
+    template<typename TARGET> struct visit_access;
 
     //!
     //! \ingroup type_erasure_classes
@@ -47,7 +49,7 @@ namespace core{
     {
         private:
             //! internal pointer type 
-            using pointer_type = std::unique_ptr<value_holder_interface>;
+            using pointer_type = value_storage;
 
             template<typename T>
             using enable_primitive = std::enable_if<is_primitive_type<T>::value>;
@@ -104,6 +106,9 @@ namespace core{
 #ifdef _MSC_VER
 #pragma warning(default:4251)
 #endif
+
+            //! typed access for visitors
+            friend struct visit_access<value>;
         public:
             //================constructors and destructor======================
             //! default constructor
@@ -122,7 +127,7 @@ namespace core{
                      typename T,
                      typename = typename enable_primitive<T>::type 
                     > 
-            explicit value(T v):_ptr(new value_holder<T>(v)){}
+            explicit value(T v):_ptr(value_holder<T>(v)){}
 
             //-----------------------------------------------------------------
             //!
@@ -134,7 +139,7 @@ namespace core{
             //! 
             //! \brief move constructor
             //!
-            value(value &&o);
+            value(value &&o) noexcept;
 
             //==================assignment operators===========================
             //! 
@@ -151,7 +156,7 @@ namespace core{
 
             //-----------------------------------------------------------------
             //! move assignment operator
-            value &operator=(value &&o);
+            value &operator=(value &&o) noexcept;
 
             //----------------------------------------------------------------
             //! copy construction from a value reference
@@ -23,6 +23,9 @@
 //
 #pragma once
 
+#include <new>
+#include <functional>
+#include <type_traits>
 #include <pni/core/types/type_id_map.hpp>
 #include <pni/core/type_erasures/value_holder_interface.hpp>
 
@@ -162,6 +165,9 @@ namespace core{
         typedef const  T &const_reference_type;
     };
 
+    //forward declaration
+    template<typename T> struct is_local_holder;
+
     //-------------------------------------------------------------------------
     //!
     //! \ingroup type_erasure_classes_internal
@@ -176,6 +182,20 @@ namespace core{
         private:
             T _value; //!< the data value
 
+            //----------------------------------------------------------------
+            //! clone to the buffer
+            value_holder_interface *_clone(void *buffer,std::true_type) const
+            {
+                return new (buffer) value_holder<T>(_value);
+            }
+
+            //----------------------------------------------------------------
+            //! clone on the heap
+            value_holder_interface *_clone(void *,std::false_type) const
+            {
+                return clone();
+            }
+
         public:
             //----------------------------------------------------------------
             //!
@@ -218,6 +238,21 @@ namespace core{
                 return new value_holder<T>(_value);
             }
 
+            //----------------------------------------------------------------
+            //!
+            //! \brief clone holder instance to buffer
+            //!
+            //! \param buffer pointer to an instance of value_buffer
+            //! \return pointer to a new instance of value holder
+            //!
+            virtual value_holder_interface *clone(void *buffer) const
+            {
+                typedef std::integral_constant<bool,
+                            is_local_holder<T>::value> local_type;
+
+                return _clone(buffer,local_type());
+            }
+
             //----------------------------------------------------------------
             //!
             //! \brief return value
@@ -254,6 +289,42 @@ namespace core{
             }
     };
 
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup type_erasure_classes_internal
+    //! \brief inline storage for value holders
+    //!
+    //! Raw storage large enough for a holder of every primitive type
+    //! (the largest being complex128) and of a reference to it.
+    //!
+    typedef std::aligned_storage<
+                (sizeof(value_holder<complex128>) >
+                 sizeof(value_holder<std::reference_wrapper<uint8>>) ?
+                 sizeof(value_holder<complex128>) :
+                 sizeof(value_holder<std::reference_wrapper<uint8>>)),
+                alignof(value_holder<complex128>)>::type value_buffer;
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup type_erasure_classes_internal
+    //! \brief check if a holder is stored in a value_buffer
+    //!
+    //! Value is true if a value_holder<T> fits into a value_buffer. Strings
+    //! and binary data own memory on the heap anyway and are therefore
+    //! kept on the heap where they can be moved without copying.
+    //!
+    //! \tparam T type wrapped by the holder
+    //!
+    template<typename T> struct is_local_holder
+    {
+        //! true if the holder is stored inline
+        static const bool value =
+            sizeof(value_holder<T>)<=sizeof(value_buffer) &&
+            alignof(value_holder<T>)<=alignof(value_buffer) &&
+            !std::is_same<T,string>::value &&
+            !std::is_same<T,binary>::value;
+    };
+
 
 //end of namespace
 }
@@ -39,6 +39,10 @@ namespace core{
     class value_holder_interface
     {
         public:
+            //-----------------------------------------------------------------
+            //! destructor
+            virtual ~value_holder_interface() {}
+
             //-----------------------------------------------------------------
             //!
             //! \brief get type id
@@ -56,6 +60,18 @@ namespace core{
             //!
             virtual value_holder_interface *clone() const = 0;
 
+            //-----------------------------------------------------------------
+            //!
+            //! \brief clone to buffer
+            //!
+            //! Clone the holder object into a value_buffer. Holders which do
+            //! not fit into the buffer are cloned on the heap.
+            //!
+            //! \param buffer pointer to an instance of value_buffer
+            //! \return pointer to new holder instance
+            //!
+            virtual value_holder_interface *clone(void *buffer) const = 0;
+
             //-----------------------------------------------------------------
             //!
             //! \brief check for reference
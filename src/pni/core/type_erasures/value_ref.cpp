@@ -48,15 +48,13 @@ namespace core{
     //-------------------------------------------------------------------------
     // Implementation of constructors
     //-------------------------------------------------------------------------
-    value_ref::value_ref():_ptr(nullptr)
+    value_ref::value_ref():_ptr()
     {}
 
     //-------------------------------------------------------------------------
     value_ref::value_ref(const value_ref &o)
-        :_ptr(nullptr)
-    {
-        if(o._ptr) _ptr = pointer_type(o._ptr->clone());
-    }
+        :_ptr(o._ptr)
+    {}
 
     //-------------------------------------------------------------------------
     // Implementation of assignment operators
@@ -64,7 +62,7 @@ namespace core{
     value_ref &value_ref::operator=(const value_ref &o)
     {
         if(this == &o) return *this;
-        _ptr = pointer_type(o._ptr->clone());
+        _ptr = o._ptr;
 
         return *this;
     }
@@ -28,6 +28,7 @@
 #include <pni/core/error/exceptions.hpp>
 #include <pni/core/types/types.hpp>
 #include <pni/core/type_erasures/value_holder.hpp>
+#include <pni/core/type_erasures/value_storage.hpp>
 #include <pni/core/type_erasures/utils.hpp>
 
 #include <pni/core/windows.hpp>
@@ -46,7 +47,7 @@ namespace core{
     {
         private:
             //! internal pointer type used to hold the reference instance
-            typedef std::unique_ptr<value_holder_interface> pointer_type;
+            typedef value_storage pointer_type;
 
             //----------------------------------------------------------------
             //!
@@ -150,7 +151,7 @@ namespace core{
             //!
             template<typename T>
             explicit value_ref(std::reference_wrapper<T> v):
-                _ptr(new value_holder<std::reference_wrapper<T> >(v))
+                _ptr(value_holder<std::reference_wrapper<T> >(v))
             {}
 
             //-----------------------------------------------------------------
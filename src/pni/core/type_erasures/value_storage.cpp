@@ -0,0 +1,133 @@
+//
+// (c) Copyright 2026 DESY, Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+// This file is part of libpnicore.
+//
+// libpnicore is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpnicore is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpnicore.  If not, see <http://www.gnu.org/licenses/>.
+//
+// ============================================================================
+//
+// Created on: Oct 16, 2026
+//     Author: Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+
+#include <pni/core/type_erasures/value_storage.hpp>
+
+namespace pni{
+namespace core{
+
+    //-------------------------------------------------------------------------
+    // Implementation of private member functions
+    //-------------------------------------------------------------------------
+    void value_storage::_copy(const value_storage &o)
+    {
+        if(!o._ptr) return;
+
+        _ptr = o._local ? o._ptr->clone(&_buffer) : o._ptr->clone();
+        _local = o._local;
+    }
+
+    //-------------------------------------------------------------------------
+    void value_storage::_move(value_storage &o) noexcept
+    {
+        if(!o._ptr) return;
+
+        if(o._local)
+        {
+            //local holders wrap trivial types - cloning does not throw
+            _ptr = o._ptr->clone(&_buffer);
+            _local = true;
+            o.reset();
+        }
+        else
+        {
+            _ptr = o._ptr;
+            _local = false;
+            o._ptr = nullptr;
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    // Implementation of constructors
+    //-------------------------------------------------------------------------
+    value_storage::value_storage() noexcept:
+        _ptr(nullptr),
+        _local(false)
+    {}
+
+    //-------------------------------------------------------------------------
+    value_storage::value_storage(const value_storage &o):
+        _ptr(nullptr),
+        _local(false)
+    {
+        _copy(o);
+    }
+
+    //-------------------------------------------------------------------------
+    value_storage::value_storage(value_storage &&o) noexcept:
+        _ptr(nullptr),
+        _local(false)
+    {
+        _move(o);
+    }
+
+    //-------------------------------------------------------------------------
+    value_storage::~value_storage()
+    {
+        reset();
+    }
+
+    //-------------------------------------------------------------------------
+    // Implementation of assignment operators
+    //-------------------------------------------------------------------------
+    value_storage &value_storage::operator=(const value_storage &o)
+    {
+        if(this == &o) return *this;
+
+        //a copy of a heap holder may throw - keep the old one until then
+        value_storage tmp(o);
+        reset();
+        _move(tmp);
+        return *this;
+    }
+
+    //-------------------------------------------------------------------------
+    value_storage &value_storage::operator=(value_storage &&o) noexcept
+    {
+        if(this == &o) return *this;
+
+        reset();
+        _move(o);
+        return *this;
+    }
+
+    //-------------------------------------------------------------------------
+    // Implementation of public member functions
+    //-------------------------------------------------------------------------
+    void value_storage::reset() noexcept
+    {
+        if(!_ptr) return;
+
+        if(_local)
+            _ptr->~value_holder_interface();
+        else
+            delete _ptr;
+
+        _ptr = nullptr;
+        _local = false;
+    }
+
+//end of namespace
+}
+}
@@ -0,0 +1,143 @@
+//
+// (c) Copyright 2026 DESY, Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+// This file is part of libpnicore.
+//
+// libpnicore is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpnicore is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpnicore.  If not, see <http://www.gnu.org/licenses/>.
+//
+// ============================================================================
+//
+// Created on: Oct 16, 2026
+//     Author: Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+#pragma once
+
+#include <pni/core/type_erasures/value_holder.hpp>
+#include <pni/core/windows.hpp>
+
+namespace pni{
+namespace core{
+
+    //!
+    //! \ingroup type_erasure_classes_internal
+    //! \brief storage for a value holder
+    //!
+    //! Owns the holder instance of a value or value_ref. Holders of
+    //! primitive types and references are constructed in an internal
+    //! value_buffer so that creating, copying, and moving a type erasure
+    //! does not allocate memory. Only holders for which is_local_holder
+    //! is false (strings and binary data) are allocated on the heap.
+    //!
+    //! The interface mimics std::unique_ptr<value_holder_interface>.
+    //!
+    class PNICORE_EXPORT value_storage
+    {
+        private:
+            value_buffer _buffer;          //!< inline storage
+            value_holder_interface *_ptr;  //!< pointer to the holder
+            bool _local;                   //!< true if _ptr points to _buffer
+
+            //-----------------------------------------------------------------
+            //! construct in the buffer
+            template<typename T>
+            void _create(const value_holder<T> &holder,std::true_type)
+            {
+                _ptr = new (&_buffer) value_holder<T>(holder);
+            }
+
+            //-----------------------------------------------------------------
+            //! construct on the heap
+            template<typename T>
+            void _create(const value_holder<T> &holder,std::false_type)
+            {
+                _ptr = new value_holder<T>(holder);
+            }
+
+            //-----------------------------------------------------------------
+            //! copy the holder of another instance
+            void _copy(const value_storage &o);
+
+            //-----------------------------------------------------------------
+            //! move the holder of another instance - o is empty afterwards
+            void _move(value_storage &o) noexcept;
+        public:
+            //================constructors and destructor======================
+            //! default constructor - no holder
+            value_storage() noexcept;
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief constructor
+            //!
+            //! Stores a copy of a holder.
+            //!
+            //! \tparam T type wrapped by the holder
+            //! \param holder the holder to store
+            //!
+            template<typename T>
+            explicit value_storage(const value_holder<T> &holder):
+                _ptr(nullptr),
+                _local(is_local_holder<T>::value)
+            {
+                _create(holder,std::integral_constant<bool,
+                                            is_local_holder<T>::value>());
+            }
+
+            //-----------------------------------------------------------------
+            //! copy constructor
+            value_storage(const value_storage &o);
+
+            //-----------------------------------------------------------------
+            //! move constructor
+            value_storage(value_storage &&o) noexcept;
+
+            //-----------------------------------------------------------------
+            //! destructor
+            ~value_storage();
+
+            //==================assignment operators===========================
+            //! copy assignment
+            value_storage &operator=(const value_storage &o);
+
+            //-----------------------------------------------------------------
+            //! move assignment
+            value_storage &operator=(value_storage &&o) noexcept;
+
+            //=====================public member functions=====================
+            //!
+            //! \brief destroy the holder
+            //!
+            //! Afterwards the instance is empty.
+            //!
+            void reset() noexcept;
+
+            //-----------------------------------------------------------------
+            //! get pointer to the holder - nullptr if empty
+            value_holder_interface *get() const noexcept { return _ptr; }
+
+            //-----------------------------------------------------------------
+            //! access the holder
+            value_holder_interface *operator->() const noexcept
+            {
+                return _ptr;
+            }
+
+            //-----------------------------------------------------------------
+            //! true if a holder is stored
+            explicit operator bool() const noexcept { return _ptr!=nullptr; }
+    };
+
+//end of namespace
+}
+}
@@ -0,0 +1,302 @@
+//
+// (c) Copyright 2026 DESY, Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+// This file is part of libpnicore.
+//
+// libpnicore is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpnicore is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpnicore.  If not, see <http://www.gnu.org/licenses/>.
+//
+// ============================================================================
+//
+// Created on: Oct 16, 2026
+//     Author: Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+#pragma once
+
+#include <type_traits>
+#include <boost/mpl/vector.hpp>
+#include <boost/mpl/joint_view.hpp>
+#include <boost/mpl/contains.hpp>
+
+#include <pni/core/error/exceptions.hpp>
+#include <pni/core/types/types.hpp>
+#include <pni/core/types/id_type_map.hpp>
+#include <pni/core/arrays.hpp>
+#include <pni/core/type_erasures/array.hpp>
+#include <pni/core/type_erasures/value.hpp>
+#include <pni/core/type_erasures/utils.hpp>
+
+namespace pni{
+namespace core{
+
+    //!
+    //! \ingroup type_erasure_classes_internal
+    //! \brief typed access to a type erasure
+    //!
+    //! Provides the MPL sequence of types a type erasure of type TARGET can
+    //! hold and the typed data for each of these types.
+    //!
+    //! \tparam TARGET type erasure type
+    //!
+    template<typename TARGET> struct visit_access;
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup type_erasure_classes_internal
+    //! \brief typed access to a value
+    //!
+    template<> struct visit_access<value>
+    {
+        //! types a value can hold
+        typedef primitive_types types;
+
+        //! reference to the stored value
+        template<typename T> static T &get(value &v)
+        {
+            return get_holder_ptr<T>(v._ptr)->as();
+        }
+    };
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup type_erasure_classes_internal
+    //! \brief typed access to an array
+    //!
+    template<> struct visit_access<array>
+    {
+        //! types an array can hold
+        typedef boost::mpl::joint_view<numeric_types,
+                    boost::mpl::vector<bool_t,binary,string>> types;
+
+        //! array referring to the data of the type erasure
+        template<typename T> static external_array<T> get(array &a)
+        {
+            if(a._ptr && !a._ptr->is_c_ordered())
+                throw type_error(EXCEPTION_RECORD,
+                        "Only C-ordered arrays can be visited!");
+
+            if(a._ptr && !a._ptr->is_contiguous())
+                throw type_error(EXCEPTION_RECORD,
+                        "Non-contiguous views cannot be visited!");
+
+            return array_factory<external_array<T>>::wrap(
+                            a.shape<shape_t>(),static_cast<T*>(a.data()));
+        }
+    };
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup type_erasure_classes_internal
+    //! \brief entry of the visitor jump table
+    //!
+    //! The call function passes the typed data of the type erasure to the
+    //! visitor if T is one of the types the type erasure can hold and
+    //! throws type_error otherwise.
+    //!
+    //! \tparam TARGET type erasure type
+    //! \tparam T type for which the entry is created
+    //! \tparam F visitor type
+    //! \tparam R return type of the visitor
+    //!
+    template<
+             typename TARGET,
+             typename T,
+             typename F,
+             typename R,
+             bool     valid = boost::mpl::contains<
+                                typename visit_access<TARGET>::types,T>::value
+            >
+    struct visit_entry
+    {
+        //! call the visitor
+        static R call(TARGET &t,F &f)
+        {
+            auto &&data = visit_access<TARGET>::template get<T>(t);
+            return f(data);
+        }
+    };
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup type_erasure_classes_internal
+    //! \brief jump table entry for unsupported types
+    //!
+    template<
+             typename TARGET,
+             typename T,
+             typename F,
+             typename R
+            >
+    struct visit_entry<TARGET,T,F,R,false>
+    {
+        //! throw type_error
+        static R call(TARGET &,F &)
+        {
+            throw type_error(EXCEPTION_RECORD,
+                    "Type erasure holds data of an unsupported type!");
+        }
+    };
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup type_erasure_classes_internal
+    //! \brief visitor jump table
+    //!
+    //! Table with one function per type ID. The position of the function
+    //! is the integer value of the type ID so that the visitor is called
+    //! after a single indirect jump.
+    //!
+    //! \tparam TARGET type erasure type
+    //! \tparam F visitor type
+    //! \tparam R return type of the visitor
+    //! \tparam IDS type ID list
+    //!
+    template<
+             typename TARGET,
+             typename F,
+             typename R,
+             typename IDS = typename make_type_id_list<
+                                size_t(type_id_t::BOOL)+1>::type
+            >
+    struct visit_table;
+
+    //! \cond NO_API_DOC
+    template<
+             typename TARGET,
+             typename F,
+             typename R,
+             size_t ...IDS
+            >
+    struct visit_table<TARGET,F,R,type_id_list<IDS...>>
+    {
+        //! function type of a table entry
+        typedef R (*function_type)(TARGET &,F &);
+        //! the table
+        static const function_type functions[sizeof...(IDS)];
+
+        //! call the entry for the type ID of t
+        static R call(TARGET &t,F &f)
+        {
+            return functions[size_t(t.type_id())](t,f);
+        }
+    };
+
+    template<
+             typename TARGET,
+             typename F,
+             typename R,
+             size_t ...IDS
+            >
+    const typename visit_table<TARGET,F,R,type_id_list<IDS...>>::
+                   function_type
+    visit_table<TARGET,F,R,type_id_list<IDS...>>::functions[] =
+    {
+        &visit_entry<TARGET,
+                     typename id_type_map<type_id_t(IDS)>::type,
+                     F,R>::call...
+    };
+    //! \endcond NO_API_DOC
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup type_erasure_classes
+    //! \brief apply a visitor to an array
+    //!
+    //! Calls f with an external_array<T> referring to the data of the
+    //! type erasure, where T is the element type of the array. The type
+    //! is resolved once with a jump table, so that f runs on the typed
+    //! data without any further dispatching. No data is copied. The typed
+    //! array uses C-ordering, thus arrays with a different storage order 
+    //! (for instance dynamic_fmap) cannot be visited. Views can only be 
+    //! visited if their selection is contiguous. f must accept an 
+    //! external_array for every element type. The return type is the one 
+    //! for uint8.
+    /*!
+    \code
+    struct sum_visitor
+    {
+        template<typename T> float64 operator()(external_array<T> &a) const
+        {
+            return std::accumulate(a.begin(),a.end(),float64(0));
+        }
+
+        template<typename T> float64 operator()(T &) const
+        {
+            throw type_error(EXCEPTION_RECORD,"Cannot sum this type!");
+        }
+    };
+
+    array data = ...;
+    float64 sum = visit(data,sum_visitor());
+    \endcode
+    !*/
+    //!
+    //! \throws memory_not_allocated_error if the array holds no data
+    //! \throws type_error if the element type is not supported, the array
+    //!                    is not C-ordered, or it is a non-contiguous view
+    //! \tparam F visitor type
+    //! \param a reference to the array
+    //! \param f the visitor
+    //! \return the result of f
+    //!
+    template<typename F>
+    auto visit(array &a,F &&f)
+        -> decltype(f(std::declval<external_array<uint8>&>()))
+    {
+        typedef typename std::remove_reference<F>::type visitor_type;
+        typedef decltype(f(std::declval<external_array<uint8>&>()))
+                result_type;
+
+        return visit_table<array,visitor_type,result_type>::call(a,f);
+    }
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup type_erasure_classes
+    //! \brief apply a visitor to a value
+    //!
+    //! Calls f with a reference to the value stored in the type erasure.
+    //! The type is resolved once with a jump table. f must accept
+    //! references to all primitive types including none. The return type
+    //! is the one for uint8.
+    /*!
+    \code
+    struct scale_visitor
+    {
+        template<typename T> void operator()(T &v) const { v *= 2; }
+        void operator()(string &) const {}
+        ...
+    };
+
+    value v(uint16(5));
+    visit(v,scale_visitor());
+    \endcode
+    !*/
+    //!
+    //! \tparam F visitor type
+    //! \param v reference to the value
+    //! \param f the visitor
+    //! \return the result of f
+    //!
+    template<typename F>
+    auto visit(value &v,F &&f) -> decltype(f(std::declval<uint8&>()))
+    {
+        typedef typename std::remove_reference<F>::type visitor_type;
+        typedef decltype(f(std::declval<uint8&>())) result_type;
+
+        return visit_table<value,visitor_type,result_type>::call(v,f);
+    }
+
+//end of namespace
+}
+}
@@ -84,5 +84,32 @@ namespace core{
     CREATE_ID_TYPE_MAP(type_id_t::NONE,none);
     //! \endcond NO_API_DOC
 
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup type_classes_internal
+    //! \brief list of type IDs
+    //!
+    //! \tparam IDS integer values of the type IDs
+    //!
+    template<size_t ...IDS> struct type_id_list {};
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup type_classes_internal
+    //! \brief create list of the first N type IDs
+    //!
+    template<
+             size_t N,
+             size_t ...IDS
+            >
+    struct make_type_id_list : make_type_id_list<N-1,N-1,IDS...> {};
+
+    //! \cond NO_API_DOC
+    template<size_t ...IDS> struct make_type_id_list<0,IDS...>
+    {
+        typedef type_id_list<IDS...> type;
+    };
+    //! \endcond NO_API_DOC
+
 }
 }
@@ -24,6 +24,10 @@
 #pragma once
 
 
+#include <pni/core/utilities/aligned_allocator.hpp>
+#include <pni/core/utilities/buffer_pool.hpp>
 #include <pni/core/utilities/container_iterator.hpp>
 #include <pni/core/utilities/container_utils.hpp>
+#include <pni/core/utilities/numa_allocator.hpp>
 #include <pni/core/utilities/service.hpp>
+#include <pni/core/utilities/thread_pool.hpp>
@@ -0,0 +1,140 @@
+//
+// (c) Copyright 2026 DESY, Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+// This file is part of libpnicore.
+//
+// libpnicore is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpnicore is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpnicore.  If not, see <http://www.gnu.org/licenses/>.
+//
+// ============================================================================
+//
+// Created on: Oct 16, 2026
+//     Author: Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+
+#include <cstdlib>
+#include <cstdint>
+#include <pni/core/utilities/aligned_allocator.hpp>
+
+#ifdef _MSC_VER
+#include <malloc.h>
+#endif
+
+#ifdef __linux__
+#include <sys/mman.h>
+#define PNI_CORE_HUGE_PAGES
+#endif
+
+namespace pni{
+namespace core{
+
+    //-------------------------------------------------------------------------
+    void *aligned_allocate(size_t bytes,size_t alignment)
+    {
+        if(alignment<sizeof(void*)) alignment = sizeof(void*);
+        if(bytes==0) bytes = 1;
+
+#ifdef _MSC_VER
+        void *ptr = _aligned_malloc(bytes,alignment);
+        if(!ptr) throw std::bad_alloc();
+#else
+        void *ptr = nullptr;
+        if(posix_memalign(&ptr,alignment,bytes)!=0) throw std::bad_alloc();
+#endif
+        return ptr;
+    }
+
+    //-------------------------------------------------------------------------
+    void aligned_deallocate(void *ptr)
+    {
+#ifdef _MSC_VER
+        _aligned_free(ptr);
+#else
+        free(ptr);
+#endif
+    }
+
+#ifdef PNI_CORE_HUGE_PAGES
+    namespace {
+        //! round up to a multiple of the huge page size
+        size_t huge_page_length(size_t bytes)
+        {
+            return (bytes+huge_page_size-1)/huge_page_size*huge_page_size;
+        }
+
+        //! map anonymous memory aligned to a huge page boundary
+        void *map_transparent(size_t length)
+        {
+            //over-allocate by one huge page and trim the ends
+            size_t total = length+huge_page_size;
+            void *ptr = mmap(nullptr,total,PROT_READ|PROT_WRITE,
+                             MAP_PRIVATE|MAP_ANONYMOUS,-1,0);
+            if(ptr==MAP_FAILED) throw std::bad_alloc();
+
+            uintptr_t begin = reinterpret_cast<uintptr_t>(ptr);
+            uintptr_t start = (begin+huge_page_size-1)/huge_page_size*
+                              huge_page_size;
+            if(start!=begin) munmap(ptr,start-begin);
+            size_t tail = begin+total-(start+length);
+            if(tail) munmap(reinterpret_cast<void*>(start+length),tail);
+
+            ptr = reinterpret_cast<void*>(start);
+#ifdef MADV_HUGEPAGE
+            madvise(ptr,length,MADV_HUGEPAGE);
+#endif
+            return ptr;
+        }
+    }
+#endif
+
+    //-------------------------------------------------------------------------
+    void *huge_page_allocate(size_t bytes,huge_page_policy policy)
+    {
+#ifdef PNI_CORE_HUGE_PAGES
+        if(bytes<huge_page_size)
+            return aligned_allocate(bytes,cache_line_size);
+
+        size_t length = huge_page_length(bytes);
+#ifdef MAP_HUGETLB
+        if(policy==huge_page_policy::EXPLICIT)
+        {
+            void *ptr = mmap(nullptr,length,PROT_READ|PROT_WRITE,
+                             MAP_PRIVATE|MAP_ANONYMOUS|MAP_HUGETLB,-1,0);
+            if(ptr!=MAP_FAILED) return ptr;
+        }
+#endif
+        return map_transparent(length);
+#else
+        (void)policy;
+        return aligned_allocate(bytes,cache_line_size);
+#endif
+    }
+
+    //-------------------------------------------------------------------------
+    void huge_page_deallocate(void *ptr,size_t bytes)
+    {
+        if(!ptr) return;
+#ifdef PNI_CORE_HUGE_PAGES
+        if(bytes<huge_page_size)
+            aligned_deallocate(ptr);
+        else
+            munmap(ptr,huge_page_length(bytes));
+#else
+        (void)bytes;
+        aligned_deallocate(ptr);
+#endif
+    }
+
+//end of namespace
+}
+}
@@ -0,0 +1,394 @@
+//
+// (c) Copyright 2026 DESY, Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+// This file is part of libpnicore.
+//
+// libpnicore is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpnicore is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpnicore.  If not, see <http://www.gnu.org/licenses/>.
+//
+// ============================================================================
+//
+// Created on: Oct 16, 2026
+//     Author: Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+#pragma once
+
+#include <cstddef>
+#include <limits>
+#include <new>
+#include <utility>
+
+#include <pni/core/windows.hpp>
+#include <pni/core/utilities/container_utils.hpp>
+
+namespace pni{
+namespace core{
+
+    //!
+    //! \ingroup utility_classes
+    //! \brief cache line size
+    //!
+    //! This is also the width of an AVX-512 vector register. Memory aligned
+    //! to this boundary never splits a vector load or store over two cache
+    //! lines.
+    //!
+    const size_t cache_line_size = 64;
+
+    //!
+    //! \ingroup utility_classes
+    //! \brief size of a huge page
+    //!
+    const size_t huge_page_size = 2*1024*1024;
+
+    //!
+    //! \ingroup utility_classes
+    //! \brief huge page policies
+    //!
+    enum class huge_page_policy { TRANSPARENT, //!< transparent huge pages
+                                  EXPLICIT     //!< reserved huge pages
+                                };
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup utility_classes
+    //! \brief allocate aligned memory
+    //!
+    //! \throws std::bad_alloc if the memory cannot be allocated
+    //! \param bytes number of bytes to allocate
+    //! \param alignment alignment in bytes (a power of 2)
+    //! \return pointer to the memory
+    //!
+    PNICORE_EXPORT void *aligned_allocate(size_t bytes,size_t alignment);
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup utility_classes
+    //! \brief free aligned memory
+    //!
+    //! \param ptr pointer returned by aligned_allocate
+    //!
+    PNICORE_EXPORT void aligned_deallocate(void *ptr);
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup utility_classes
+    //! \brief allocate memory backed by huge pages
+    //!
+    //! Allocations are rounded up to a multiple of huge_page_size. With the
+    //! transparent policy anonymous memory is mapped and the kernel is
+    //! advised to back it with transparent huge pages. The explicit policy
+    //! uses pages from the reserved huge page pool and falls back to
+    //! transparent huge pages if the pool is exhausted. Allocations smaller
+    //! than a huge page and platforms without huge page support use
+    //! ordinary cache line aligned memory.
+    //!
+    //! \throws std::bad_alloc if the memory cannot be allocated
+    //! \param bytes number of bytes to allocate
+    //! \param policy huge page policy
+    //! \return pointer to the memory
+    //!
+    PNICORE_EXPORT void *huge_page_allocate(size_t bytes,
+                                            huge_page_policy policy);
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup utility_classes
+    //! \brief free memory backed by huge pages
+    //!
+    //! \param ptr pointer returned by huge_page_allocate
+    //! \param bytes number of bytes passed to huge_page_allocate
+    //!
+    PNICORE_EXPORT void huge_page_deallocate(void *ptr,size_t bytes);
+
+    //=========================================================================
+    //!
+    //! \ingroup utility_classes
+    //! \brief aligned allocator
+    //!
+    //! An STL allocator returning memory aligned to ALIGN bytes. The default
+    //! is the cache line size.
+    /*!
+    \code
+    std::vector<float32,aligned_allocator<float32>> data(1024);
+    \endcode
+    */
+    //!
+    //! \tparam T element type
+    //! \tparam ALIGN alignment in bytes (a power of 2)
+    //!
+    template<
+             typename T,
+             size_t   ALIGN = cache_line_size
+            >
+    class aligned_allocator
+    {
+        static_assert((ALIGN&(ALIGN-1))==0,"alignment must be a power of 2!");
+        private:
+            //! value initialize elements constructed without arguments
+            bool _init;
+        public:
+            //! element type
+            typedef T value_type;
+            //! pointer type
+            typedef T *pointer;
+            //! const pointer type
+            typedef const T *const_pointer;
+            //! reference type
+            typedef T &reference;
+            //! const reference type
+            typedef const T &const_reference;
+            //! size type
+            typedef size_t size_type;
+            //! difference type
+            typedef std::ptrdiff_t difference_type;
+
+            //! rebind the allocator to another type
+            template<typename U> struct rebind
+            {
+                //! allocator type for U
+                typedef aligned_allocator<U,ALIGN> other;
+            };
+
+            //! alignment in bytes
+            static const size_t alignment = ALIGN;
+
+            //-----------------------------------------------------------------
+            //! default constructor - elements are value initialized
+            aligned_allocator() noexcept:_init(true) {}
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief constructor for uninitialized containers
+            //!
+            //! Elements constructed without arguments are default 
+            //! initialized - elements of trivial types are thus left 
+            //! uninitialized. Used by container_utils::create(n,no_init). 
+            //!
+            explicit aligned_allocator(no_init_t) noexcept:_init(false) {}
+
+            //-----------------------------------------------------------------
+            //! conversion constructor
+            template<typename U>
+            aligned_allocator(const aligned_allocator<U,ALIGN> &a) noexcept:
+                _init(a.initializes())
+            {}
+
+            //-----------------------------------------------------------------
+            //! true if elements are value initialized
+            bool initializes() const noexcept { return _init; }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief allocate memory
+            //!
+            //! \throws std::bad_alloc if the memory cannot be allocated
+            //! \param n number of elements
+            //! \return pointer to the memory
+            //!
+            T *allocate(size_t n)
+            {
+                if(n>std::numeric_limits<size_t>::max()/sizeof(T))
+                    throw std::bad_alloc();
+
+                return static_cast<T*>(aligned_allocate(n*sizeof(T),ALIGN));
+            }
+
+            //-----------------------------------------------------------------
+            //! free memory
+            void deallocate(T *ptr,size_t) noexcept
+            {
+                aligned_deallocate(ptr);
+            }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief construct an element without arguments
+            //!
+            //! The element is value initialized unless the allocator was 
+            //! created with no_init.
+            //!
+            template<typename U> void construct(U *ptr)
+            {
+                if(_init) ::new(static_cast<void*>(ptr)) U();
+                else      ::new(static_cast<void*>(ptr)) U;
+            }
+
+            //-----------------------------------------------------------------
+            //! construct an element
+            template<
+                     typename    U,
+                     typename... ARGS
+                    >
+            void construct(U *ptr,ARGS&&... args)
+            {
+                ::new(static_cast<void*>(ptr)) U(std::forward<ARGS>(args)...);
+            }
+    };
+
+    //! \cond NO_API_DOC
+    template<typename T,typename U,size_t ALIGN>
+    bool operator==(const aligned_allocator<T,ALIGN> &,
+                    const aligned_allocator<U,ALIGN> &)
+    {
+        return true;
+    }
+
+    template<typename T,typename U,size_t ALIGN>
+    bool operator!=(const aligned_allocator<T,ALIGN> &,
+                    const aligned_allocator<U,ALIGN> &)
+    {
+        return false;
+    }
+    //! \endcond
+
+    //=========================================================================
+    //!
+    //! \ingroup utility_classes
+    //! \brief huge page allocator
+    //!
+    //! An STL allocator for large buffers backed by huge pages. This reduces
+    //! the number of TLB misses when streaming over multi-GB arrays. The
+    //! memory is always at least cache line aligned.
+    /*!
+    \code
+    std::vector<uint16,huge_page_allocator<uint16>> stack(100*2048*2048);
+    \endcode
+    */
+    //!
+    //! \tparam T element type
+    //! \tparam POLICY huge page policy
+    //!
+    template<
+             typename         T,
+             huge_page_policy POLICY = huge_page_policy::TRANSPARENT
+            >
+    class huge_page_allocator
+    {
+        private:
+            //! value initialize elements constructed without arguments
+            bool _init;
+        public:
+            //! element type
+            typedef T value_type;
+            //! pointer type
+            typedef T *pointer;
+            //! const pointer type
+            typedef const T *const_pointer;
+            //! reference type
+            typedef T &reference;
+            //! const reference type
+            typedef const T &const_reference;
+            //! size type
+            typedef size_t size_type;
+            //! difference type
+            typedef std::ptrdiff_t difference_type;
+
+            //! rebind the allocator to another type
+            template<typename U> struct rebind
+            {
+                //! allocator type for U
+                typedef huge_page_allocator<U,POLICY> other;
+            };
+
+            //-----------------------------------------------------------------
+            //! default constructor - elements are value initialized
+            huge_page_allocator() noexcept:_init(true) {}
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief constructor for uninitialized containers
+            //!
+            //! Elements constructed without arguments are default 
+            //! initialized - elements of trivial types are thus left 
+            //! uninitialized. Used by container_utils::create(n,no_init). 
+            //!
+            explicit huge_page_allocator(no_init_t) noexcept:_init(false) {}
+
+            //-----------------------------------------------------------------
+            //! conversion constructor
+            template<typename U>
+            huge_page_allocator(const huge_page_allocator<U,POLICY> &a) noexcept:
+                _init(a.initializes())
+            {}
+
+            //-----------------------------------------------------------------
+            //! true if elements are value initialized
+            bool initializes() const noexcept { return _init; }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief allocate memory
+            //!
+            //! \throws std::bad_alloc if the memory cannot be allocated
+            //! \param n number of elements
+            //! \return pointer to the memory
+            //!
+            T *allocate(size_t n)
+            {
+                if(n>std::numeric_limits<size_t>::max()/sizeof(T))
+                    throw std::bad_alloc();
+
+                return static_cast<T*>(huge_page_allocate(n*sizeof(T),POLICY));
+            }
+
+            //-----------------------------------------------------------------
+            //! free memory
+            void deallocate(T *ptr,size_t n) noexcept
+            {
+                huge_page_deallocate(ptr,n*sizeof(T));
+            }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief construct an element without arguments
+            //!
+            //! The element is value initialized unless the allocator was 
+            //! created with no_init.
+            //!
+            template<typename U> void construct(U *ptr)
+            {
+                if(_init) ::new(static_cast<void*>(ptr)) U();
+                else      ::new(static_cast<void*>(ptr)) U;
+            }
+
+            //-----------------------------------------------------------------
+            //! construct an element
+            template<
+                     typename    U,
+                     typename... ARGS
+                    >
+            void construct(U *ptr,ARGS&&... args)
+            {
+                ::new(static_cast<void*>(ptr)) U(std::forward<ARGS>(args)...);
+            }
+    };
+
+    //! \cond NO_API_DOC
+    template<typename T,typename U,huge_page_policy P>
+    bool operator==(const huge_page_allocator<T,P> &,
+                    const huge_page_allocator<U,P> &)
+    {
+        return true;
+    }
+
+    template<typename T,typename U,huge_page_policy P>
+    bool operator!=(const huge_page_allocator<T,P> &,
+                    const huge_page_allocator<U,P> &)
+    {
+        return false;
+    }
+    //! \endcond
+
+//end of namespace
+}
+}
@@ -0,0 +1,133 @@
+//
+// (c) Copyright 2026 DESY, Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+// This file is part of libpnicore.
+//
+// libpnicore is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpnicore is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpnicore.  If not, see <http://www.gnu.org/licenses/>.
+//
+// ============================================================================
+//
+// Created on: Oct 16, 2026
+//     Author: Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+
+#include <pni/core/utilities/buffer_pool.hpp>
+#include <pni/core/utilities/aligned_allocator.hpp>
+
+namespace pni{
+namespace core{
+
+    //-------------------------------------------------------------------------
+    buffer_pool::buffer_pool(size_t capacity):
+        _mutex(),
+        _buffers(),
+        _capacity(capacity),
+        _statistics{0,0,0,0}
+    {}
+
+    //-------------------------------------------------------------------------
+    buffer_pool::~buffer_pool()
+    {
+        clear();
+    }
+
+    //-------------------------------------------------------------------------
+    void *buffer_pool::allocate(size_t bytes)
+    {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _statistics.bytes_in_use += bytes;
+
+            auto iter = _buffers.find(bytes);
+            if(iter!=_buffers.end() && !iter->second.empty())
+            {
+                void *ptr = iter->second.back();
+                iter->second.pop_back();
+                _statistics.bytes_resident -= bytes;
+                ++_statistics.hits;
+                return ptr;
+            }
+            ++_statistics.misses;
+        }
+
+        try
+        {
+            return aligned_allocate(bytes,cache_line_size);
+        }
+        catch(...)
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _statistics.bytes_in_use -= bytes;
+            throw;
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    void buffer_pool::deallocate(void *ptr,size_t bytes) noexcept
+    {
+        if(!ptr) return;
+
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _statistics.bytes_in_use -= bytes;
+
+            if(!_capacity || _statistics.bytes_resident+bytes<=_capacity)
+            {
+                try
+                {
+                    _buffers[bytes].push_back(ptr);
+                    _statistics.bytes_resident += bytes;
+                    return;
+                }
+                catch(...)
+                {
+                    //could not keep the buffer - free it
+                }
+            }
+        }
+
+        aligned_deallocate(ptr);
+    }
+
+    //-------------------------------------------------------------------------
+    void buffer_pool::clear()
+    {
+        std::map<size_t,std::vector<void*>> buffers;
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            buffers.swap(_buffers);
+            _statistics.bytes_resident = 0;
+        }
+
+        for(auto &entry: buffers)
+            for(auto ptr: entry.second) aligned_deallocate(ptr);
+    }
+
+    //-------------------------------------------------------------------------
+    buffer_pool_statistics buffer_pool::statistics() const
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _statistics;
+    }
+
+    //-------------------------------------------------------------------------
+    buffer_pool &buffer_pool::instance()
+    {
+        static buffer_pool pool;
+        return pool;
+    }
+
+//end of namespace
+}
+}
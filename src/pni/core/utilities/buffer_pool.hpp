@@ -0,0 +1,298 @@
+//
+// (c) Copyright 2026 DESY, Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+// This file is part of libpnicore.
+//
+// libpnicore is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpnicore is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpnicore.  If not, see <http://www.gnu.org/licenses/>.
+//
+// ============================================================================
+//
+// Created on: Oct 16, 2026
+//     Author: Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+#pragma once
+
+#include <cstddef>
+#include <limits>
+#include <map>
+#include <mutex>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <pni/core/windows.hpp>
+
+namespace pni{
+namespace core{
+
+    //!
+    //! \ingroup utility_classes
+    //! \brief buffer pool statistics
+    //!
+    struct buffer_pool_statistics
+    {
+        //! number of requests served from the pool
+        size_t hits;
+        //! number of requests which required a new allocation
+        size_t misses;
+        //! number of bytes held by the pool for reuse
+        size_t bytes_resident;
+        //! number of bytes currently handed out by the pool
+        size_t bytes_in_use;
+    };
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup utility_classes
+    //! \brief pool of memory buffers
+    //!
+    //! Recycles memory buffers keyed by their size in bytes. Released
+    //! buffers are kept in the pool and handed out again for the next
+    //! request of the same size. Loops allocating arrays of identical
+    //! shape thus avoid calls to malloc and free and - as the memory is
+    //! already mapped - page faults. Buffers are cache line aligned.
+    //!
+    //! The number of bytes kept for reuse can be limited. Buffers which
+    //! would exceed the limit are freed when they are released.
+    //!
+    //! All member functions are thread safe. The pool must outlive all
+    //! buffers allocated from it.
+    /*!
+    \code
+    buffer_pool pool;
+    void *frame = pool.allocate(2048*2048*sizeof(uint16));
+    pool.deallocate(frame,2048*2048*sizeof(uint16));
+
+    //served from the pool
+    frame = pool.allocate(2048*2048*sizeof(uint16));
+    \endcode
+    !*/
+    //!
+    class PNICORE_EXPORT buffer_pool
+    {
+        private:
+            //! protects the pool
+            mutable std::mutex _mutex;
+            //! released buffers by size
+            std::map<size_t,std::vector<void*>> _buffers;
+            //! maximum number of bytes kept for reuse (0 for no limit)
+            size_t _capacity;
+            //! statistics
+            buffer_pool_statistics _statistics;
+        public:
+            //================constructors and destructor======================
+            //!
+            //! \brief constructor
+            //!
+            //! \param capacity maximum number of bytes kept for reuse
+            //! (0 for no limit)
+            //!
+            explicit buffer_pool(size_t capacity = 0);
+
+            //-----------------------------------------------------------------
+            //! copy constructor - deleted
+            buffer_pool(const buffer_pool &) = delete;
+
+            //-----------------------------------------------------------------
+            //! copy assignment - deleted
+            buffer_pool &operator=(const buffer_pool &) = delete;
+
+            //-----------------------------------------------------------------
+            //! destructor - frees all buffers kept for reuse
+            ~buffer_pool();
+
+            //================public member functions==========================
+            //!
+            //! \brief allocate a buffer
+            //!
+            //! \throws std::bad_alloc if the memory cannot be allocated
+            //! \param bytes size of the buffer in bytes
+            //! \return pointer to the buffer
+            //!
+            void *allocate(size_t bytes);
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief release a buffer
+            //!
+            //! \param ptr pointer returned by allocate
+            //! \param bytes the size passed to allocate
+            //!
+            void deallocate(void *ptr,size_t bytes) noexcept;
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief free all buffers kept for reuse
+            //!
+            void clear();
+
+            //-----------------------------------------------------------------
+            //! get current statistics
+            buffer_pool_statistics statistics() const;
+
+            //-----------------------------------------------------------------
+            //! get maximum number of bytes kept for reuse
+            size_t capacity() const { return _capacity; }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief library buffer pool
+            //!
+            //! Pool used by default constructed pool allocators. It has no
+            //! capacity limit.
+            //!
+            //! \return reference to the library buffer pool
+            //!
+            static buffer_pool &instance();
+    };
+
+    //=========================================================================
+    //!
+    //! \ingroup utility_classes
+    //! \brief buffer pool allocator
+    //!
+    //! An STL allocator taking its memory from a buffer_pool. Elements
+    //! constructed without arguments are default initialized. Thus a
+    //! container of trivial types like
+    /*!
+    \code
+    buffer_pool pool;
+    std::vector<uint16,pool_allocator<uint16>> frame{
+        pool_allocator<uint16>(pool)};
+    frame.resize(2048*2048);
+    \endcode
+    */
+    //! does not touch its memory on construction.
+    //!
+    //! \tparam T element type
+    //!
+    template<typename T> class pool_allocator
+    {
+        private:
+            //! the pool
+            buffer_pool *_pool;
+
+            template<typename U> friend class pool_allocator;
+        public:
+            //! element type
+            typedef T value_type;
+            //! pointer type
+            typedef T *pointer;
+            //! const pointer type
+            typedef const T *const_pointer;
+            //! reference type
+            typedef T &reference;
+            //! const reference type
+            typedef const T &const_reference;
+            //! size type
+            typedef size_t size_type;
+            //! difference type
+            typedef std::ptrdiff_t difference_type;
+            //! containers take the allocator along on copy assignment
+            typedef std::true_type propagate_on_container_copy_assignment;
+            //! containers take the allocator along on move assignment
+            typedef std::true_type propagate_on_container_move_assignment;
+            //! containers swap allocators
+            typedef std::true_type propagate_on_container_swap;
+
+            //! rebind the allocator to another type
+            template<typename U> struct rebind
+            {
+                //! allocator type for U
+                typedef pool_allocator<U> other;
+            };
+
+            //-----------------------------------------------------------------
+            //! default constructor - uses the library buffer pool
+            pool_allocator() noexcept:_pool(&buffer_pool::instance()) {}
+
+            //-----------------------------------------------------------------
+            //! constructor
+            pool_allocator(buffer_pool &pool) noexcept:_pool(&pool) {}
+
+            //-----------------------------------------------------------------
+            //! conversion constructor
+            template<typename U>
+            pool_allocator(const pool_allocator<U> &a) noexcept:
+                _pool(a._pool)
+            {}
+
+            //-----------------------------------------------------------------
+            //! get the pool
+            buffer_pool &pool() const { return *_pool; }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief allocate memory
+            //!
+            //! \throws std::bad_alloc if the memory cannot be allocated
+            //! \param n number of elements
+            //! \return pointer to the memory
+            //!
+            T *allocate(size_t n)
+            {
+                if(n>std::numeric_limits<size_t>::max()/sizeof(T))
+                    throw std::bad_alloc();
+
+                return static_cast<T*>(_pool->allocate(n*sizeof(T)));
+            }
+
+            //-----------------------------------------------------------------
+            //! return memory to the pool
+            void deallocate(T *ptr,size_t n) noexcept
+            {
+                _pool->deallocate(ptr,n*sizeof(T));
+            }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief default initialize an element
+            //!
+            //! Elements of trivial types are left uninitialized.
+            //!
+            template<typename U> void construct(U *ptr)
+            {
+                ::new(static_cast<void*>(ptr)) U;
+            }
+
+            //-----------------------------------------------------------------
+            //! construct an element
+            template<
+                     typename    U,
+                     typename... ARGS
+                    >
+            void construct(U *ptr,ARGS&&... args)
+            {
+                ::new(static_cast<void*>(ptr)) U(std::forward<ARGS>(args)...);
+            }
+    };
+
+    //! \cond NO_API_DOC
+    template<typename T,typename U>
+    bool operator==(const pool_allocator<T> &a,const pool_allocator<U> &b)
+    {
+        return &a.pool() == &b.pool();
+    }
+
+    template<typename T,typename U>
+    bool operator!=(const pool_allocator<T> &a,const pool_allocator<U> &b)
+    {
+        return !(a==b);
+    }
+    //! \endcond
+
+//end of namespace
+}
+}
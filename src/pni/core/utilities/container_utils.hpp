@@ -27,6 +27,7 @@
 #include <iostream>
 #include <sstream>
 #include <tuple>
+#include <type_traits>
 #include <pni/core/error/exceptions.hpp>
 #include <pni/core/utilities/sfinae_macros.hpp>
 
@@ -34,6 +35,47 @@ namespace pni{
 namespace core{
 
 
+    //!
+    //! \ingroup utility_classes
+    //! \brief tag for creation without initialization
+    //!
+    //! Passed to creation functions to request that the elements of a new 
+    //! container are not initialized.
+    //!
+    struct no_init_t {};
+
+    //! 
+    //! \ingroup utility_classes
+    //! \brief instance of no_init_t
+    //!
+    const no_init_t no_init = no_init_t();
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup utility_classes
+    //! \brief check for an allocator supporting no_init
+    //!
+    //! value is true if CTYPE has an allocator which can be constructed 
+    //! from no_init. Such an allocator default initializes the elements it 
+    //! constructs without arguments.
+    //!
+    //! \tparam CTYPE container type
+    //!
+    template<typename CTYPE> 
+    struct has_no_init_allocator
+    {
+        private:
+            template<typename T>
+            static std::is_constructible<typename T::allocator_type,no_init_t>
+            test(typename T::allocator_type*);
+
+            template<typename T> static std::false_type test(...);
+        public:
+            //! true if the allocator supports no_init
+            static const bool value = decltype(test<CTYPE>(nullptr))::value;
+    };
+
+    //-------------------------------------------------------------------------
     //!
     //! \ingroup utility_classes
     //! \brief container utility
@@ -90,6 +132,57 @@ namespace core{
             return c;
         }
 
+        //---------------------------------------------------------------------
+        //!
+        //! \brief create container without initialization
+        //!
+        //! Create a new container of n elements without filling it with a 
+        //! default value. If the allocator of the container supports 
+        //! no_init (aligned_allocator and huge_page_allocator) the elements 
+        //! are constructed by an allocator created with no_init and are 
+        //! thus left uninitialized for trivial types. The returned container 
+        //! owns a default constructed allocator so that later resizes value 
+        //! initialize new elements as usual. pool_allocator always leaves 
+        //! trivial elements uninitialized. std::allocator initializes the 
+        //! elements with 0.
+        /*!
+        \code
+        typedef std::vector<uint16,huge_page_allocator<uint16>> vector_type;
+
+        auto v = container_utils<vector_type>::create(1024*1024*1024,no_init);
+        \endcode
+        !*/
+        //!
+        //! \param n number of elements
+        //! \return instance of container type of size n
+        //!
+        static container_type create(size_t n,no_init_t)
+        {
+            return create(n,no_init,
+                          std::integral_constant<bool,
+                          has_no_init_allocator<container_type>::value>());
+        }
+
+        //---------------------------------------------------------------------
+        //! create without initialization by an allocator supporting no_init
+        static container_type create(size_t n,no_init_t,std::true_type)
+        {
+            typedef typename container_type::allocator_type allocator_type;
+
+            container_type c{allocator_type(no_init)};
+            c.resize(n);
+
+            //allocators compare equal - the memory is taken over
+            return container_type(std::move(c),allocator_type());
+        }
+
+        //---------------------------------------------------------------------
+        //! create without initialization by any other allocator
+        static container_type create(size_t n,no_init_t,std::false_type)
+        {
+            return container_type(n);
+        }
+
         //---------------------------------------------------------------------
         //!
         //! \brief create container from a range
@@ -247,6 +340,24 @@ namespace core{
             return v;
         }
 
+        //---------------------------------------------------------------------
+        //!
+        //! \brief create a container without initialization
+        //!
+        //! As std::array is returned by value leaving its elements 
+        //! uninitialized would not save anything. Thus this is the same as 
+        //! create(n).
+        //!
+        //! \throws size_mismatch_error if n does not match the size of 
+        //! std::array
+        //! \param n number of elements
+        //! \return instance of std::array
+        //!
+        static container_type create(size_t n,no_init_t)
+        {
+            return create(n);
+        }
+
         //---------------------------------------------------------------------
         //!
         //! \brief initialize std::array from an iterator range
@@ -0,0 +1,105 @@
+//
+// (c) Copyright 2026 DESY, Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+// This file is part of libpnicore.
+//
+// libpnicore is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpnicore is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpnicore.  If not, see <http://www.gnu.org/licenses/>.
+//
+// ============================================================================
+//
+// Created on: Oct 16, 2026
+//     Author: Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+
+#include <pni/core/utilities/numa_allocator.hpp>
+#include <pni/core/utilities/aligned_allocator.hpp>
+
+#ifdef __linux__
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#ifdef SYS_mbind
+#define PNI_CORE_NUMA
+#endif
+#endif
+
+namespace pni{
+namespace core{
+
+#ifdef PNI_CORE_NUMA
+    namespace {
+        //memory policy modes of the mbind system call (see numaif.h)
+        const int mpol_interleave = 3;
+        const int mpol_local = 4;
+
+        //! round up to a multiple of the huge page size
+        size_t numa_length(size_t bytes)
+        {
+            return (bytes+huge_page_size-1)/huge_page_size*huge_page_size;
+        }
+
+        //! apply a memory policy - failures are ignored
+        void bind(void *ptr,size_t length,numa_policy policy)
+        {
+            //the kernel restricts the mask to the nodes available
+            unsigned long nodes = ~0ul;
+            unsigned long max_node = 8*sizeof(nodes);
+
+            if(policy==numa_policy::INTERLEAVE)
+                syscall(SYS_mbind,ptr,length,mpol_interleave,&nodes,max_node,
+                        0);
+            else if(policy==numa_policy::LOCAL)
+                syscall(SYS_mbind,ptr,length,mpol_local,nullptr,0,0);
+        }
+    }
+#endif
+
+    //-------------------------------------------------------------------------
+    void *numa_allocate(size_t bytes,numa_policy policy)
+    {
+#ifdef PNI_CORE_NUMA
+        if(bytes<huge_page_size)
+            return aligned_allocate(bytes,cache_line_size);
+
+        size_t length = numa_length(bytes);
+        void *ptr = mmap(nullptr,length,PROT_READ|PROT_WRITE,
+                         MAP_PRIVATE|MAP_ANONYMOUS,-1,0);
+        if(ptr==MAP_FAILED) throw std::bad_alloc();
+
+        bind(ptr,length,policy);
+        return ptr;
+#else
+        (void)policy;
+        return aligned_allocate(bytes,cache_line_size);
+#endif
+    }
+
+    //-------------------------------------------------------------------------
+    void numa_deallocate(void *ptr,size_t bytes)
+    {
+        if(!ptr) return;
+#ifdef PNI_CORE_NUMA
+        if(bytes<huge_page_size)
+            aligned_deallocate(ptr);
+        else
+            munmap(ptr,numa_length(bytes));
+#else
+        (void)bytes;
+        aligned_deallocate(ptr);
+#endif
+    }
+
+//end of namespace
+}
+}
@@ -0,0 +1,194 @@
+//
+// (c) Copyright 2026 DESY, Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+// This file is part of libpnicore.
+//
+// libpnicore is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpnicore is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpnicore.  If not, see <http://www.gnu.org/licenses/>.
+//
+// ============================================================================
+//
+// Created on: Oct 16, 2026
+//     Author: Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+#pragma once
+
+#include <cstddef>
+#include <limits>
+#include <new>
+#include <utility>
+
+#include <pni/core/windows.hpp>
+
+namespace pni{
+namespace core{
+
+    //!
+    //! \ingroup utility_classes
+    //! \brief NUMA placement policies
+    //!
+    enum class numa_policy { FIRST_TOUCH, //!< node of the first access
+                             INTERLEAVE,  //!< pages distributed over nodes
+                             LOCAL        //!< node of the allocating thread
+                           };
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup utility_classes
+    //! \brief allocate memory with a NUMA placement policy
+    //!
+    //! The memory is not touched by this function. With the FIRST_TOUCH
+    //! policy a page is placed on the node of the thread accessing it
+    //! first. INTERLEAVE distributes the pages round robin over all nodes
+    //! and LOCAL places them on the node of the calling thread. Policies
+    //! are only applied to allocations of at least huge_page_size bytes
+    //! on Linux. Everywhere else ordinary cache line aligned memory is
+    //! used.
+    //!
+    //! \throws std::bad_alloc if the memory cannot be allocated
+    //! \param bytes number of bytes to allocate
+    //! \param policy placement policy
+    //! \return pointer to the memory
+    //!
+    PNICORE_EXPORT void *numa_allocate(size_t bytes,numa_policy policy);
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup utility_classes
+    //! \brief free memory allocated with numa_allocate
+    //!
+    //! \param ptr pointer returned by numa_allocate
+    //! \param bytes number of bytes passed to numa_allocate
+    //!
+    PNICORE_EXPORT void numa_deallocate(void *ptr,size_t bytes);
+
+    //=========================================================================
+    //!
+    //! \ingroup utility_classes
+    //! \brief NUMA aware allocator
+    //!
+    //! An STL allocator placing the memory according to a NUMA policy.
+    //! Elements constructed without arguments are default initialized
+    //! so that the memory of trivial types is not touched before it is
+    //! initialized by the threads which later work on it.
+    /*!
+    \code
+    std::vector<float64,numa_allocator<float64>> data;
+    data.resize(1ul<<30);
+    \endcode
+    */
+    //!
+    //! \tparam T element type
+    //! \tparam POLICY placement policy
+    //!
+    template<
+             typename    T,
+             numa_policy POLICY = numa_policy::FIRST_TOUCH
+            >
+    class numa_allocator
+    {
+        public:
+            //! element type
+            typedef T value_type;
+            //! pointer type
+            typedef T *pointer;
+            //! const pointer type
+            typedef const T *const_pointer;
+            //! reference type
+            typedef T &reference;
+            //! const reference type
+            typedef const T &const_reference;
+            //! size type
+            typedef size_t size_type;
+            //! difference type
+            typedef std::ptrdiff_t difference_type;
+
+            //! rebind the allocator to another type
+            template<typename U> struct rebind
+            {
+                //! allocator type for U
+                typedef numa_allocator<U,POLICY> other;
+            };
+
+            //-----------------------------------------------------------------
+            //! default constructor
+            numa_allocator() noexcept {}
+
+            //-----------------------------------------------------------------
+            //! conversion constructor
+            template<typename U>
+            numa_allocator(const numa_allocator<U,POLICY> &) noexcept {}
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief allocate memory
+            //!
+            //! \throws std::bad_alloc if the memory cannot be allocated
+            //! \param n number of elements
+            //! \return pointer to the memory
+            //!
+            T *allocate(size_t n)
+            {
+                if(n>std::numeric_limits<size_t>::max()/sizeof(T))
+                    throw std::bad_alloc();
+
+                return static_cast<T*>(numa_allocate(n*sizeof(T),POLICY));
+            }
+
+            //-----------------------------------------------------------------
+            //! free memory
+            void deallocate(T *ptr,size_t n) noexcept
+            {
+                numa_deallocate(ptr,n*sizeof(T));
+            }
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief default initialize an element
+            //!
+            //! Elements of trivial types are left uninitialized.
+            //!
+            template<typename U> void construct(U *ptr)
+            {
+                ::new(static_cast<void*>(ptr)) U;
+            }
+
+            //-----------------------------------------------------------------
+            //! construct an element
+            template<
+                     typename    U,
+                     typename... ARGS
+                    >
+            void construct(U *ptr,ARGS&&... args)
+            {
+                ::new(static_cast<void*>(ptr)) U(std::forward<ARGS>(args)...);
+            }
+    };
+
+    //! \cond NO_API_DOC
+    template<typename T,typename U,numa_policy P>
+    bool operator==(const numa_allocator<T,P> &,const numa_allocator<U,P> &)
+    {
+        return true;
+    }
+
+    template<typename T,typename U,numa_policy P>
+    bool operator!=(const numa_allocator<T,P> &,const numa_allocator<U,P> &)
+    {
+        return false;
+    }
+    //! \endcond
+
+//end of namespace
+}
+}
@@ -0,0 +1,200 @@
+//
+// (c) Copyright 2026 DESY, Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+// This file is part of libpnicore.
+//
+// libpnicore is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpnicore is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpnicore.  If not, see <http://www.gnu.org/licenses/>.
+//
+// ============================================================================
+//
+// Created on: Oct 16, 2026
+//     Author: Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+
+#include <cstdlib>
+#include <pni/core/utilities/thread_pool.hpp>
+
+namespace pni{
+namespace core{
+
+    namespace {
+        //! true for threads currently processing a chunk
+        thread_local bool in_pool = false;
+    }
+
+    //-------------------------------------------------------------------------
+    thread_pool::thread_pool(size_t n):
+        _workers(),
+        _mutex(),
+        _run_mutex(),
+        _start(),
+        _done(),
+        _function(nullptr),
+        _chunks(0),
+        _generation(0),
+        _pending(0),
+        _stop(false),
+        _error()
+    {
+        start(n);
+    }
+
+    //-------------------------------------------------------------------------
+    thread_pool::~thread_pool()
+    {
+        stop();
+    }
+
+    //-------------------------------------------------------------------------
+    void thread_pool::start(size_t n)
+    {
+        if(n==0) n = 1;
+
+        _stop = false;
+        for(size_t w=1;w<n;++w)
+            _workers.push_back(std::thread(&thread_pool::worker_loop,this,w,
+                                           _generation));
+    }
+
+    //-------------------------------------------------------------------------
+    void thread_pool::stop()
+    {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _stop = true;
+        }
+        _start.notify_all();
+
+        for(auto &w: _workers) w.join();
+        _workers.clear();
+    }
+
+    //-------------------------------------------------------------------------
+    size_t thread_pool::size() const
+    {
+        return _workers.size()+1;
+    }
+
+    //-------------------------------------------------------------------------
+    void thread_pool::resize(size_t n)
+    {
+        std::lock_guard<std::mutex> lock(_run_mutex);
+        stop();
+        start(n);
+    }
+
+    //-------------------------------------------------------------------------
+    void thread_pool::process(size_t worker,const chunk_function &f,
+                              size_t chunks)
+    {
+        in_pool = true;
+        try
+        {
+            for(size_t c=worker;c<chunks;c+=size()) f(c);
+        }
+        catch(...)
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            if(!_error) _error = std::current_exception();
+        }
+        in_pool = false;
+    }
+
+    //-------------------------------------------------------------------------
+    void thread_pool::worker_loop(size_t worker,size_t generation)
+    {
+        while(true)
+        {
+            const chunk_function *f = nullptr;
+            size_t chunks = 0;
+            {
+                std::unique_lock<std::mutex> lock(_mutex);
+                _start.wait(lock,[this,generation]()
+                        { return _stop || _generation!=generation; });
+                if(_stop) return;
+
+                generation = _generation;
+                f = _function;
+                chunks = _chunks;
+            }
+
+            process(worker,*f,chunks);
+
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                if(--_pending==0) _done.notify_one();
+            }
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    void thread_pool::run(size_t chunks,const chunk_function &f)
+    {
+        //serial execution for nested calls, single chunks, or if there 
+        //are no background workers
+        if(in_pool || chunks<2 || _workers.empty())
+        {
+            for(size_t c=0;c<chunks;++c) f(c);
+            return;
+        }
+
+        std::lock_guard<std::mutex> run_lock(_run_mutex);
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _function = &f;
+            _chunks   = chunks;
+            _pending  = _workers.size();
+            _error    = nullptr;
+            ++_generation;
+        }
+        _start.notify_all();
+
+        process(0,f,chunks);
+
+        std::exception_ptr error;
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            _done.wait(lock,[this](){ return _pending==0; });
+            _function = nullptr;
+            error = _error;
+            _error = nullptr;
+        }
+
+        if(error) std::rethrow_exception(error);
+    }
+
+    //-------------------------------------------------------------------------
+    size_t thread_pool::default_size()
+    {
+        const char *env = std::getenv("PNICORE_NUM_THREADS");
+        if(env)
+        {
+            long n = std::strtol(env,nullptr,10);
+            if(n>0) return size_t(n);
+        }
+
+        size_t n = std::thread::hardware_concurrency();
+        return n ? n : 1;
+    }
+
+    //-------------------------------------------------------------------------
+    thread_pool &thread_pool::instance()
+    {
+        static thread_pool pool(default_size());
+        return pool;
+    }
+
+//end of namespace
+}
+}
@@ -0,0 +1,243 @@
+//
+// (c) Copyright 2026 DESY, Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+// This file is part of libpnicore.
+//
+// libpnicore is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpnicore is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpnicore.  If not, see <http://www.gnu.org/licenses/>.
+//
+// ============================================================================
+//
+// Created on: Oct 16, 2026
+//     Author: Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <exception>
+#include <vector>
+#include <algorithm>
+
+#include <pni/core/windows.hpp>
+
+namespace pni{
+namespace core{
+
+    //!
+    //! \ingroup utility_classes
+    //! \brief simple thread pool
+    //!
+    //! A fixed size pool of worker threads used by the parallel algorithms 
+    //! of the library. Work is submitted as a number of chunks which are 
+    //! statically distributed over the workers: chunk c is always processed 
+    //! by worker c%size(). Worker 0 is the calling thread. This 
+    //! deterministic assignment ensures that two parallel loops with the 
+    //! same partitioning touch the same memory from the same thread 
+    //! (which matters on NUMA systems where pages are placed on the node 
+    //! which touches them first).
+    //!
+    //! A call to run() blocks until all chunks have been processed. If a 
+    //! chunk throws an exception the worker skips its remaining chunks and 
+    //! the first exception is rethrown by run() after all workers have 
+    //! finished. Calls to run() from within a chunk 
+    //! are executed serially by the calling thread.
+    //!
+    /*!
+    \code
+    auto &pool = thread_pool::instance();
+    std::vector<float64> data(1000000);
+
+    pool.run(pool.size(),[&data,&pool](size_t c)
+    {
+        for(size_t i=c;i<data.size();i+=pool.size()) data[i] = 1.;
+    });
+    \endcode
+    !*/
+    //!
+    class PNICORE_EXPORT thread_pool
+    {
+        public:
+            //! chunk function type
+            typedef std::function<void(size_t)> chunk_function;
+        private:
+            //! background worker threads
+            std::vector<std::thread> _workers;
+            //! protects the job state
+            std::mutex _mutex;
+            //! serializes concurrent calls to run()
+            std::mutex _run_mutex;
+            //! signals a new job to the workers
+            std::condition_variable _start;
+            //! signals the end of a job to the caller
+            std::condition_variable _done;
+            //! the function of the current job
+            const chunk_function *_function;
+            //! number of chunks of the current job
+            size_t _chunks;
+            //! job counter - increased for every new job
+            size_t _generation;
+            //! number of workers still busy with the current job
+            size_t _pending;
+            //! true if the workers should terminate
+            bool _stop;
+            //! first exception thrown by a chunk
+            std::exception_ptr _error;
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief start the background workers
+            //!
+            //! \param n total number of workers (including the caller)
+            //!
+            void start(size_t n);
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief stop the background workers
+            //!
+            void stop();
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief process the chunks of a worker
+            //!
+            //! \param worker the worker index
+            //! \param f function to call for each chunk
+            //! \param chunks total number of chunks
+            //!
+            void process(size_t worker,const chunk_function &f,size_t chunks);
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief main loop of a background worker
+            //!
+            //! \param worker the worker index
+            //! \param generation the job counter at startup
+            //!
+            void worker_loop(size_t worker,size_t generation);
+        public:
+            //================constructors and destructor=======================
+            //!
+            //! \brief constructor
+            //!
+            //! \param n number of workers (including the calling thread)
+            //!
+            explicit thread_pool(size_t n);
+
+            //-----------------------------------------------------------------
+            //! copy construction is not allowed
+            thread_pool(const thread_pool &) = delete;
+
+            //-----------------------------------------------------------------
+            //! copy assignment is not allowed
+            thread_pool &operator=(const thread_pool &) = delete;
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief destructor
+            //!
+            //! Stops and joins all background workers.
+            //!
+            ~thread_pool();
+
+            //=================public member functions=========================
+            //!
+            //! \brief number of workers
+            //!
+            //! \return number of workers including the calling thread
+            //!
+            size_t size() const;
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief change the number of workers
+            //!
+            //! Must not be called while run() is executing. A value of 0 is 
+            //! treated as 1.
+            //!
+            //! \param n new number of workers (including the calling thread)
+            //!
+            void resize(size_t n);
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief run a job
+            //!
+            //! Calls f(c) for all c in [0,chunks) and returns when all 
+            //! chunks have been processed. 
+            //!
+            //! \throws any exception thrown by f
+            //! \param chunks number of chunks
+            //! \param f function to call for each chunk
+            //!
+            void run(size_t chunks,const chunk_function &f);
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief default number of workers
+            //!
+            //! The value of the PNICORE_NUM_THREADS environment variable if 
+            //! set, otherwise the number of hardware threads.
+            //!
+            //! \return default pool size
+            //!
+            static size_t default_size();
+
+            //-----------------------------------------------------------------
+            //!
+            //! \brief library thread pool
+            //!
+            //! Returns a reference to the thread pool shared by all parallel
+            //! algorithms of the library. The pool is created with 
+            //! default_size() workers on first use.
+            //!
+            //! \return reference to the library thread pool
+            //!
+            static thread_pool &instance();
+    };
+
+    //-------------------------------------------------------------------------
+    //!
+    //! \ingroup utility_classes
+    //! \brief parallel loop over a range
+    //!
+    //! Splits the range [0,n) into chunks of at most chunk_size elements 
+    //! and calls f(begin,end) for every chunk on the library thread pool. 
+    //! The assignment of chunks to threads depends only on n and 
+    //! chunk_size.
+    //!
+    //! \tparam FUNC function type with signature void(size_t,size_t)
+    //! \param n number of elements
+    //! \param chunk_size maximum number of elements per chunk
+    //! \param f function to call for each chunk
+    //!
+    template<typename FUNC>
+    void parallel_for(size_t n,size_t chunk_size,FUNC f)
+    {
+        if(chunk_size==0) chunk_size = 1;
+        size_t chunks = (n+chunk_size-1)/chunk_size;
+
+        thread_pool::instance().run(chunks,[n,chunk_size,&f](size_t c)
+        {
+            size_t begin = c*chunk_size;
+            f(begin,std::min(n,begin+chunk_size));
+        });
+    }
+
+//end of namespace
+}
+}
@@ -0,0 +1,181 @@
+//
+// (c) Copyright 2026 DESY, Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+// This file is part of libpnicore.
+//
+// libpnicore is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpnicore is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpnicore.  If not, see <http://www.gnu.org/licenses/>.
+//
+// ===========================================================================
+//
+//  Created on: Oct 16, 2026
+//      Author: Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+#ifdef __GNUG__
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+#endif
+#include <boost/test/unit_test.hpp>
+#ifdef __GNUG__
+#pragma GCC diagnostic pop
+#endif
+#include <boost/mpl/list.hpp>
+#include <pni/core/types.hpp>
+#include <pni/core/arrays.hpp>
+#include <cstdint>
+#include <numeric>
+
+using namespace pni::core;
+
+typedef boost::mpl::list<uint8,int16,float32,float64,complex64> element_types;
+
+template<typename T> bool is_aligned(const T *ptr,size_t alignment)
+{
+    return reinterpret_cast<uintptr_t>(ptr)%alignment == 0;
+}
+
+BOOST_AUTO_TEST_SUITE(aligned_array_test)
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE_TEMPLATE(test_allocator,T,element_types)
+    {
+        for(size_t n: {1,3,17,1000})
+        {
+            std::vector<T,aligned_allocator<T>> a(n);
+            BOOST_CHECK(is_aligned(a.data(),cache_line_size));
+
+            std::vector<T,aligned_allocator<T,4096>> b(n);
+            BOOST_CHECK(is_aligned(b.data(),4096));
+        }
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE_TEMPLATE(test_aligned_array,T,element_types)
+    {
+        typedef aligned_array<T> array_type;
+        typedef fixed_dim_aligned_array<T,2> image_type;
+
+        auto a = array_type::create(shape_t{3,5,7},T(1));
+        BOOST_CHECK(is_aligned(a.data(),cache_line_size));
+        BOOST_CHECK_EQUAL(a.size(),105);
+        for(auto v: a) BOOST_CHECK_EQUAL(v,T(1));
+
+        auto b = image_type::create(shape_t{4,3},
+                                    std::vector<T>{1,2,3,4,5,6,7,8,9,10,11,12});
+        BOOST_CHECK(is_aligned(b.data(),cache_line_size));
+        BOOST_CHECK_EQUAL(b(3,2),T(12));
+
+        array_type c(a);
+        BOOST_CHECK(is_aligned(c.data(),cache_line_size));
+        BOOST_CHECK(std::equal(a.begin(),a.end(),c.begin()));
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_huge_page_array)
+    {
+        typedef huge_page_array<uint16> stack_type;
+        typedef huge_page_array<uint16,huge_page_policy::EXPLICIT> pool_type;
+        typedef fixed_dim_huge_page_array<float32,3> fixed_type;
+
+        //small arrays use ordinary aligned memory
+        auto small = stack_type::create(shape_t{10,10});
+        BOOST_CHECK(is_aligned(small.data(),cache_line_size));
+
+        //large arrays are aligned to a huge page
+        auto stack = stack_type::create(shape_t{4,1024,1024},uint16(7));
+        BOOST_CHECK(is_aligned(stack.data(),cache_line_size));
+#ifdef __linux__
+        BOOST_CHECK(is_aligned(stack.data(),huge_page_size));
+#endif
+        BOOST_CHECK(std::all_of(stack.begin(),stack.end(),
+                                [](uint16 v){ return v==7; }));
+
+        //explicit huge pages fall back to transparent ones if the pool is
+        //exhausted
+        auto pool = pool_type::create(shape_t{3,1024,1024});
+        std::iota(pool.begin(),pool.end(),uint16(0));
+        BOOST_CHECK_EQUAL(pool[70000],uint16(70000));
+
+        auto frames = fixed_type::create(shape_t{2,1024,512},1.5f);
+        BOOST_CHECK(is_aligned(frames.data(),cache_line_size));
+        BOOST_CHECK_EQUAL(frames(1,1023,511),1.5f);
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE_TEMPLATE(test_value_init,T,element_types)
+    {
+        //elements constructed without arguments are value initialized
+        aligned_allocator<T> a;
+        T *ptr = a.allocate(1);
+        *ptr = T(1);
+        a.construct(ptr);
+        BOOST_CHECK_EQUAL(*ptr,T());
+        a.deallocate(ptr,1);
+
+        huge_page_allocator<T> h;
+        ptr = h.allocate(1);
+        *ptr = T(1);
+        h.construct(ptr);
+        BOOST_CHECK_EQUAL(*ptr,T());
+        h.deallocate(ptr,1);
+
+        BOOST_CHECK(!aligned_allocator<T>(no_init).initializes());
+        BOOST_CHECK(!huge_page_allocator<T>(no_init).initializes());
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_no_init)
+    {
+        auto a = aligned_array<float32>::create(shape_t{100,100},no_init);
+        BOOST_CHECK(is_aligned(a.data(),cache_line_size));
+        BOOST_CHECK_EQUAL(a.size(),10000);
+        //only the creation skips the initialization
+        BOOST_CHECK(a.storage().get_allocator().initializes());
+
+        //memory returned by the kernel is zero and remains untouched
+        auto stack = huge_page_array<uint16>::create(shape_t{4,1024,1024},
+                                                      no_init);
+        BOOST_CHECK_EQUAL(stack.size(),4*1024*1024);
+        std::iota(stack.begin(),stack.end(),uint16(0));
+        BOOST_CHECK_EQUAL(stack[1000],uint16(1000));
+        BOOST_CHECK(stack.storage().get_allocator().initializes());
+
+        auto b = dynamic_array<int32>::create(shape_t{3,4},no_init);
+        BOOST_CHECK((b.shape<shape_t>() == shape_t{3,4}));
+
+        auto c = fixed_dim_array<uint8,2>::create(shape_t{5,5},no_init);
+        BOOST_CHECK_EQUAL(c.size(),25);
+
+        auto d = static_array<float64,2,3>::create(shape_t{2,3},no_init);
+        BOOST_CHECK_EQUAL(d.size(),6);
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_arithmetic)
+    {
+        auto a = aligned_array<float64>::create(shape_t{100,100});
+        auto b = dynamic_array<float64>::create(shape_t{100,100});
+        std::iota(a.begin(),a.end(),0.);
+        std::fill(b.begin(),b.end(),2.);
+
+        auto c = huge_page_array<float64>::create(shape_t{100,100});
+        c = a*b+1.;
+        for(size_t i=0;i<c.size();++i)
+            BOOST_CHECK_EQUAL(c[i],2.*float64(i)+1.);
+
+        a += b;
+        for(size_t i=0;i<a.size();++i)
+            BOOST_CHECK_EQUAL(a[i],float64(i)+2.);
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,196 @@
+//
+// (c) Copyright 2026 DESY, Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+// This file is part of libpnicore.
+//
+// libpnicore is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpnicore is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpnicore.  If not, see <http://www.gnu.org/licenses/>.
+//
+// ===========================================================================
+//
+//  Created on: Oct 16, 2026
+//      Author: Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+#ifdef __GNUG__
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+#endif
+#include <boost/test/unit_test.hpp>
+#ifdef __GNUG__
+#pragma GCC diagnostic pop
+#endif
+#include <pni/core/types.hpp>
+#include <pni/core/arrays.hpp>
+#include <vector>
+#include <numeric>
+
+using namespace pni::core;
+
+struct array_permutation_fixture
+{
+    typedef dynamic_array<uint32> array_type;
+    typedef mdarray<std::vector<uint32>,dynamic_fmap> farray_type;
+    array_type stack;
+
+    //stack(f,y,x) has the value x+10*y+100*f
+    array_permutation_fixture():
+        stack(array_type::create(shape_t{3,4,5}))
+    {
+        for(size_t f=0;f<3;++f)
+            for(size_t y=0;y<4;++y)
+                for(size_t x=0;x<5;++x)
+                    stack(f,y,x) = x+10*y+100*f;
+    }
+
+    template<typename ATYPE> 
+    static void check_series(const ATYPE &series)
+    {
+        for(size_t y=0;y<4;++y)
+            for(size_t x=0;x<5;++x)
+                for(size_t f=0;f<3;++f)
+                    BOOST_CHECK_EQUAL(series(y,x,f),x+10*y+100*f);
+    }
+};
+
+BOOST_FIXTURE_TEST_SUITE(array_permutation_test,array_permutation_fixture)
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_view)
+    {
+        auto series = permute(stack,shape_t{1,2,0});
+        BOOST_CHECK(series.shape<shape_t>()==shape_t({4,5,3}));
+        BOOST_CHECK_EQUAL(series.size(),stack.size());
+        BOOST_CHECK(!series.is_contiguous());
+        check_series(series);
+
+        //linear access follows the C order of the view
+        BOOST_CHECK_EQUAL(series[0],0);
+        BOOST_CHECK_EQUAL(series[1],100);
+        BOOST_CHECK_EQUAL(series[3],1);
+        BOOST_CHECK_EQUAL(*(series.begin()+4),101);
+
+        //the view writes to the array
+        series(1,2,2) = 7;
+        BOOST_CHECK_EQUAL(stack(2,1,2),7);
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_view_identity)
+    {
+        auto view = permute(stack,shape_t{0,1,2});
+        BOOST_CHECK(view.is_contiguous());
+        BOOST_CHECK(std::equal(view.begin(),view.end(),stack.begin()));
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_view_const)
+    {
+        const array_type &c = stack;
+        const auto view = permute(c,shape_t{2,1,0});
+        BOOST_CHECK(view.shape<shape_t>()==shape_t({5,4,3}));
+        BOOST_CHECK_EQUAL(view(4,3,2),234);
+
+        //materialize the view
+        array_type copy(view);
+        BOOST_CHECK_EQUAL(copy(1,2,1),121);
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_view_unit_dimension)
+    {
+        auto a = array_type::create(shape_t{1,2,3});
+        std::iota(a.begin(),a.end(),0);
+
+        //the unit dimension is not part of the view
+        auto view = permute(a,shape_t{2,0,1});
+        BOOST_CHECK(view.shape<shape_t>()==shape_t({3,2}));
+        BOOST_CHECK_EQUAL(view(2,1),5);
+        BOOST_CHECK_EQUAL(view(1,0),1);
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_errors)
+    {
+        BOOST_CHECK_THROW(permute(stack,shape_t{0,1}),shape_mismatch_error);
+        BOOST_CHECK_THROW(permute(stack,shape_t{0,1,1}),index_error);
+        BOOST_CHECK_THROW(permute(stack,shape_t{0,1,3}),index_error);
+        BOOST_CHECK_THROW(permute_copy(stack,shape_t{2,1}),
+                          shape_mismatch_error);
+
+        auto dest = array_type::create(shape_t{3,4,5});
+        BOOST_CHECK_THROW(permute_copy(stack,shape_t{1,2,0},dest),
+                          shape_mismatch_error);
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_copy)
+    {
+        auto series = permute_copy(stack,shape_t{1,2,0});
+        BOOST_CHECK(series.shape<shape_t>()==shape_t({4,5,3}));
+        check_series(series);
+
+        auto dest = array_type::create(shape_t{4,5,3});
+        permute_copy(stack,shape_t{1,2,0},dest);
+        BOOST_CHECK(std::equal(dest.begin(),dest.end(),series.begin()));
+
+        //no permutation at all
+        auto copy = permute_copy(stack,shape_t{0,1,2});
+        BOOST_CHECK(std::equal(copy.begin(),copy.end(),stack.begin()));
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_copy_orders)
+    {
+        //the destination may use a different storage order 
+        auto dest = farray_type::create(shape_t{4,5,3});
+        permute_copy(stack,shape_t{1,2,0},dest);
+        check_series(dest);
+
+        //Fortran source
+        auto fstack = farray_type::create(shape_t{3,4,5});
+        std::iota(fstack.begin(),fstack.end(),0);
+        auto fseries = permute_copy(fstack,shape_t{1,2,0});
+        for(size_t y=0;y<4;++y)
+            for(size_t x=0;x<5;++x)
+                for(size_t f=0;f<3;++f)
+                    BOOST_CHECK_EQUAL(fseries(y,x,f),fstack(f,y,x));
+
+        //the lazy view linearizes in Fortran order as well
+        auto fview = permute(fstack,shape_t{1,2,0});
+        BOOST_CHECK(std::equal(fview.begin(),fview.end(),fseries.begin()));
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_copy_large)
+    {
+        //large enough for tiling over several blocks and threads
+        typedef dynamic_array<float64> large_type;
+        auto a = large_type::create(shape_t{7,130,150});
+        std::iota(a.begin(),a.end(),0.);
+
+        shape_t axes{2,0,1};
+        auto b = permute_copy(a,axes);
+        auto view = permute(a,axes);
+        BOOST_CHECK(b.shape<shape_t>()==view.shape<shape_t>());
+        BOOST_CHECK(std::equal(b.begin(),b.end(),view.begin()));
+
+        //2-D transpose
+        auto m = large_type::create(shape_t{333,517});
+        std::iota(m.begin(),m.end(),0.);
+        auto t = permute_copy(m,shape_t{1,0});
+        for(size_t i=0;i<333;i+=7)
+            for(size_t j=0;j<517;j+=11)
+                BOOST_CHECK_EQUAL(t(j,i),m(i,j));
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,163 @@
+//
+// (c) Copyright 2026 DESY, Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+// This file is part of libpnicore.
+//
+// libpnicore is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpnicore is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpnicore.  If not, see <http://www.gnu.org/licenses/>.
+//
+// ===========================================================================
+//
+//  Created on: Oct 16, 2026
+//      Author: Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+#ifdef __GNUG__
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+#endif
+#include <boost/test/unit_test.hpp>
+#ifdef __GNUG__
+#pragma GCC diagnostic pop
+#endif
+#include <pni/core/types.hpp>
+#include <pni/core/arrays.hpp>
+#include <vector>
+#include <numeric>
+
+using namespace pni::core;
+
+struct array_reshape_fixture
+{
+    typedef dynamic_array<float32> array_type;
+    array_type buffer;
+
+    array_reshape_fixture():
+        buffer(array_type::create(shape_t{24}))
+    {
+        std::iota(buffer.begin(),buffer.end(),0.f);
+    }
+};
+
+BOOST_FIXTURE_TEST_SUITE(array_reshape_test,array_reshape_fixture)
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_member)
+    {
+        const float32 *data = buffer.data();
+        buffer.reshape(shape_t{2,3,4});
+        BOOST_CHECK_EQUAL(buffer.rank(),3);
+        BOOST_CHECK(buffer.shape<shape_t>()==shape_t({2,3,4}));
+        BOOST_CHECK_EQUAL(buffer.data(),data);
+        BOOST_CHECK_EQUAL(buffer(1,2,3),23.f);
+
+        BOOST_CHECK_THROW(buffer.reshape(shape_t{5,5}),size_mismatch_error);
+        BOOST_CHECK(buffer.shape<shape_t>()==shape_t({2,3,4}));
+
+        auto image = fixed_dim_array<float32,2>::create(shape_t{4,6});
+        image.reshape(shape_t{6,4});
+        BOOST_CHECK(image.shape<shape_t>()==shape_t({6,4}));
+        BOOST_CHECK_THROW(image.reshape(shape_t{24}),shape_mismatch_error);
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_shared)
+    {
+        auto stack = reshape(buffer,shape_t{2,3,4});
+        BOOST_CHECK(stack.shape<shape_t>()==shape_t({2,3,4}));
+        BOOST_CHECK_EQUAL(stack.data(),buffer.data());
+        BOOST_CHECK_EQUAL(stack(1,0,2),14.f);
+        BOOST_CHECK(buffer.shape<shape_t>()==shape_t({24}));
+
+        stack(0,1,1) = -1.f;
+        BOOST_CHECK_EQUAL(buffer[5],-1.f);
+
+        BOOST_CHECK_THROW(reshape(buffer,shape_t{5,5}),size_mismatch_error);
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_move)
+    {
+        const float32 *data = buffer.data();
+        auto stack = reshape(std::move(buffer),shape_t{4,6});
+        BOOST_CHECK((std::is_same<decltype(stack),array_type>::value));
+        BOOST_CHECK(stack.shape<shape_t>()==shape_t({4,6}));
+        BOOST_CHECK_EQUAL(stack.data(),data);
+        BOOST_CHECK_EQUAL(stack(3,5),23.f);
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_view)
+    {
+        auto stack = reshape(buffer,shape_t{2,3,4});
+
+        //a contiguous view
+        auto frame = reshape(stack(1,slice(0,3),slice(0,4)),shape_t{4,3});
+        BOOST_CHECK(frame.shape<shape_t>()==shape_t({4,3}));
+        BOOST_CHECK_EQUAL(frame.data(),buffer.data()+12);
+        BOOST_CHECK_EQUAL(frame(3,2),23.f);
+
+        //a strided view cannot be reshaped
+        auto column = stack(0,slice(0,3),1);
+        BOOST_CHECK_THROW(reshape(column,shape_t{3,1}),shape_mismatch_error);
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_squeeze)
+    {
+        auto frame = reshape(buffer,shape_t{1,4,1,6});
+        auto image = squeeze(frame);
+        BOOST_CHECK(image.shape<shape_t>()==shape_t({4,6}));
+        BOOST_CHECK_EQUAL(image.data(),buffer.data());
+
+        auto moved = squeeze(array_type::create(shape_t{1,1,3}));
+        BOOST_CHECK(moved.shape<shape_t>()==shape_t({3}));
+
+        auto single = squeeze(array_type::create(shape_t{1,1}));
+        BOOST_CHECK(single.shape<shape_t>()==shape_t({1}));
+
+        auto row = squeeze(image(2,slice(0,6)));
+        BOOST_CHECK(row.shape<shape_t>()==shape_t({6}));
+        BOOST_CHECK_EQUAL(row[0],12.f);
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_expand_dims)
+    {
+        auto image = reshape(buffer,shape_t{4,6});
+        BOOST_CHECK(expand_dims(image,0).shape<shape_t>()==
+                    shape_t({1,4,6}));
+        BOOST_CHECK(expand_dims(image,1).shape<shape_t>()==
+                    shape_t({4,1,6}));
+        BOOST_CHECK(expand_dims(image,2).shape<shape_t>()==
+                    shape_t({4,6,1}));
+        BOOST_CHECK_THROW(expand_dims(image,3),index_error);
+
+        auto stack = expand_dims(std::move(buffer),0);
+        BOOST_CHECK(stack.shape<shape_t>()==shape_t({1,24}));
+        BOOST_CHECK_EQUAL(stack(0,23),23.f);
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_fortran)
+    {
+        typedef mdarray<std::vector<float32>,dynamic_fmap> farray_type;
+        auto a = farray_type::create(shape_t{24});
+        std::iota(a.begin(),a.end(),0.f);
+
+        //the shared array keeps the storage order
+        auto m = reshape(a,shape_t{4,6});
+        BOOST_CHECK_EQUAL(m(1,0),1.f);
+        BOOST_CHECK_EQUAL(m(0,1),4.f);
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,183 @@
+//
+// (c) Copyright 2013 DESY, Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+// This file is part of libpnicore.
+//
+// libpnicore is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpnicore is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpnicore.  If not, see <http://www.gnu.org/licenses/>.
+//
+// ===========================================================================
+//
+//  Created on: Oct 16, 2026
+//      Author: Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+#ifdef __GNUG__
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+#endif
+#include <boost/test/unit_test.hpp>
+#ifdef __GNUG__
+#pragma GCC diagnostic pop
+#endif
+#include <pni/core/arrays.hpp>
+#include "../data_generator.hpp"
+#include "array_types.hpp"
+#include <vector>
+#include <algorithm>
+#include <numeric>
+
+using namespace pni::core;
+
+template<typename AT> struct view_iterator_fixture
+{
+    typedef typename AT::value_type       value_type;
+    typedef random_generator<value_type>  generator_type;
+
+    generator_type generator;
+    AT a;
+
+    view_iterator_fixture():
+        generator(),
+        a(AT::create(shape_t{6,20,30}))
+    {
+        std::generate(a.begin(),a.end(),generator); 
+    }
+
+    //reference data of the (2:5,1:20:3,3:30:4) selection
+    std::vector<value_type> reference() const
+    {
+        std::vector<value_type> data;
+        for(size_t i=2;i<5;++i)
+            for(size_t j=1;j<20;j+=3)
+                for(size_t k=3;k<30;k+=4)
+                    data.push_back(a(i,j,k));
+        return data;
+    }
+};
+
+BOOST_AUTO_TEST_SUITE(array_view_iterator_test)
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE_TEMPLATE(test_forward,AT,all_dynamic_arrays)
+    {
+        view_iterator_fixture<AT> f;
+        auto view = f.a(slice(2,5),slice(1,20,3),slice(3,30,4));
+        auto ref = f.reference();
+        BOOST_CHECK_EQUAL(view.size(),ref.size());
+
+        BOOST_CHECK(std::equal(view.begin(),view.end(),ref.begin()));
+
+        const auto &cview = view;
+        BOOST_CHECK(std::equal(cview.begin(),cview.end(),ref.begin()));
+
+        size_t i = 0;
+        for(auto iter = view.begin();iter!=view.end();++iter,++i)
+            BOOST_CHECK_EQUAL(*iter,view[i]);
+        BOOST_CHECK_EQUAL(i,view.size());
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE_TEMPLATE(test_backward,AT,all_dynamic_arrays)
+    {
+        view_iterator_fixture<AT> f;
+        auto view = f.a(slice(2,5),slice(1,20,3),slice(3,30,4));
+        auto ref = f.reference();
+
+        auto iter = view.end();
+        auto riter = ref.rbegin();
+        while(iter!=view.begin())
+        {
+            --iter;
+            BOOST_CHECK_EQUAL(*iter,*riter++);
+        }
+        BOOST_CHECK(riter==ref.rend());
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE_TEMPLATE(test_random_access,AT,all_dynamic_arrays)
+    {
+        view_iterator_fixture<AT> f;
+        auto view = f.a(slice(2,5),slice(1,20,3),slice(3,30,4));
+        auto ref = f.reference();
+
+        auto begin = view.begin();
+        BOOST_CHECK_EQUAL(view.end()-begin,ssize_t(view.size()));
+
+        for(size_t i=0;i<ref.size();i+=5)
+        {
+            BOOST_CHECK_EQUAL(*(begin+i),ref[i]);
+            BOOST_CHECK_EQUAL(begin[i],ref[i]);
+
+            //continue sequentially after a jump
+            auto iter = begin+i;
+            ++iter;
+            if(iter!=view.end()) BOOST_CHECK_EQUAL(*iter,ref[i+1]);
+        }
+
+        auto iter = view.end()-1;
+        BOOST_CHECK_EQUAL(*iter,ref.back());
+        BOOST_CHECK_THROW(*view.end(),iterator_error);
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE_TEMPLATE(test_write,AT,all_dynamic_arrays)
+    {
+        typedef typename AT::value_type value_type;
+        view_iterator_fixture<AT> f;
+        auto view = f.a(slice(2,5),slice(1,20,3),slice(3,30,4));
+
+        std::vector<value_type> data(view.size());
+        std::generate(data.begin(),data.end(),f.generator);
+        std::copy(data.begin(),data.end(),view.begin());
+
+        auto ref = f.reference();
+        BOOST_CHECK(std::equal(data.begin(),data.end(),ref.begin()));
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_algorithms)
+    {
+        auto a = dynamic_array<int32>::create(shape_t{10,10});
+        std::iota(a.begin(),a.end(),0);
+
+        //the second column
+        auto view = a(slice(0,10),1);
+        BOOST_CHECK_EQUAL(std::accumulate(view.begin(),view.end(),0),
+                          10*1+10*9*10/2);
+
+        std::reverse(view.begin(),view.end());
+        for(size_t i=0;i<10;++i) BOOST_CHECK_EQUAL(a(i,1),int32(10*(9-i)+1));
+
+        std::sort(view.begin(),view.end());
+        for(size_t i=0;i<10;++i) BOOST_CHECK_EQUAL(a(i,1),int32(10*i+1));
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_contiguous)
+    {
+        auto a = fixed_dim_array<float64,3>::create(shape_t{4,5,6});
+        std::iota(a.begin(),a.end(),0.);
+
+        auto view = a(slice(1,3),slice(0,5),slice(0,6));
+        BOOST_CHECK(view.is_contiguous());
+
+        float64 value = 30.;
+        for(auto v: view) BOOST_CHECK_EQUAL(v,value++);
+
+        auto iter = view.end();
+        --iter;
+        BOOST_CHECK_EQUAL(*iter,89.);
+        BOOST_CHECK_EQUAL(*(view.begin()+7),37.);
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,159 @@
+//
+// (c) Copyright 2013 DESY, Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+// This file is part of libpnicore.
+//
+// libpnicore is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpnicore is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpnicore.  If not, see <http://www.gnu.org/licenses/>.
+//
+// ===========================================================================
+//
+//  Created on: Oct 16, 2026
+//      Author: Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+#ifdef __GNUG__
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+#endif
+#include <boost/test/unit_test.hpp>
+#ifdef __GNUG__
+#pragma GCC diagnostic pop
+#endif
+#include <pni/core/arrays.hpp>
+#include "../data_generator.hpp"
+#include "array_types.hpp"
+#include <vector>
+#include <algorithm>
+#include <numeric>
+
+using namespace pni::core;
+
+//collect the runs of a view
+template<typename VTYPE> 
+std::vector<std::pair<size_t,size_t>> get_runs(VTYPE &view,size_t origin)
+{
+    std::vector<std::pair<size_t,size_t>> runs;
+    for_each_contiguous_run(view,[&runs,origin](const float64 *ptr,size_t n)
+    {
+        runs.push_back({size_t(*ptr)-origin,n});
+    });
+    return runs;
+}
+
+struct array_view_runs_fixture
+{
+    typedef dynamic_array<float64> array_type;
+    array_type a;
+
+    array_view_runs_fixture():
+        a(array_type::create(shape_t{4,5,6}))
+    {
+        std::iota(a.begin(),a.end(),0.);
+    }
+};
+
+BOOST_FIXTURE_TEST_SUITE(array_view_runs_test,array_view_runs_fixture)
+
+    typedef std::vector<std::pair<size_t,size_t>> run_vector;
+    
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_contiguous)
+    {
+        auto view = a(slice(1,3),slice(0,5),slice(0,6));
+        auto runs = get_runs(view,0);
+        BOOST_CHECK(runs==run_vector({{30,60}}));
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_rows)
+    {
+        //a row range in a stack - full rows are merged within each frame
+        auto view = a(slice(0,4),slice(1,3),slice(0,6));
+        auto runs = get_runs(view,0);
+        BOOST_CHECK(runs==run_vector({{6,12},{36,12},{66,12},{96,12}}));
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_columns)
+    {
+        auto view = a(slice(1,3),slice(1,4),slice(2,5));
+        auto runs = get_runs(view,0);
+        BOOST_CHECK(runs==run_vector({{38,3},{44,3},{50,3},
+                                      {68,3},{74,3},{80,3}}));
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_strided)
+    {
+        //the innermost dimension has a stride - single element runs
+        auto view = a(1,slice(0,5,2),slice(0,6,3));
+        auto runs = get_runs(view,0);
+        BOOST_CHECK(runs==run_vector({{30,1},{33,1},{42,1},{45,1},
+                                      {54,1},{57,1}}));
+
+        //a single column
+        auto column = a(2,slice(0,5),4);
+        runs = get_runs(column,0);
+        BOOST_CHECK(runs==run_vector({{64,1},{70,1},{76,1},{82,1},{88,1}}));
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_outer_merge)
+    {
+        //outer dimensions with stride can be merged as well 
+        auto view = a(slice(0,4,2),slice(0,5),slice(0,6,2));
+        auto runs = get_runs(view,0);
+        BOOST_CHECK_EQUAL(runs.size(),view.size());
+
+        auto iter = view.begin();
+        for(auto r: runs) BOOST_CHECK_EQUAL(r.first,*iter++);
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_write)
+    {
+        auto view = a(slice(1,3),slice(1,4),slice(2,5));
+        for_each_contiguous_run(view,[](float64 *ptr,size_t n)
+        {
+            std::fill(ptr,ptr+n,-1.);
+        });
+
+        for(size_t i=0;i<4;++i)
+            for(size_t j=0;j<5;++j)
+                for(size_t k=0;k<6;++k)
+                {
+                    bool inside = i>=1 && i<3 && j>=1 && j<4 && k>=2 && k<5;
+                    if(inside) BOOST_CHECK_EQUAL(a(i,j,k),-1.);
+                    else BOOST_CHECK_EQUAL(a(i,j,k),float64(i*30+j*6+k));
+                }
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_const)
+    {
+        const auto view = a(slice(0,4),slice(1,3),slice(0,6));
+        float64 sum = 0;
+        for_each_contiguous_run(view,[&sum](const float64 *ptr,size_t n)
+        {
+            sum = std::accumulate(ptr,ptr+n,sum);
+        });
+        BOOST_CHECK_CLOSE(sum,std::accumulate(view.begin(),view.end(),0.),
+                          1.e-8);
+
+        const array_type &ca = a;
+        auto cview = ca(slice(0,4),slice(1,3),slice(0,6));
+        auto runs = get_runs(cview,0);
+        BOOST_CHECK_EQUAL(runs.size(),4);
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -306,6 +306,34 @@ BOOST_AUTO_TEST_SUITE(array_view_test)
                 BOOST_CHECK_EQUAL(view(i,j),*diter++);
     }
 
+    //========================================================================
+    BOOST_AUTO_TEST_CASE_TEMPLATE(test_strided_access,AT,all_array_types)
+    {
+        SETUP_VIEW_FIXTURE();
+
+        auto view = fixture.a(slice(1,40,3),slice(2,120,5));
+        check_view(view,shape_t{13,24});
+        BOOST_CHECK(!view.is_contiguous());
+
+        const auto &cview = view;
+        for(size_t i=0;i<13;++i)
+            for(size_t j=0;j<24;++j)
+            {
+                BOOST_CHECK_EQUAL(view(i,j),fixture.a(1+3*i,2+5*j));
+                BOOST_CHECK_EQUAL(cview(shape_t{i,j}),fixture.a(1+3*i,2+5*j));
+                BOOST_CHECK_EQUAL(cview[i*24+j],fixture.a(1+3*i,2+5*j));
+            }
+
+        //a view with a single element along the second dimension
+        auto column = fixture.a(slice(3,NX,7),10);
+        check_view(column,shape_t{14});
+        for(size_t i=0;i<column.size();++i)
+        {
+            column[i] = fixture.a(0,0);
+            BOOST_CHECK_EQUAL(fixture.a(3+7*i,10),fixture.a(0,0));
+        }
+    }
+
     //========================================================================
     BOOST_AUTO_TEST_CASE_TEMPLATE(test_comparison,AT,all_array_types)
     {
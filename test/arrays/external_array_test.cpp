@@ -0,0 +1,151 @@
+//
+// (c) Copyright 2026 DESY, Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+// This file is part of libpnicore.
+//
+// libpnicore is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpnicore is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpnicore.  If not, see <http://www.gnu.org/licenses/>.
+//
+// ===========================================================================
+//
+//  Created on: Oct 16, 2026
+//      Author: Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+#ifdef __GNUG__
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+#endif
+#include <boost/test/unit_test.hpp>
+#ifdef __GNUG__
+#pragma GCC diagnostic pop
+#endif
+#include <boost/mpl/list.hpp>
+#include <pni/core/types.hpp>
+#include <pni/core/arrays.hpp>
+#include <pni/core/type_erasures.hpp>
+#include <numeric>
+
+using namespace pni::core;
+
+typedef boost::mpl::list<uint8,int16,uint32,float32,float64> element_types;
+
+BOOST_AUTO_TEST_SUITE(external_array_test)
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE_TEMPLATE(test_wrap,T,element_types)
+    {
+        typedef external_array<T> array_type;
+        typedef array_factory<array_type> factory_type;
+        std::vector<T> buffer(24);
+        std::iota(buffer.begin(),buffer.end(),T(0));
+
+        auto a = factory_type::wrap(shape_t{2,3,4},buffer.data());
+        BOOST_CHECK_EQUAL(a.data(),buffer.data());
+        BOOST_CHECK(!a.storage().owns_memory());
+        BOOST_CHECK_EQUAL(a.size(),24);
+        BOOST_CHECK_EQUAL(a(1,2,3),T(23));
+        BOOST_CHECK_THROW(a.at(24),index_error);
+
+        //writes go to the external memory
+        a(0,1,2) = T(100);
+        BOOST_CHECK_EQUAL(buffer[6],T(100));
+
+        //copies refer to the same memory
+        array_type b(a);
+        BOOST_CHECK_EQUAL(b.data(),buffer.data());
+
+        typedef fixed_dim_external_array<T,2> image_type;
+        auto c = array_factory<image_type>::wrap(shape_t{6,4},buffer.data());
+        BOOST_CHECK_EQUAL(c(5,3),T(23));
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_owning)
+    {
+        typedef external_array<float64> array_type;
+
+        auto a = array_type::create(shape_t{3,4},2.);
+        BOOST_CHECK(a.storage().owns_memory());
+        for(auto v: a) BOOST_CHECK_EQUAL(v,2.);
+
+        array_type b(a);
+        BOOST_CHECK_EQUAL(b.data(),a.data());
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_views)
+    {
+        std::vector<int32> buffer(24);
+        std::iota(buffer.begin(),buffer.end(),0);
+        typedef array_factory<external_array<int32>> factory_type;
+        auto a = factory_type::wrap(shape_t{4,6},buffer.data());
+
+        auto row = a(2,slice(0,6));
+        for(size_t i=0;i<row.size();++i) BOOST_CHECK_EQUAL(row[i],12+i);
+
+        auto roi = a(slice(1,3),slice(2,5));
+        std::fill(roi.begin(),roi.end(),-1);
+        BOOST_CHECK_EQUAL(buffer[8],-1);
+        BOOST_CHECK_EQUAL(buffer[16],-1);
+        BOOST_CHECK_EQUAL(buffer[17],17);
+
+        //arrays created from views allocate their own memory
+        external_array<int32> copy(roi);
+        BOOST_CHECK(copy.storage().owns_memory());
+        BOOST_CHECK(std::equal(copy.begin(),copy.end(),roi.begin()));
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_arithmetic)
+    {
+        std::vector<float32> frame(100),dark(100),result(100);
+        std::iota(frame.begin(),frame.end(),10.f);
+        std::fill(dark.begin(),dark.end(),10.f);
+
+        typedef array_factory<external_array<float32>> factory_type;
+        auto f = factory_type::wrap(shape_t{10,10},frame.data());
+        auto d = factory_type::wrap(shape_t{10,10},dark.data());
+        auto r = factory_type::wrap(shape_t{10,10},result.data());
+
+        r = f-d;
+        for(size_t i=0;i<result.size();++i)
+            BOOST_CHECK_EQUAL(result[i],float32(i));
+
+        r *= 2.f;
+        for(size_t i=0;i<result.size();++i)
+            BOOST_CHECK_EQUAL(result[i],float32(2*i));
+
+        auto g = dynamic_array<float32>::create(shape_t{10,10},0.5f);
+        auto s = dynamic_array<float32>::create(shape_t{10,10});
+        s = r*g;
+        for(size_t i=0;i<s.size();++i) BOOST_CHECK_EQUAL(s[i],float32(i));
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_type_erasure)
+    {
+        std::vector<uint16> buffer(12);
+        std::iota(buffer.begin(),buffer.end(),uint16(0));
+
+        typedef array_factory<external_array<uint16>> factory_type;
+        array a(factory_type::wrap(shape_t{3,4},buffer.data()));
+        BOOST_CHECK(a.type_id() == type_id_t::UINT16);
+        BOOST_CHECK_EQUAL(a.size(),12);
+        BOOST_CHECK_EQUAL(a.data(),buffer.data());
+        BOOST_CHECK_EQUAL(a[5].as<uint16>(),5);
+
+        a[7] = uint16(1000);
+        BOOST_CHECK_EQUAL(buffer[7],1000);
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,225 @@
+//
+// (c) Copyright 2026 DESY, Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+// This file is part of libpnicore.
+//
+// libpnicore is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpnicore is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpnicore.  If not, see <http://www.gnu.org/licenses/>.
+//
+// ===========================================================================
+//
+//  Created on: Oct 16, 2026
+//      Author: Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+#ifdef __GNUG__
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+#endif
+#include <boost/test/unit_test.hpp>
+#ifdef __GNUG__
+#pragma GCC diagnostic pop
+#endif
+#include <pni/core/types.hpp>
+#include <pni/core/arrays.hpp>
+#include <vector>
+#include <numeric>
+
+using namespace pni::core;
+
+struct fmap_array_fixture
+{
+    typedef mdarray<std::vector<float64>,dynamic_fmap> array_type;
+    array_type a;
+
+    //3x4 matrix - the element (i,j) has the value i+3*j
+    fmap_array_fixture():
+        a(array_type::create(shape_t{3,4}))
+    {
+        std::iota(a.begin(),a.end(),0.);
+    }
+
+    template<typename VTYPE> 
+    static std::vector<float64> collect(const VTYPE &view)
+    {
+        return std::vector<float64>(view.begin(),view.end());
+    }
+};
+
+BOOST_FIXTURE_TEST_SUITE(fmap_array_test,fmap_array_fixture)
+
+    typedef std::vector<float64> value_vector;
+    typedef std::vector<std::pair<size_t,size_t>> run_vector;
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_access)
+    {
+        BOOST_CHECK_EQUAL(a(0,0),0.);
+        BOOST_CHECK_EQUAL(a(1,0),1.);
+        BOOST_CHECK_EQUAL(a(0,1),3.);
+        BOOST_CHECK_EQUAL(a(2,3),11.);
+        BOOST_CHECK_EQUAL(a(shape_t{1,2}),7.);
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_column_view)
+    {
+        auto column = a(slice(0,3),2);
+        BOOST_CHECK_EQUAL(column.size(),3);
+        BOOST_CHECK(collect(column)==value_vector({6.,7.,8.}));
+        BOOST_CHECK_EQUAL(column[1],7.);
+        BOOST_CHECK_EQUAL(column(2),8.);
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_row_view)
+    {
+        auto row = a(1,slice(0,4));
+        BOOST_CHECK_EQUAL(row.size(),4);
+        BOOST_CHECK(collect(row)==value_vector({1.,4.,7.,10.}));
+        BOOST_CHECK_EQUAL(row[3],10.);
+
+        std::fill(row.begin(),row.end(),-1.);
+        BOOST_CHECK_EQUAL(a(1,0),-1.);
+        BOOST_CHECK_EQUAL(a(1,3),-1.);
+        BOOST_CHECK_EQUAL(a(0,3),9.);
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_block_view)
+    {
+        //elements of a view are linearized in storage order as well
+        auto block = a(slice(0,2),slice(1,3));
+        BOOST_CHECK(collect(block)==value_vector({3.,4.,6.,7.}));
+        for(size_t i=0;i<block.size();++i)
+            BOOST_CHECK_EQUAL(block[i],value_vector({3.,4.,6.,7.})[i]);
+        BOOST_CHECK_EQUAL(block(1,0),4.);
+        BOOST_CHECK_EQUAL(block(0,1),6.);
+
+        auto iter = block.end();
+        BOOST_CHECK_EQUAL(*(--iter),7.);
+        BOOST_CHECK_EQUAL(*(iter-2),4.);
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_runs)
+    {
+        run_vector runs;
+        auto collect_runs = [&runs](const float64 *ptr,size_t n)
+        {
+            runs.push_back({size_t(*ptr),n});
+        };
+
+        auto block = a(slice(0,2),slice(1,3));
+        for_each_contiguous_run(block,collect_runs);
+        BOOST_CHECK(runs==run_vector({{3,2},{6,2}}));
+
+        //full columns are merged into a single run
+        runs.clear();
+        auto columns = a(slice(0,3),slice(1,3));
+        for_each_contiguous_run(columns,collect_runs);
+        BOOST_CHECK(runs==run_vector({{3,6}}));
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_copy_view)
+    {
+        array_type b(a(slice(0,3,2),slice(1,4)));
+        BOOST_CHECK_EQUAL(b.rank(),2);
+        BOOST_CHECK_EQUAL(b(1,0),5.);
+        BOOST_CHECK_EQUAL(b(0,2),9.);
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_expression)
+    {
+        auto b = array_type::create(shape_t{3,4});
+        for(size_t i=0;i<3;++i)
+            for(size_t j=0;j<4;++j) b(i,j) = 10.*i;
+
+        array_type r(a+b);
+        BOOST_CHECK_EQUAL(r(1,0),11.);
+        BOOST_CHECK_EQUAL(r(0,1),3.);
+        BOOST_CHECK_EQUAL(r(2,3),31.);
+
+        r = a*b;
+        BOOST_CHECK_EQUAL(r(2,1),100.);
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_broadcast)
+    {
+        auto z = array_type::create(shape_t{3,4});
+        std::fill(z.begin(),z.end(),0.);
+
+        //broadcast along the rows
+        auto row = array_type::create(shape_t{1,4});
+        for(size_t j=0;j<4;++j) row(0,j) = 10.*j;
+
+        array_type r(z+row);
+        for(size_t i=0;i<3;++i)
+            for(size_t j=0;j<4;++j) BOOST_CHECK_EQUAL(r(i,j),10.*j);
+
+        //broadcast along the columns
+        auto column = array_type::create(shape_t{3,1});
+        for(size_t i=0;i<3;++i) column(i,0) = 100.*i;
+
+        r = a-column;
+        for(size_t i=0;i<3;++i)
+            for(size_t j=0;j<4;++j) 
+                BOOST_CHECK_EQUAL(r(i,j),a(i,j)-100.*i);
+
+        //an operand of lower rank is aligned at the last index
+        auto vector = array_type::create(shape_t{4});
+        for(size_t j=0;j<4;++j) vector(j) = j+1.;
+
+        r = vector*a;
+        for(size_t i=0;i<3;++i)
+            for(size_t j=0;j<4;++j) 
+                BOOST_CHECK_EQUAL(r(i,j),(j+1.)*a(i,j));
+
+        //both operands are broadcast
+        r = column+row;
+        for(size_t i=0;i<3;++i)
+            for(size_t j=0;j<4;++j) 
+                BOOST_CHECK_EQUAL(r(i,j),100.*i+10.*j);
+
+        //element access of the expression
+        const auto e = row*column;
+        for(size_t i=0;i<3;++i)
+            for(size_t j=0;j<4;++j) 
+                BOOST_CHECK_EQUAL(e(i,j),1000.*i*j);
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_convert_order)
+    {
+        //arrays of different storage order cannot be combined directly - 
+        //permute_copy converts between them by index
+        static_assert(!has_same_storage_order<array_type,
+                                              dynamic_array<float64>>::value,
+                      "Storage orders must differ!");
+        static_assert(has_same_storage_order<array_type,float64>::value,
+                      "Scalars must be compatible with all arrays!");
+
+        auto c = dynamic_array<float64>::create(shape_t{3,4});
+        permute_copy(a,shape_t{0,1},c);
+        BOOST_CHECK_EQUAL(c(1,0),1.);
+        BOOST_CHECK_EQUAL(c(0,1),3.);
+        BOOST_CHECK_EQUAL(c[1],3.);
+
+        auto f = array_type::create(shape_t{3,4});
+        permute_copy(c,shape_t{0,1},f);
+        BOOST_CHECK(std::equal(f.begin(),f.end(),a.begin()));
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
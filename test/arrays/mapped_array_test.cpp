@@ -0,0 +1,178 @@
+//
+// (c) Copyright 2026 DESY, Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+// This file is part of libpnicore.
+//
+// libpnicore is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpnicore is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpnicore.  If not, see <http://www.gnu.org/licenses/>.
+//
+// ===========================================================================
+//
+//  Created on: Oct 16, 2026
+//      Author: Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+#ifdef __GNUG__
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+#endif
+#include <boost/test/unit_test.hpp>
+#ifdef __GNUG__
+#pragma GCC diagnostic pop
+#endif
+#include <pni/core/types.hpp>
+#include <pni/core/arrays.hpp>
+#include <fstream>
+#include <numeric>
+#include <cstdio>
+
+using namespace pni::core;
+
+typedef mapped_array<uint16> array_type;
+typedef array_factory<array_type> factory_type;
+
+struct mapped_array_fixture
+{
+    string filename;
+    std::vector<uint16> data;
+
+    mapped_array_fixture():
+        filename("mapped_array_test.raw"),
+        data(2*3*4)
+    {
+        std::iota(data.begin(),data.end(),uint16(0));
+        write(data);
+    }
+
+    ~mapped_array_fixture() { std::remove(filename.c_str()); }
+
+    void write(const std::vector<uint16> &d)
+    {
+        std::ofstream stream(filename,std::ios::binary|std::ios::trunc);
+        stream.write(reinterpret_cast<const char*>(d.data()),
+                     d.size()*sizeof(uint16));
+    }
+
+    std::vector<uint16> read()
+    {
+        std::vector<uint16> d(data.size());
+        std::ifstream stream(filename,std::ios::binary);
+        stream.read(reinterpret_cast<char*>(d.data()),d.size()*sizeof(uint16));
+        return d;
+    }
+};
+
+BOOST_FIXTURE_TEST_SUITE(mapped_array_test,mapped_array_fixture)
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_read_only)
+    {
+        auto a = factory_type::map(shape_t{2,3,4},filename);
+        BOOST_CHECK(a.storage().mode() == map_mode::READ_ONLY);
+        BOOST_CHECK_EQUAL(a.size(),24);
+        BOOST_CHECK_EQUAL(a.rank(),3);
+        BOOST_CHECK(std::equal(data.begin(),data.end(),a.begin()));
+        BOOST_CHECK_EQUAL(a(1,2,3),23);
+        BOOST_CHECK_EQUAL(a.at(5),5);
+        BOOST_CHECK_THROW(a.at(24),index_error);
+
+        a.storage().advise(map_advice::SEQUENTIAL);
+        a.storage().advise(map_advice::WILLNEED,12,12);
+        a.storage().advise(map_advice::RANDOM);
+
+        //map the entire file
+        mapped_storage<uint16> storage(filename);
+        BOOST_CHECK_EQUAL(storage.size(),24);
+        BOOST_CHECK(std::equal(data.rbegin(),data.rend(),storage.rbegin()));
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_offset)
+    {
+        auto a = factory_type::map(shape_t{2,4},filename,map_mode::READ_ONLY,
+                                   8*sizeof(uint16));
+        for(size_t i=0;i<a.size();++i) BOOST_CHECK_EQUAL(a[i],i+8);
+
+        auto b = fixed_dim_mapped_array<uint16,2>::create(shape_t{2,2});
+        BOOST_CHECK_EQUAL(b.size(),4);
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_copy_on_write)
+    {
+        auto a = factory_type::map(shape_t{2,3,4},filename,
+                                   map_mode::COPY_ON_WRITE);
+        std::fill(a.begin(),a.end(),uint16(100));
+        BOOST_CHECK_EQUAL(a(1,1,1),100);
+        a.storage().sync();
+
+        //the file remains unchanged
+        BOOST_CHECK(read() == data);
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_shared)
+    {
+        {
+            auto a = factory_type::map(shape_t{2,3,4},filename,
+                                       map_mode::SHARED);
+            a(0,0,0) = 1000;
+            a.storage().sync();
+            a(1,2,3) = 2000;
+        }
+
+        auto d = read();
+        BOOST_CHECK_EQUAL(d.front(),1000);
+        BOOST_CHECK_EQUAL(d.back(),2000);
+
+        //the file is extended if required
+        std::remove(filename.c_str());
+        auto b = factory_type::map(shape_t{2,3,4},filename,map_mode::SHARED);
+        std::copy(data.begin(),data.end(),b.begin());
+        b.storage().sync();
+        BOOST_CHECK(read() == data);
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_errors)
+    {
+        BOOST_CHECK_THROW(factory_type::map(shape_t{5,5},filename),
+                          size_mismatch_error);
+        BOOST_CHECK_THROW(factory_type::map(shape_t{2,3},"no_such_file.raw"),
+                          file_error);
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_arithmetic)
+    {
+        auto a = factory_type::map(shape_t{2,3,4},filename);
+        auto b = dynamic_array<uint16>::create(shape_t{3,4},uint16(1));
+
+        auto c = dynamic_array<uint16>::create(shape_t{2,3,4});
+        c = a+b;
+        for(size_t i=0;i<c.size();++i) BOOST_CHECK_EQUAL(c[i],i+1);
+
+        //copies share the mapping
+        array_type copy(a);
+        BOOST_CHECK_EQUAL(copy.data(),a.data());
+
+        //arrays created from expressions use anonymous memory
+        array_type d(a*b);
+        BOOST_CHECK(std::equal(d.begin(),d.end(),a.begin()));
+        d += a;
+        BOOST_CHECK_EQUAL(d[23],46);
+
+        auto view = a(1,slice(0,3),slice(1,3));
+        BOOST_CHECK_EQUAL(view(2,1),a(1,2,2));
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,137 @@
+//
+// (c) Copyright 2026 DESY, Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+// This file is part of libpnicore.
+//
+// libpnicore is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpnicore is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpnicore.  If not, see <http://www.gnu.org/licenses/>.
+//
+// ===========================================================================
+//
+//  Created on: Oct 16, 2026
+//      Author: Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+#ifdef __GNUG__
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+#endif
+#include <boost/test/unit_test.hpp>
+#ifdef __GNUG__
+#pragma GCC diagnostic pop
+#endif
+#include <pni/core/types.hpp>
+#include <pni/core/arrays.hpp>
+#include <vector>
+#include <numeric>
+
+using namespace pni::core;
+
+struct mdarray_conversion_fixture
+{
+    typedef dynamic_array<float32> dynamic_type;
+    typedef fixed_dim_array<float32,2> fixed_type;
+    typedef mdarray<std::vector<float32>,dynamic_cindex_map,
+                    parallel_inplace_arithmetics> parallel_type;
+
+    shape_t shape;
+    fixed_type image;
+
+    mdarray_conversion_fixture():
+        shape{300,400},
+        image(fixed_type::create(shape))
+    {
+        std::iota(image.begin(),image.end(),0.f);
+    }
+};
+
+BOOST_FIXTURE_TEST_SUITE(mdarray_conversion_test,mdarray_conversion_fixture)
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_move_construction)
+    {
+        const float32 *data = image.data();
+        dynamic_type a(std::move(image));
+        BOOST_CHECK_EQUAL(a.data(),data);
+        BOOST_CHECK(a.shape<shape_t>()==shape);
+        BOOST_CHECK_EQUAL(a(299,399),119999.f);
+
+        //and back 
+        fixed_type b(std::move(a));
+        BOOST_CHECK_EQUAL(b.data(),data);
+        BOOST_CHECK(b.shape<shape_t>()==shape);
+
+        //the map of the destination must support the rank
+        auto c = dynamic_type::create(shape_t{2,3,4});
+        BOOST_CHECK_THROW(fixed_type(std::move(c)),shape_mismatch_error);
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_move_assignment)
+    {
+        const float32 *data = image.data();
+        auto a = dynamic_type::create(shape_t{10});
+        a = std::move(image);
+        BOOST_CHECK_EQUAL(a.data(),data);
+        BOOST_CHECK(a.shape<shape_t>()==shape);
+
+        parallel_type p;
+        p = std::move(a);
+        BOOST_CHECK_EQUAL(p.data(),data);
+        BOOST_CHECK_EQUAL(p(1,2),402.f);
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_copy)
+    {
+        //same element type
+        dynamic_type a(image);
+        BOOST_CHECK(a.data()!=image.data());
+        BOOST_CHECK(std::equal(a.begin(),a.end(),image.begin()));
+
+        parallel_type p(image);
+        BOOST_CHECK(std::equal(p.begin(),p.end(),image.begin()));
+
+        auto b = fixed_type::create(shape);
+        b = p;
+        BOOST_CHECK(std::equal(b.begin(),b.end(),image.begin()));
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_convert)
+    {
+        auto raw = dynamic_array<uint16>::create(shape);
+        std::iota(raw.begin(),raw.end(),uint16(0));
+
+        dynamic_type a(raw);
+        for(size_t i=0;i<a.size();++i)
+            BOOST_CHECK_EQUAL(a[i],float32(uint16(i)));
+
+        auto b = mdarray<std::vector<float64>,dynamic_cindex_map,
+                         parallel_inplace_arithmetics>::create(shape);
+        b = raw;
+        for(size_t i=0;i<b.size();++i)
+            BOOST_CHECK_EQUAL(b[i],float64(uint16(i)));
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_expression)
+    {
+        //expressions are still evaluated 
+        auto a = dynamic_type::create(shape);
+        std::fill(a.begin(),a.end(),1.f);
+        dynamic_type b(a+image);
+        BOOST_CHECK_EQUAL(b[10],11.f);
+        BOOST_CHECK_EQUAL(a[10],1.f);
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,95 @@
+//
+// (c) Copyright 2026 DESY, Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+// This file is part of libpnicore.
+//
+// libpnicore is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpnicore is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpnicore.  If not, see <http://www.gnu.org/licenses/>.
+//
+// ===========================================================================
+//
+//  Created on: Oct 16, 2026
+//      Author: Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+#ifdef __GNUG__
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+#endif
+#include <boost/test/unit_test.hpp>
+#ifdef __GNUG__
+#pragma GCC diagnostic pop
+#endif
+#include <boost/mpl/list.hpp>
+#include <pni/core/types.hpp>
+#include <pni/core/arrays.hpp>
+#include <numeric>
+
+using namespace pni::core;
+
+typedef boost::mpl::list<numa_array<float64>,
+                         numa_array<float64,numa_policy::INTERLEAVE>,
+                         numa_array<float64,numa_policy::LOCAL>,
+                         dynamic_array<float64>,
+                         huge_page_array<float64>
+                        > array_types;
+
+BOOST_AUTO_TEST_SUITE(numa_array_test)
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE_TEMPLATE(test_parallel_init,ATYPE,array_types)
+    {
+        //large enough for parallel initialization
+        auto a = ATYPE::create(shape_t{20,100,100},1.5,parallel_init);
+        BOOST_CHECK_EQUAL(a.size(),200000);
+        BOOST_CHECK(std::all_of(a.begin(),a.end(),
+                                [](float64 v){ return v==1.5; }));
+
+        auto b = ATYPE::create(shape_t{10,10},parallel_init);
+        BOOST_CHECK(std::all_of(b.begin(),b.end(),
+                                [](float64 v){ return v==0.; }));
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_allocator)
+    {
+        for(size_t n: {size_t(10),size_t(1)<<20})
+        {
+            std::vector<uint16,numa_allocator<uint16>> a;
+            a.resize(n);
+            std::iota(a.begin(),a.end(),uint16(0));
+            BOOST_CHECK_EQUAL(a[n-1],uint16(n-1));
+
+            std::vector<uint16,numa_allocator<uint16,numa_policy::INTERLEAVE>>
+                b(a.begin(),a.end());
+            BOOST_CHECK(std::equal(a.begin(),a.end(),b.begin()));
+        }
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_arithmetic)
+    {
+        typedef numa_array<float32> array_type;
+        auto a = array_type::create(shape_t{300,300},1.f,parallel_init);
+        auto b = array_type::create(shape_t{300,300},2.f,parallel_init);
+
+        a += b;
+        BOOST_CHECK(std::all_of(a.begin(),a.end(),
+                                [](float32 v){ return v==3.f; }));
+
+        auto c = array_type::create(shape_t{300,300},no_init);
+        c = a*b-1.f;
+        BOOST_CHECK(std::all_of(c.begin(),c.end(),
+                                [](float32 v){ return v==5.f; }));
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
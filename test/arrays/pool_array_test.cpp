@@ -0,0 +1,136 @@
+//
+// (c) Copyright 2026 DESY, Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+// This file is part of libpnicore.
+//
+// libpnicore is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpnicore is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpnicore.  If not, see <http://www.gnu.org/licenses/>.
+//
+// ===========================================================================
+//
+//  Created on: Oct 16, 2026
+//      Author: Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+#ifdef __GNUG__
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+#endif
+#include <boost/test/unit_test.hpp>
+#ifdef __GNUG__
+#pragma GCC diagnostic pop
+#endif
+#include <pni/core/types.hpp>
+#include <pni/core/arrays.hpp>
+#include <numeric>
+
+using namespace pni::core;
+
+typedef pool_array<uint16> frame_type;
+typedef array_factory<frame_type> factory_type;
+
+BOOST_AUTO_TEST_SUITE(pool_array_test)
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_pool)
+    {
+        buffer_pool pool;
+        auto stats = pool.statistics();
+        BOOST_CHECK_EQUAL(stats.hits,0);
+        BOOST_CHECK_EQUAL(stats.misses,0);
+        BOOST_CHECK_EQUAL(stats.bytes_resident,0);
+
+        void *a = pool.allocate(1000);
+        void *b = pool.allocate(2000);
+        stats = pool.statistics();
+        BOOST_CHECK_EQUAL(stats.misses,2);
+        BOOST_CHECK_EQUAL(stats.bytes_in_use,3000);
+
+        pool.deallocate(a,1000);
+        stats = pool.statistics();
+        BOOST_CHECK_EQUAL(stats.bytes_resident,1000);
+        BOOST_CHECK_EQUAL(stats.bytes_in_use,2000);
+
+        //a buffer of the same size is reused
+        BOOST_CHECK_EQUAL(pool.allocate(1000),a);
+        BOOST_CHECK_EQUAL(pool.statistics().hits,1);
+        BOOST_CHECK_EQUAL(pool.statistics().bytes_resident,0);
+
+        pool.deallocate(a,1000);
+        pool.deallocate(b,2000);
+        BOOST_CHECK_EQUAL(pool.statistics().bytes_resident,3000);
+        pool.clear();
+        BOOST_CHECK_EQUAL(pool.statistics().bytes_resident,0);
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_capacity)
+    {
+        buffer_pool pool(1500);
+        BOOST_CHECK_EQUAL(pool.capacity(),1500);
+
+        void *a = pool.allocate(1000);
+        void *b = pool.allocate(1000);
+        pool.deallocate(a,1000);
+        pool.deallocate(b,1000);
+        BOOST_CHECK_EQUAL(pool.statistics().bytes_resident,1000);
+        BOOST_CHECK_EQUAL(pool.statistics().bytes_in_use,0);
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_frames)
+    {
+        buffer_pool pool;
+        const uint16 *first = nullptr;
+
+        for(size_t i=0;i<10;++i)
+        {
+            auto frame = factory_type::create(shape_t{256,128},pool);
+            BOOST_CHECK_EQUAL(frame.size(),256*128);
+            BOOST_CHECK_EQUAL(frame.rank(),2);
+            if(!first) first = frame.data();
+            BOOST_CHECK_EQUAL(frame.data(),first);
+
+            std::fill(frame.begin(),frame.end(),uint16(i));
+            BOOST_CHECK_EQUAL(frame(255,127),uint16(i));
+        }
+
+        auto stats = pool.statistics();
+        BOOST_CHECK_EQUAL(stats.misses,1);
+        BOOST_CHECK_EQUAL(stats.hits,9);
+        BOOST_CHECK_EQUAL(stats.bytes_resident,256*128*sizeof(uint16));
+        BOOST_CHECK_EQUAL(stats.bytes_in_use,0);
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_arithmetic)
+    {
+        buffer_pool pool;
+        auto a = factory_type::create(shape_t{10,10},pool);
+        auto b = factory_type::create(shape_t{10,10},pool);
+        std::iota(a.begin(),a.end(),uint16(0));
+        std::fill(b.begin(),b.end(),uint16(2));
+
+        //copies take their memory from the same pool
+        frame_type c(a);
+        BOOST_CHECK_EQUAL(pool.statistics().misses,3);
+        BOOST_CHECK(std::equal(a.begin(),a.end(),c.begin()));
+
+        c = a*b;
+        for(size_t i=0;i<c.size();++i) BOOST_CHECK_EQUAL(c[i],2*i);
+
+        //default construction uses the library pool
+        auto d = frame_type::create(shape_t{4,4},uint16(3));
+        BOOST_CHECK_EQUAL(d(3,3),3);
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,179 @@
+//
+// (c) Copyright 2012 DESY, Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+// This file is part of libpnicore.
+//
+// libpnicore is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpnicore is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpnicore.  If not, see <http://www.gnu.org/licenses/>.
+//
+// ===========================================================================
+//
+//  Created on: Oct 16, 2026
+//      Author: Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+#ifdef __GNUG__
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+#endif
+#include <boost/test/unit_test.hpp>
+#ifdef __GNUG__
+#pragma GCC diagnostic pop
+#endif
+#include <boost/test/parameterized_test.hpp>
+#include <vector>
+#include <array>
+#include <pni/core/types.hpp>
+#include <pni/core/arrays/index_map/index_maps.hpp>
+#include <pni/core/arrays/array_selection.hpp>
+
+using namespace pni::core;
+using namespace boost::unit_test;
+
+namespace findex_implementation_test
+{
+
+    typedef f_index_map_imp map_type; 
+    typedef std::vector<slice> slice_vector;
+    typedef std::vector<size_t> index_type;
+
+    typedef struct{
+        index_type shape;
+        index_type index;
+        size_t expected_offset; 
+    } offset_test_arg;
+
+    typedef std::vector<offset_test_arg> offset_test_args;
+
+    typedef struct{
+        slice_vector sel;
+        index_type shape;
+        index_type sel_index;
+        size_t expected_offset;
+    } sel_offset_test_arg;
+
+    typedef std::vector<sel_offset_test_arg> sel_offset_test_args;
+
+    //------------------------------------------------------------------------
+    void test_index(const offset_test_arg &arg)
+    {
+        shape_t index(arg.shape.size());
+        map_type::index(arg.shape,index,arg.expected_offset);
+        BOOST_CHECK_EQUAL_COLLECTIONS(index.begin(),index.end(),
+                                      arg.index.begin(),arg.index.end());
+    }
+
+    //------------------------------------------------------------------------
+    void test_offset(const offset_test_arg &arg)
+    {
+        BOOST_CHECK_EQUAL(map_type::offset(arg.shape,arg.index),
+                          arg.expected_offset);
+    }
+
+    //------------------------------------------------------------------------
+    void test_selection_offset(const sel_offset_test_arg &arg)
+    {
+        array_selection s = array_selection::create(arg.sel);
+        BOOST_CHECK_EQUAL(map_type::offset(s,arg.shape,arg.sel_index),
+                          arg.expected_offset);
+    }
+
+    //------------------------------------------------------------------------
+    void test_maps()
+    {
+        auto dmap = map_utils<dynamic_fmap>::create(index_type{3,4,5});
+        auto fmap = map_utils<fixed_dim_fmap<3>>::create(index_type{3,4,5});
+        static_fmap<3,4,5> smap;
+
+        index_type index{2,1,3};
+        size_t expected = 2+1*3+3*12;
+        BOOST_CHECK_EQUAL(dmap.offset(index),expected);
+        BOOST_CHECK_EQUAL(fmap.offset(index),expected);
+        BOOST_CHECK_EQUAL(smap.offset(index),expected);
+
+        for(size_t offset=0;offset<dmap.max_elements();++offset)
+        {
+            BOOST_CHECK_EQUAL(dmap.offset(dmap.index<index_type>(offset)),
+                              offset);
+            auto i = smap.index<std::array<size_t,3>>(offset);
+            BOOST_CHECK_EQUAL(smap.offset(i),offset);
+        }
+    }
+
+    //------------------------------------------------------------------------
+    void test_selection()
+    {
+        //3x4 matrix - rows 1 to 2 of column 2 are adjacent in memory
+        auto map = map_utils<dynamic_fmap>::create(index_type{3,4});
+        auto column = array_selection::create(slice_vector{slice(1,3),
+                                                           slice(2)});
+        BOOST_CHECK(is_contiguous(map,column));
+        BOOST_CHECK_EQUAL(start_offset(map,column),1+2*3);
+        BOOST_CHECK_EQUAL(last_offset(map,column),2+2*3);
+
+        //a row is strided
+        auto row = array_selection::create(slice_vector{slice(1),
+                                                        slice(0,4)});
+        BOOST_CHECK(!is_contiguous(map,row));
+        BOOST_CHECK_EQUAL(start_offset(map,row),1);
+        BOOST_CHECK_EQUAL(last_offset(map,row),1+3*3);
+        auto strides = effective_strides(map,row);
+        BOOST_CHECK_EQUAL(strides.size(),1);
+        BOOST_CHECK_EQUAL(strides[0],3);
+
+        //full columns 1 to 2 form a single block
+        auto block = array_selection::create(slice_vector{slice(0,3),
+                                                          slice(1,3)});
+        BOOST_CHECK(is_contiguous(map,block));
+        strides = effective_strides(map,block);
+        BOOST_CHECK_EQUAL(strides[0],1);
+        BOOST_CHECK_EQUAL(strides[1],3);
+    }
+
+}
+
+
+//============================================================================
+int findex_implementation_test_init()
+{
+    namespace test_ns = findex_implementation_test;  
+
+    test_suite *ts = BOOST_TEST_SUITE("findex_implementation_test");
+    test_ns::offset_test_args offset_args = {{{100},{5},5},
+                                             {{100,23},{5,10},5+10*100},
+                                             {{2,3,4},{1,2,3},1+2*2+3*6}};
+
+    ts->add(BOOST_PARAM_TEST_CASE(&test_ns::test_index,
+                                  offset_args.begin(),
+                                  offset_args.end()));
+
+    ts->add(BOOST_PARAM_TEST_CASE(&test_ns::test_offset,
+                                  offset_args.begin(),
+                                  offset_args.end()));
+
+    test_ns::sel_offset_test_args soffset_args = {
+    {{slice(5,7)},{10},{1},6},
+    {{slice(3,8),slice(7,10)},{10,20},{2,1},5+8*10},
+    {{slice(3),slice(7,10)},{10,20},{1},3+8*10}
+    };
+
+    ts->add(BOOST_PARAM_TEST_CASE(&test_ns::test_selection_offset,
+                                  soffset_args.begin(),
+                                  soffset_args.end()));
+
+    ts->add(BOOST_TEST_CASE(&test_ns::test_maps));
+    ts->add(BOOST_TEST_CASE(&test_ns::test_selection));
+
+    framework::master_test_suite().add(ts);
+
+    return 0;
+}
@@ -34,6 +34,7 @@
 #endif
 
 extern int cindex_implementation_test_init();
+extern int findex_implementation_test_init();
 extern int dynamic_cindex_map_test_init();
 extern int fixed_dim_cindex_map_test_init();
 
@@ -41,6 +42,7 @@ extern int fixed_dim_cindex_map_test_init();
 bool init_function()
 {
     cindex_implementation_test_init();
+    findex_implementation_test_init();
     dynamic_cindex_map_test_init();
     fixed_dim_cindex_map_test_init();
     return true;
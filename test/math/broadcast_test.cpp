@@ -0,0 +1,186 @@
+//
+// (c) Copyright 2026 DESY, Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+// This file is part of libpnicore.
+//
+// libpnicore is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpnicore is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpnicore.  If not, see <http://www.gnu.org/licenses/>.
+//
+// ===========================================================================
+//
+//  Created on: Oct 16, 2026
+//      Author: Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+#ifdef __GNUG__
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+#endif
+#include <boost/test/unit_test.hpp>
+#ifdef __GNUG__
+#pragma GCC diagnostic pop
+#endif
+#include <boost/mpl/list.hpp>
+#include <pni/core/types.hpp>
+#include <pni/core/arrays.hpp>
+#include <numeric>
+
+using namespace pni::core;
+
+typedef boost::mpl::list<int32,uint16,int64,float32,float64>
+        broadcast_types;
+
+BOOST_AUTO_TEST_SUITE(broadcast_test)
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_broadcast_shape)
+    {
+        BOOST_CHECK((broadcast_shape(shape_t{5,3,4},shape_t{3,4}) ==
+                     shape_t{5,3,4}));
+        BOOST_CHECK((broadcast_shape(shape_t{3,1},shape_t{5,1,4}) ==
+                     shape_t{5,3,4}));
+        BOOST_CHECK((broadcast_shape(shape_t{},shape_t{2,3}) ==
+                     shape_t{2,3}));
+        BOOST_CHECK((broadcast_shape(shape_t{2,3},shape_t{2,3}) ==
+                     shape_t{2,3}));
+        BOOST_CHECK_THROW(broadcast_shape(shape_t{5,3,4},shape_t{3,5}),
+                          shape_mismatch_error);
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_broadcast_map)
+    {
+        broadcast_map identity(shape_t{3,4},shape_t{3,4});
+        BOOST_CHECK(identity.is_identity());
+        BOOST_CHECK_EQUAL(identity(7),7);
+
+        broadcast_map leading(shape_t{3,4},shape_t{5,3,4});
+        BOOST_CHECK(!leading.is_identity());
+        BOOST_CHECK_EQUAL(leading.period(),12);
+        BOOST_CHECK_EQUAL(leading(31),7);
+
+        broadcast_map rows(shape_t{3,1},shape_t{2,3,4});
+        BOOST_CHECK_EQUAL(rows.period(),0);
+        for(size_t i=0;i<24;++i) BOOST_CHECK_EQUAL(rows(i),(i/4)%3);
+
+        std::vector<size_t> operand{0,1,2};
+        std::vector<size_t> buffer(20);
+        rows.gather(operand,3,20,buffer.data());
+        for(size_t i=0;i<20;++i) BOOST_CHECK_EQUAL(buffer[i],rows(i+3));
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE_TEMPLATE(test_dark_subtraction,T,broadcast_types)
+    {
+        auto stack = dynamic_array<T>::create(shape_t{4,3,5});
+        auto dark  = dynamic_array<T>::create(shape_t{3,5});
+        std::iota(stack.begin(),stack.end(),T(10));
+        std::iota(dark.begin(),dark.end(),T(0));
+
+        auto expression = stack - dark;
+        BOOST_CHECK_EQUAL(expression.size(),stack.size());
+        BOOST_CHECK_EQUAL(expression.rank(),3);
+        BOOST_CHECK((expression.template shape<shape_t>() ==
+                     shape_t{4,3,5}));
+
+        auto result = dynamic_array<T>::create(shape_t{4,3,5});
+        result = stack - dark;
+        for(size_t i=0;i<result.size();++i)
+            BOOST_CHECK_EQUAL(result[i],T(stack[i]-dark[i%15]));
+
+        dynamic_array<T> inverse(dark - stack);
+        BOOST_CHECK((inverse.template shape<shape_t>() == shape_t{4,3,5}));
+        for(size_t i=0;i<inverse.size();++i)
+            BOOST_CHECK_EQUAL(inverse[i],T(dark[i%15]-stack[i]));
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE_TEMPLATE(test_row_gain,T,broadcast_types)
+    {
+        auto frame = dynamic_array<T>::create(shape_t{3,5});
+        auto gain  = dynamic_array<T>::create(shape_t{3,1});
+        auto column= dynamic_array<T>::create(shape_t{5});
+        std::iota(frame.begin(),frame.end(),T(1));
+        std::iota(gain.begin(),gain.end(),T(1));
+        std::iota(column.begin(),column.end(),T(2));
+
+        auto result = dynamic_array<T>::create(shape_t{3,5});
+        result = frame*gain;
+        for(size_t r=0;r<3;++r)
+            for(size_t c=0;c<5;++c)
+                BOOST_CHECK_EQUAL(result(r,c),T(frame(r,c)*gain(r,0)));
+
+        result = (frame+column)/gain;
+        for(size_t r=0;r<3;++r)
+            for(size_t c=0;c<5;++c)
+                BOOST_CHECK_EQUAL(result(r,c),
+                                  T((frame(r,c)+column[c])/gain(r,0)));
+
+        //outer product of a column and a row vector
+        result = gain*column;
+        for(size_t r=0;r<3;++r)
+            for(size_t c=0;c<5;++c)
+                BOOST_CHECK_EQUAL(result(r,c),T(gain[r]*column[c]));
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_views)
+    {
+        auto stack = dynamic_array<float64>::create(shape_t{4,3,5});
+        auto dark  = dynamic_array<float64>::create(shape_t{2,5});
+        std::iota(stack.begin(),stack.end(),0.);
+        std::iota(dark.begin(),dark.end(),0.);
+
+        auto roi = stack(slice(0,4),slice(1,3),slice(0,5));
+        dynamic_array<float64> result(roi - dark);
+        BOOST_CHECK((result.shape<shape_t>() == shape_t{4,2,5}));
+        for(size_t i=0;i<result.size();++i)
+            BOOST_CHECK_EQUAL(result[i],roi[i]-dark[i%10]);
+
+        auto row = dark(0,slice(0,5));
+        result = roi*row+1.;
+        for(size_t i=0;i<result.size();++i)
+            BOOST_CHECK_EQUAL(result[i],roi[i]*row[i%5]+1.);
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_large)
+    {
+        typedef mdarray<std::vector<float64>,dynamic_cindex_map,
+                        parallel_inplace_arithmetics> array_type;
+
+        auto stack = array_type::create(shape_t{10,120,100});
+        auto dark  = dynamic_array<float64>::create(shape_t{120,100});
+        auto gain  = dynamic_array<float64>::create(shape_t{120,1});
+        std::iota(stack.begin(),stack.end(),0.);
+        std::iota(dark.begin(),dark.end(),0.);
+        std::iota(gain.begin(),gain.end(),1.);
+
+        auto result = array_type::create(shape_t{10,120,100});
+        result = (stack-dark)*gain;
+        for(size_t i=0;i<result.size();++i)
+            BOOST_CHECK_EQUAL(result[i],(stack[i]-dark[i%12000])*
+                                        gain[(i/100)%120]);
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_errors)
+    {
+        auto a = dynamic_array<float64>::create(shape_t{4,3,5});
+        auto b = dynamic_array<float64>::create(shape_t{4,5});
+        BOOST_CHECK_THROW(a+b,shape_mismatch_error);
+        BOOST_CHECK_THROW(a-b,shape_mismatch_error);
+        BOOST_CHECK_THROW(a*b,shape_mismatch_error);
+        BOOST_CHECK_THROW(a/b,shape_mismatch_error);
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,257 @@
+//
+// (c) Copyright 2026 DESY, Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+// This file is part of libpnicore.
+//
+// libpnicore is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpnicore is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpnicore.  If not, see <http://www.gnu.org/licenses/>.
+//
+// ===========================================================================
+//
+//  Created on: Oct 16, 2026
+//      Author: Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+#ifdef __GNUG__
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+#endif
+#include <boost/test/unit_test.hpp>
+#ifdef __GNUG__
+#pragma GCC diagnostic pop
+#endif
+#include <boost/mpl/list.hpp>
+#include <pni/core/types.hpp>
+#include <pni/core/arrays.hpp>
+#include <pni/core/algorithms/comparisons.hpp>
+#include "../data_generator.hpp"
+#include <vector>
+#include <limits>
+#include <algorithm>
+
+using namespace pni::core;
+
+typedef boost::mpl::list<int8,int16,int32,int64,uint8,uint16,uint32,uint64,
+                         float32,float64,float128,complex32,complex64,
+                         complex128> all_types;
+
+typedef boost::mpl::list<float32,float64,complex32,complex64> simd_types;
+
+static const std::vector<simd_isa_t> isa_levels{simd_isa_t::NONE,
+                                                simd_isa_t::SSE2,
+                                                simd_isa_t::AVX2};
+
+//type of the real and imaginary part
+template<typename T> struct base_trait { typedef T type; };
+template<typename T> struct base_trait<std::complex<T>> { typedef T type; };
+
+template<typename T> struct comparison_fixture
+{
+    typedef typename base_trait<T>::type base_type;
+    typedef dynamic_array<T> array_type;
+    random_generator<T> generator;
+    array_type a;
+    array_type b;
+
+    comparison_fixture(const shape_t &shape):
+        generator(base_type(1),base_type(10)),
+        a(array_type::create(shape)),
+        b(array_type::create(shape))
+    {
+        std::generate(a.begin(),a.end(),generator);
+        std::copy(a.begin(),a.end(),b.begin());
+    }
+
+    ~comparison_fixture() { simd_isa(detect_simd_isa()); }
+};
+
+BOOST_AUTO_TEST_SUITE(comparisons_test)
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE_TEMPLATE(test_array_equal,T,all_types)
+    {
+        comparison_fixture<T> f(shape_t{5,30,70});
+        size_t index;
+
+        BOOST_CHECK(array_equal(f.a,f.b,index));
+        BOOST_CHECK_EQUAL(index,f.a.size());
+        BOOST_CHECK(f.a==f.b);
+
+        //a difference in every block position
+        for(size_t i: {size_t(0),size_t(1000),size_t(4000),f.a.size()-1})
+        {
+            f.b[i] = f.a[i]+T(1);
+            BOOST_CHECK(!array_equal(f.a,f.b,index));
+            BOOST_CHECK_EQUAL(index,i);
+            BOOST_CHECK(f.a!=f.b);
+            f.b[i] = f.a[i];
+        }
+
+        //the shape must match
+        auto c = dynamic_array<T>::create(shape_t{5,70,30});
+        std::copy(f.a.begin(),f.a.end(),c.begin());
+        BOOST_CHECK(!array_equal(f.a,c,index));
+        BOOST_CHECK_EQUAL(index,0);
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE_TEMPLATE(test_allclose,T,simd_types)
+    {
+        typedef typename base_trait<T>::type base_type;
+        comparison_fixture<T> f(shape_t{3,1000});
+        const size_t last = f.a.size()-1;
+
+        for(auto isa: isa_levels)
+        {
+            simd_isa(isa);
+            size_t index;
+
+            for(size_t i=0;i<f.b.size();++i)
+                f.b[i] = f.a[i]*base_type(1.00001);
+            BOOST_CHECK(allclose(f.a,f.b,1e-4,0.,index));
+            BOOST_CHECK_EQUAL(index,f.a.size());
+            BOOST_CHECK(!allclose(f.a,f.b,1e-7,0.,index));
+            BOOST_CHECK_EQUAL(index,0);
+
+            std::copy(f.a.begin(),f.a.end(),f.b.begin());
+            f.b[last] = f.a[last]+T(0.5);
+            BOOST_CHECK(!allclose(f.a,f.b,1e-5,1e-8,index));
+            BOOST_CHECK_EQUAL(index,last);
+            BOOST_CHECK(allclose(f.a,f.b,0.,0.6,index));
+            BOOST_CHECK(!allclose(f.a,f.b,0.,0.4,index));
+
+            f.b[17] = T(std::numeric_limits<base_type>::quiet_NaN());
+            BOOST_CHECK(!allclose(f.a,f.b,1.,1.,index));
+            BOOST_CHECK_EQUAL(index,17);
+            f.b[17] = f.a[17];
+        }
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE_TEMPLATE(test_special_values,T,simd_types)
+    {
+        typedef typename base_trait<T>::type base_type;
+        comparison_fixture<T> f(shape_t{100});
+        const base_type inf = std::numeric_limits<base_type>::infinity();
+
+        for(auto isa: isa_levels)
+        {
+            simd_isa(isa);
+            size_t index;
+
+            std::copy(f.a.begin(),f.a.end(),f.b.begin());
+            f.a[5] = f.b[5] = T(inf);
+            f.a[6] = T(base_type(0));
+            f.b[6] = T(-base_type(0));
+            BOOST_CHECK(array_equal(f.a,f.b));
+            BOOST_CHECK(allclose(f.a,f.b));
+
+            f.b[5] = T(-inf);
+            BOOST_CHECK(!array_equal(f.a,f.b,index));
+            BOOST_CHECK_EQUAL(index,5);
+            BOOST_CHECK(!allclose(f.a,f.b,1.,1.,index));
+            BOOST_CHECK_EQUAL(index,5);
+
+            f.a[5] = f.b[5] = T(std::numeric_limits<base_type>::quiet_NaN());
+            BOOST_CHECK(!array_equal(f.a,f.b,index));
+            BOOST_CHECK_EQUAL(index,5);
+        }
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_integer_allclose)
+    {
+        comparison_fixture<int32> f(shape_t{10,10});
+        size_t index;
+
+        f.b[42] = f.a[42]+1;
+        BOOST_CHECK(allclose(f.a,f.b,0.,1.));
+        BOOST_CHECK(!allclose(f.a,f.b,0.,0.5,index));
+        BOOST_CHECK_EQUAL(index,42);
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_views)
+    {
+        comparison_fixture<float64> f(shape_t{4,50,60});
+        size_t index;
+
+        //contiguous and strided views
+        auto va = f.a(slice(1,3),slice(0,50),slice(0,60));
+        auto vb = f.b(slice(1,3),slice(0,50),slice(0,60));
+        BOOST_CHECK(array_equal(va,vb));
+
+        auto sa = f.a(slice(0,4),slice(10,40,3),slice(5,60,2));
+        auto sb = f.b(slice(0,4),slice(10,40,3),slice(5,60,2));
+        BOOST_CHECK(array_equal(sa,sb));
+        BOOST_CHECK(allclose(sa,sb));
+
+        f.b(3,37,59) += 1.;
+        BOOST_CHECK(!array_equal(sa,sb,index));
+        BOOST_CHECK_EQUAL(index,sa.size()-1);
+        BOOST_CHECK(array_equal(va,vb));
+
+        //view against array
+        auto frame = dynamic_array<float64>::create(shape_t{50,60});
+        auto fa = f.a(2,slice(0,50),slice(0,60));
+        std::copy(fa.begin(),fa.end(),frame.begin());
+        BOOST_CHECK(array_equal(fa,frame));
+        BOOST_CHECK(array_equal(frame,fa));
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_expressions)
+    {
+        comparison_fixture<float32> f(shape_t{20,300});
+        size_t index;
+
+        auto c = dynamic_array<float32>::create(shape_t{20,300});
+        for(size_t i=0;i<c.size();++i) c[i] = f.a[i]+f.b[i];
+
+        BOOST_CHECK(array_equal(f.a+f.b,c));
+        BOOST_CHECK(allclose(c,(f.a*2.f)));
+
+        c[5000] = 0.f;
+        BOOST_CHECK(!array_equal(f.a+f.b,c,index));
+        BOOST_CHECK_EQUAL(index,5000);
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_mixed_types)
+    {
+        auto a = dynamic_array<uint16>::create(shape_t{10,20});
+        auto b = dynamic_array<float32>::create(shape_t{10,20});
+        for(size_t i=0;i<a.size();++i) a[i] = b[i] = i;
+        size_t index;
+
+        BOOST_CHECK(array_equal(a,b));
+        b[150] = 150.25f;
+        BOOST_CHECK(!array_equal(a,b,index));
+        BOOST_CHECK_EQUAL(index,150);
+        BOOST_CHECK(allclose(a,b,0.,0.5));
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_bool)
+    {
+        typedef dynamic_array<bool> array_type;
+        auto a = array_type::create(shape_t{3,5},false);
+        auto b = array_type::create(shape_t{3,5},false);
+        auto c = array_type::create(shape_t{3,5},true);
+        size_t index;
+
+        BOOST_CHECK(array_equal(a,b));
+        BOOST_CHECK(!array_equal(a,c,index));
+        BOOST_CHECK_EQUAL(index,0);
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
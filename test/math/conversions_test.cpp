@@ -0,0 +1,218 @@
+//
+// (c) Copyright 2026 DESY, Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+// This file is part of libpnicore.
+//
+// libpnicore is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpnicore is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpnicore.  If not, see <http://www.gnu.org/licenses/>.
+//
+// ===========================================================================
+//
+//  Created on: Oct 16, 2026
+//      Author: Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+#ifdef __GNUG__
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+#endif
+#include <boost/test/unit_test.hpp>
+#ifdef __GNUG__
+#pragma GCC diagnostic pop
+#endif
+#include <boost/mpl/list.hpp>
+#include <pni/core/types.hpp>
+#include <pni/core/algorithms/conversions.hpp>
+#include <vector>
+#include <limits>
+
+using namespace pni::core;
+
+static const std::vector<simd_isa_t> isa_levels{simd_isa_t::NONE,
+                                                simd_isa_t::SSE2,
+                                                simd_isa_t::AVX2};
+
+struct isa_fixture
+{
+    ~isa_fixture() { simd_isa(detect_simd_isa()); }
+};
+
+//check that convert_n yields the same as convert for a single value at
+//every position of a block and for every instruction set
+template<
+         typename TT,
+         typename ST
+        >
+void check_values(const std::vector<ST> &values)
+{
+    const size_t size = 3*conversion_block+17;
+
+    for(auto isa: isa_levels)
+    {
+        simd_isa(isa);
+        for(auto v: values)
+        {
+            bool fits = true;
+            TT expected = TT();
+            try { expected = convert<TT>(v); }
+            catch(const range_error &) { fits = false; }
+
+            for(size_t i: {size_t(0),size_t(conversion_block+5),size_t(size-1)})
+            {
+                std::vector<ST> src(size,ST(1));
+                std::vector<TT> dst(size);
+                src[i] = v;
+
+                if(fits)
+                {
+                    BOOST_CHECK_NO_THROW(convert_n(src.data(),dst.data(),size));
+                    BOOST_CHECK_EQUAL(dst[i],expected);
+                    BOOST_CHECK_EQUAL(dst[size/2],TT(1));
+                }
+                else
+                    BOOST_CHECK_THROW(convert_n(src.data(),dst.data(),size),
+                                      range_error);
+            }
+        }
+    }
+}
+
+BOOST_AUTO_TEST_SUITE(conversions_test)
+
+    //========================================================================
+    BOOST_FIXTURE_TEST_CASE(test_unchecked,isa_fixture)
+    {
+        std::vector<uint16> frame(5003);
+        std::vector<int32> idata(frame.size());
+        for(size_t i=0;i<frame.size();++i)
+        {
+            frame[i] = uint16(i*13);
+            idata[i] = int32(i)-2500;
+        }
+
+        std::vector<float32> fdata(frame.size());
+        convert_n(frame.data(),fdata.data(),frame.size());
+        for(size_t i=0;i<frame.size();++i)
+            BOOST_CHECK_EQUAL(fdata[i],float32(frame[i]));
+
+        std::vector<float64> ddata(idata.size());
+        convert_n(idata.data(),ddata.data(),idata.size());
+        for(size_t i=0;i<idata.size();++i)
+            BOOST_CHECK_EQUAL(ddata[i],float64(idata[i]));
+
+        std::vector<complex64> cdata(idata.size());
+        convert_n(idata.data(),cdata.data(),idata.size());
+        BOOST_CHECK_EQUAL(cdata[17],complex64(-2483,0));
+    }
+
+    //========================================================================
+    BOOST_FIXTURE_TEST_CASE(test_integer_ranges,isa_fixture)
+    {
+        check_values<uint16,int32>({-1,0,65535,65536,
+                                    std::numeric_limits<int32>::min()});
+        check_values<int8,int16>({-129,-128,127,128});
+        check_values<uint8,int8>({-1,-128,127});
+        check_values<int8,uint8>({127,128,255});
+        check_values<int16,uint16>({32767,32768,65535});
+        check_values<int32,uint32>({2147483647u,2147483648u,4294967295u});
+        check_values<uint32,int32>({-1,2147483647});
+        check_values<int64,uint64>({9223372036854775807ull,
+                                    9223372036854775808ull});
+        check_values<uint32,int64>({-1,4294967295ll,4294967296ll});
+        check_values<int16,int64>({-32769,-32768,32767,32768});
+    }
+
+    //========================================================================
+    BOOST_FIXTURE_TEST_CASE(test_float_ranges,isa_fixture)
+    {
+        const float64 max = std::numeric_limits<float32>::max();
+        const float64 inf = std::numeric_limits<float64>::infinity();
+
+        check_values<float32,float64>({max,-max,1e39,-1e39,inf,-inf,1e-50});
+        check_values<complex32,float64>({max,1e39,-inf});
+        check_values<float64,float128>({1e300,1e310l,-1e310l});
+        check_values<complex32,complex64>({complex64(1,2),complex64(1e39,0),
+                                           complex64(0,-1e39)});
+        check_values<complex64,complex128>({complex128(1e300,1e300),
+                                            complex128(0,1e310l)});
+    }
+
+    //========================================================================
+    BOOST_FIXTURE_TEST_CASE(test_nan,isa_fixture)
+    {
+        const float64 nan = std::numeric_limits<float64>::quiet_NaN();
+        std::vector<float64> src(100,nan);
+        std::vector<float32> dst(src.size());
+
+        for(auto isa: isa_levels)
+        {
+            simd_isa(isa);
+            src[50] = 2.5;
+            BOOST_CHECK_NO_THROW(convert_n(src.data(),dst.data(),src.size()));
+            BOOST_CHECK(std::isnan(dst[0]));
+            BOOST_CHECK_EQUAL(dst[50],2.5f);
+
+            src[50] = 1e40;
+            BOOST_CHECK_THROW(convert_n(src.data(),dst.data(),src.size()),
+                              range_error);
+        }
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_policy)
+    {
+        std::vector<int32> src{1,65537,-1};
+        std::vector<uint16> dst(src.size());
+
+        BOOST_CHECK_THROW(convert_n(src.data(),dst.data(),src.size()),
+                          range_error);
+        convert_n(src.data(),dst.data(),src.size(),
+                  conversion_policy::UNCHECKED);
+        BOOST_CHECK_EQUAL(dst[0],1);
+        BOOST_CHECK_EQUAL(dst[1],1);
+        BOOST_CHECK_EQUAL(dst[2],65535);
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_type_erased)
+    {
+        std::vector<uint16> frame{1,2,3,65535};
+        std::vector<float32> fdata(frame.size());
+        std::vector<int8> idata(frame.size());
+
+        convert_n(type_id_t::UINT16,type_id_t::FLOAT32,frame.data(),
+                  fdata.data(),frame.size());
+        BOOST_CHECK_EQUAL(fdata[3],65535.f);
+
+        BOOST_CHECK_THROW(convert_n(type_id_t::UINT16,type_id_t::INT8,
+                                    frame.data(),idata.data(),frame.size()),
+                          range_error);
+        convert_n(type_id_t::UINT16,type_id_t::INT8,frame.data(),
+                  idata.data(),3);
+        BOOST_CHECK_EQUAL(idata[2],3);
+
+        //no conversion from floating point to integer or non-numeric types
+        BOOST_CHECK_THROW(convert_n(type_id_t::FLOAT32,type_id_t::UINT16,
+                                    fdata.data(),frame.data(),frame.size()),
+                          type_error);
+        BOOST_CHECK_THROW(convert_n(type_id_t::COMPLEX32,type_id_t::FLOAT32,
+                                    fdata.data(),fdata.data(),0),
+                          type_error);
+        BOOST_CHECK_THROW(convert_n(type_id_t::STRING,type_id_t::STRING,
+                                    nullptr,nullptr,0),type_error);
+        BOOST_CHECK_THROW(convert_n(type_id_t::BOOL,type_id_t::UINT8,
+                                    nullptr,nullptr,0),type_error);
+        BOOST_CHECK_THROW(convert_n(type_id_t::NONE,type_id_t::UINT8,
+                                    nullptr,nullptr,0),type_error);
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,175 @@
+//
+// (c) Copyright 2013 DESY, Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+// This file is part of libpnicore.
+//
+// libpnicore is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpnicore is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpnicore.  If not, see <http://www.gnu.org/licenses/>.
+//
+// ===========================================================================
+//
+//  Created on: Oct 16, 2026
+//      Author: Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+#ifdef __GNUG__
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+#endif
+#include <boost/test/unit_test.hpp>
+#ifdef __GNUG__
+#pragma GCC diagnostic pop
+#endif
+#include <pni/core/types.hpp>
+#include <pni/core/arrays.hpp>
+#include "array_types.hpp"
+#include "../data_generator.hpp"
+#include <numeric>
+#include <algorithm>
+
+using namespace pni::core;
+
+//element type for the random number generator
+template<typename T> struct base_type { typedef T type; };
+template<typename T> struct base_type<std::complex<T>> { typedef T type; };
+
+template<typename AT> struct evaluator_fixture
+{
+    typedef typename AT::value_type value_type;
+    typedef typename base_type<value_type>::type base_value_type;
+    random_generator<value_type> generator;
+    AT raw,dark,gain;
+
+    evaluator_fixture():
+        generator(base_value_type(1),base_value_type(5)),
+        raw(AT::create(shape_t{2,3,4})),
+        dark(AT::create(shape_t{2,3,4})),
+        gain(AT::create(shape_t{2,3,4}))
+    {
+        std::generate(raw.begin(),raw.end(),generator);
+        std::generate(dark.begin(),dark.end(),generator);
+        std::generate(gain.begin(),gain.end(),generator);
+    }
+};
+
+BOOST_AUTO_TEST_SUITE(expression_evaluator_test)
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE_TEMPLATE(test_fusable,AT,all_array_types)
+    {
+        typedef evaluator_fixture<AT> fixture_type;
+        fixture_type f;
+
+        typedef decltype((f.raw-f.dark)*f.gain) expression_type;
+        BOOST_CHECK((is_fused_evaluation<AT,expression_type>::value));
+        BOOST_CHECK((is_fused_evaluation<AT,AT>::value));
+
+        typedef decltype(f.raw+int8(1)) mixed_type;
+        BOOST_CHECK((!is_fused_evaluation<AT,mixed_type>::value ||
+                     std::is_same<typename AT::value_type,int8>::value));
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE_TEMPLATE(test_assignment,AT,all_array_types)
+    {
+        typedef typename AT::value_type value_type;
+        typedef evaluator_fixture<AT> fixture_type;
+        fixture_type f;
+        value_type s = f.generator();
+
+        AT result = AT::create(shape_t{2,3,4});
+        result = (f.raw-f.dark)*f.gain;
+        for(size_t i=0;i<result.size();++i)
+            BOOST_CHECK_EQUAL(result[i],
+                              value_type((f.raw[i]-f.dark[i])*f.gain[i]));
+
+        result = s*f.raw+f.dark/s;
+        for(size_t i=0;i<result.size();++i)
+            BOOST_CHECK_EQUAL(result[i],value_type(s*f.raw[i]+f.dark[i]/s));
+
+        result = f.gain-(f.raw+f.dark)*(f.gain-s);
+        for(size_t i=0;i<result.size();++i)
+            BOOST_CHECK_EQUAL(result[i],value_type(f.gain[i]-
+                              (f.raw[i]+f.dark[i])*(f.gain[i]-s)));
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE_TEMPLATE(test_construction,AT,all_array_types)
+    {
+        typedef typename AT::value_type value_type;
+        typedef evaluator_fixture<AT> fixture_type;
+        fixture_type f;
+
+        AT result((f.raw-f.dark)*f.gain);
+        for(size_t i=0;i<result.size();++i)
+            BOOST_CHECK_EQUAL(result[i],
+                              value_type((f.raw[i]-f.dark[i])*f.gain[i]));
+
+        AT copy(f.raw);
+        for(size_t i=0;i<copy.size();++i) BOOST_CHECK_EQUAL(copy[i],f.raw[i]);
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE_TEMPLATE(test_aliasing,AT,dyn_array_types)
+    {
+        typedef typename AT::value_type value_type;
+        typedef evaluator_fixture<AT> fixture_type;
+        fixture_type f;
+        AT orig(f.raw);
+
+        f.raw = f.dark+f.raw*f.raw;
+        for(size_t i=0;i<f.raw.size();++i)
+            BOOST_CHECK_EQUAL(f.raw[i],value_type(f.dark[i]+orig[i]*orig[i]));
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_large)
+    {
+        typedef mdarray<std::vector<float64>,dynamic_cindex_map,
+                        parallel_inplace_arithmetics> array_type;
+        shape_t shape{3,300,400};
+
+        auto raw  = array_type::create(shape);
+        auto dark = array_type::create(shape);
+        auto gain = dynamic_array<float64>::create(shape);
+        std::iota(raw.begin(),raw.end(),0.);
+        std::fill(dark.begin(),dark.end(),2.);
+        std::fill(gain.begin(),gain.end(),0.5);
+
+        auto result = array_type::create(shape);
+        result = (raw-dark)*gain;
+        for(size_t i=0;i<result.size();++i)
+            BOOST_CHECK_EQUAL(result[i],(float64(i)-2.)*0.5);
+
+        //a view as a leaf is gathered element by element
+        auto frame = dynamic_array<float64>::create(shape_t{300,400});
+        frame = raw(1,slice(0,300),slice(0,400))-dark(0,slice(0,300),
+                                                        slice(0,400));
+        for(size_t i=0;i<frame.size();++i)
+            BOOST_CHECK_EQUAL(frame[i],float64(i+120000)-2.);
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_mixed_types)
+    {
+        auto a = dynamic_array<int32>::create(shape_t{10});
+        auto b = dynamic_array<float64>::create(shape_t{10});
+        std::iota(a.begin(),a.end(),0);
+        std::fill(b.begin(),b.end(),0.5);
+
+        //element types differ - evaluated element by element
+        auto result = dynamic_array<float64>::create(shape_t{10});
+        result = a+b;
+        for(size_t i=0;i<10;++i) BOOST_CHECK_EQUAL(result[i],float64(i));
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
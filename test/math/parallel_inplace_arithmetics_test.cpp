@@ -0,0 +1,233 @@
+//
+// (c) Copyright 2013 DESY, Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+// This file is part of libpnicore.
+//
+// libpnicore is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpnicore is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpnicore.  If not, see <http://www.gnu.org/licenses/>.
+//
+// ===========================================================================
+//
+//  Created on: Oct 16, 2026
+//      Author: Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+
+#ifdef __GNUG__
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+#endif
+#include <boost/test/unit_test.hpp>
+#ifdef __GNUG__
+#pragma GCC diagnostic pop
+#endif
+#include <boost/current_function.hpp>
+#include <pni/core/algorithms/math/parallel_inplace_arithmetics.hpp>
+
+#include "array_types.hpp"
+#include <cmath>
+#include <numeric>
+#include "number_ranges.hpp"
+#include "fixture.hpp"
+
+namespace boost{
+namespace math{
+
+    //utility funtion template to check for the finiteness of a 
+    //comples value. This is only the case if real and imaginary part 
+    //are finite.
+    template<typename T> bool isfinite(std::complex<T> v)
+    {
+
+        return isfinite(v.real()) && isfinite(v.imag());
+    }
+}
+}
+
+typedef parallel_inplace_arithmetics ip_type; 
+
+//
+// fixture with arrays above the threshold for parallel execution using a 
+// thread pool with 4 workers
+//
+template<typename AT> struct parallel_fixture
+{
+    typedef typename AT::value_type value_type;
+    typedef random_generator<value_type> generator_type;
+
+    AT lhs;
+    AT lhs_orig;
+    AT rhs;
+    value_type rhs_scalar;
+
+    template<typename RT> parallel_fixture(const RT &r):
+        lhs(AT::create(shape_t{3,ip_type::min_size/2+7})),
+        lhs_orig(AT::create(lhs.template shape<shape_t>())),
+        rhs(AT::create(lhs.template shape<shape_t>())),
+        rhs_scalar()
+    {
+        thread_pool::instance().resize(4);
+        generator_type gen_lhs(r.lhs_min(),r.lhs_max());
+        generator_type gen_rhs(r.rhs_min(),r.rhs_max());
+        std::generate(lhs.begin(),lhs.end(),gen_lhs);
+        std::generate(rhs.begin(),rhs.end(),gen_rhs);
+        std::copy(lhs.begin(),lhs.end(),lhs_orig.begin());
+        rhs_scalar = gen_rhs();
+    }
+
+    ~parallel_fixture()
+    {
+        thread_pool::instance().resize(thread_pool::default_size());
+    }
+};
+
+BOOST_AUTO_TEST_SUITE(parallel_inplace_arithmetics_test)
+
+    BOOST_AUTO_TEST_CASE_TEMPLATE(serial_test,AT,all_array_types)
+    {
+        typedef typename AT::value_type value_type;
+        fixture<AT> f((add_ranges<value_type>()));
+    
+        ip_type::add(f.lhs,f.rhs);
+        ip_type::sub(f.lhs,f.rhs_scalar);
+
+        for(size_t i=0;i<f.lhs.size();++i) 
+        {
+            if(boost::math::isfinite(f.lhs[i]))
+                BOOST_CHECK_EQUAL(f.lhs[i],
+                        value_type(value_type(f.lhs_orig[i]+f.rhs[i])-
+                                   f.rhs_scalar));
+        }
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE_TEMPLATE(add_test,AT,dyn_array_types)
+    {
+        typedef typename AT::value_type value_type;
+        parallel_fixture<AT> f((add_ranges<value_type>()));
+
+        ip_type::add(f.lhs,f.rhs);
+        for(size_t i=0;i<f.lhs.size();++i)
+            if(boost::math::isfinite(f.lhs[i]))
+                BOOST_REQUIRE_EQUAL(f.lhs[i],
+                                    value_type(f.lhs_orig[i]+f.rhs[i]));
+        
+        std::copy(f.lhs_orig.begin(),f.lhs_orig.end(),f.lhs.begin());
+        ip_type::add(f.lhs,f.rhs_scalar);
+        for(size_t i=0;i<f.lhs.size();++i)
+            if(boost::math::isfinite(f.lhs[i]))
+                BOOST_REQUIRE_EQUAL(f.lhs[i],
+                                    value_type(f.lhs_orig[i]+f.rhs_scalar));
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE_TEMPLATE(sub_test,AT,dyn_array_types)
+    {
+        typedef typename AT::value_type value_type;
+        parallel_fixture<AT> f((add_ranges<value_type>()));
+
+        ip_type::sub(f.lhs,f.rhs);
+        for(size_t i=0;i<f.lhs.size();++i)
+            if(boost::math::isfinite(f.lhs[i]))
+                BOOST_REQUIRE_EQUAL(f.lhs[i],
+                                    value_type(f.lhs_orig[i]-f.rhs[i]));
+        
+        std::copy(f.lhs_orig.begin(),f.lhs_orig.end(),f.lhs.begin());
+        ip_type::sub(f.lhs,f.rhs_scalar);
+        for(size_t i=0;i<f.lhs.size();++i)
+            if(boost::math::isfinite(f.lhs[i]))
+                BOOST_REQUIRE_EQUAL(f.lhs[i],
+                                    value_type(f.lhs_orig[i]-f.rhs_scalar));
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE_TEMPLATE(mult_test,AT,dyn_array_types)
+    {
+        typedef typename AT::value_type value_type;
+        parallel_fixture<AT> f((mult_ranges<value_type>()));
+
+        ip_type::mult(f.lhs,f.rhs);
+        for(size_t i=0;i<f.lhs.size();++i)
+            if(boost::math::isfinite(f.lhs[i]))
+                BOOST_REQUIRE_EQUAL(f.lhs[i],
+                                    value_type(f.lhs_orig[i]*f.rhs[i]));
+        
+        std::copy(f.lhs_orig.begin(),f.lhs_orig.end(),f.lhs.begin());
+        ip_type::mult(f.lhs,f.rhs_scalar);
+        for(size_t i=0;i<f.lhs.size();++i)
+            if(boost::math::isfinite(f.lhs[i]))
+                BOOST_REQUIRE_EQUAL(f.lhs[i],
+                                    value_type(f.lhs_orig[i]*f.rhs_scalar));
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE_TEMPLATE(div_test,AT,dyn_array_types)
+    {
+        typedef typename AT::value_type value_type;
+        parallel_fixture<AT> f((div_ranges<value_type>()));
+
+        ip_type::div(f.lhs,f.rhs);
+        for(size_t i=0;i<f.lhs.size();++i)
+            if(boost::math::isfinite(f.lhs[i]))
+                BOOST_REQUIRE_EQUAL(f.lhs[i],
+                                    value_type(f.lhs_orig[i]/f.rhs[i]));
+        
+        std::copy(f.lhs_orig.begin(),f.lhs_orig.end(),f.lhs.begin());
+        ip_type::div(f.lhs,f.rhs_scalar);
+        for(size_t i=0;i<f.lhs.size();++i)
+            if(boost::math::isfinite(f.lhs[i]))
+                BOOST_REQUIRE_EQUAL(f.lhs[i],
+                                    value_type(f.lhs_orig[i]/f.rhs_scalar));
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(view_test)
+    {
+        typedef dynamic_array<float64> array_type;
+        parallel_fixture<array_type> f((add_ranges<float64>()));
+        size_t nx = f.lhs.template shape<shape_t>()[1];
+
+        //every second element along the second dimension
+        auto v = f.lhs(slice(0,3),slice(0,nx,2));
+        ip_type::add(v,1.);
+
+        for(size_t i=0;i<3;++i)
+            for(size_t j=0;j<nx;++j)
+            {
+                if(j%2==0)
+                    BOOST_REQUIRE_EQUAL(f.lhs(i,j),f.lhs_orig(i,j)+1.);
+                else
+                    BOOST_REQUIRE_EQUAL(f.lhs(i,j),f.lhs_orig(i,j));
+            }
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(policy_test)
+    {
+        typedef mdarray<std::vector<float32>,dynamic_cindex_map,
+                        parallel_inplace_arithmetics> array_type;
+        thread_pool::instance().resize(4);
+
+        auto a = array_type::create(shape_t{1000,100});
+        auto b = array_type::create(shape_t{1000,100});
+        std::iota(a.begin(),a.end(),0.f);
+        std::fill(b.begin(),b.end(),2.f);
+
+        a *= b;
+        a += 1.f;
+        for(size_t i=0;i<a.size();++i)
+            BOOST_REQUIRE_EQUAL(a[i],float32(i)*2.f+1.f);
+
+        thread_pool::instance().resize(thread_pool::default_size());
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,369 @@
+//
+// (c) Copyright 2013 DESY, Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+// This file is part of libpnicore.
+//
+// libpnicore is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpnicore is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpnicore.  If not, see <http://www.gnu.org/licenses/>.
+//
+// ===========================================================================
+//
+//  Created on: Oct 16, 2026
+//      Author: Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+#ifdef __GNUG__
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+#endif
+#include <boost/test/unit_test.hpp>
+#ifdef __GNUG__
+#pragma GCC diagnostic pop
+#endif
+#include <boost/mpl/list.hpp>
+#include <pni/core/types.hpp>
+#include <pni/core/arrays.hpp>
+#include <pni/core/algorithms/reductions.hpp>
+#include "../data_generator.hpp"
+#include <vector>
+#include <numeric>
+#include <algorithm>
+
+using namespace pni::core;
+
+typedef boost::mpl::list<int8,int16,int32,int64,uint8,uint16,uint32,uint64,
+                         float32,float64,float128> real_types;
+
+typedef boost::mpl::list<float32,float64,complex32,complex64> large_types;
+
+//naive reduction of a C-ordered array along a set of axes
+template<
+         typename R,
+         typename ATYPE,
+         typename FUNC
+        >
+std::vector<R> reference(const ATYPE &a,const shape_t &axes,FUNC f)
+{
+    auto shape = a.template shape<shape_t>();
+    shape_t strides(shape.size(),0);
+    size_t n = 1;
+    for(size_t d=shape.size();d!=0;--d)
+    {
+        bool reduced = std::find(axes.begin(),axes.end(),d-1)!=axes.end();
+        if(!reduced) { strides[d-1] = n; n *= shape[d-1]; }
+    }
+
+    std::vector<R> result(n);
+    std::vector<bool> set(n,false);
+    for(size_t i=0;i<a.size();++i)
+    {
+        size_t offset = 0,index = i;
+        for(size_t d=shape.size();d!=0;--d)
+        {
+            offset += (index%shape[d-1])*strides[d-1];
+            index /= shape[d-1];
+        }
+        result[offset] = set[offset] ? f(result[offset],a[i]) : R(a[i]);
+        set[offset] = true;
+    }
+    return result;
+}
+
+template<typename T> struct reduction_fixture
+{
+    typedef dynamic_array<T> array_type;
+    random_generator<T> generator;
+    array_type a;
+
+    reduction_fixture(const shape_t &shape):
+        generator(T(0),T(10)),
+        a(array_type::create(shape))
+    {
+        std::generate(a.begin(),a.end(),generator);
+    }
+};
+
+std::vector<shape_t> axes_list{{},{0},{1},{2},{0,1},{0,2},{1,2},{0,1,2}};
+
+BOOST_AUTO_TEST_SUITE(reductions_test)
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE_TEMPLATE(test_sum_all,T,real_types)
+    {
+        reduction_fixture<T> f(shape_t{3,40,50});
+
+        //the reference is accumulated in float64 - a naive float32 loop 
+        //is less accurate than the pairwise sum under test
+        float64 ref = 0.;
+        for(auto v: f.a) ref += float64(v);
+        BOOST_CHECK_CLOSE(float64(sum(f.a)),ref,1.e-4);
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE_TEMPLATE(test_sum_axes,T,real_types)
+    {
+        reduction_fixture<T> f(shape_t{3,4,5});
+        auto add = [](float64 a,T b) { return a+float64(b); };
+
+        for(auto axes: axes_list)
+        {
+            auto result = sum(f.a,axes);
+            auto ref = reference<float64>(f.a,axes,add);
+            BOOST_CHECK_EQUAL(result.size(),ref.size());
+            for(size_t i=0;i<ref.size();++i)
+                BOOST_CHECK_CLOSE(float64(result[i]),ref[i],1.e-4);
+        }
+
+        auto result = sum(f.a,{1});
+        BOOST_CHECK(result.template shape<shape_t>()==shape_t({3,5}));
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE_TEMPLATE(test_min_max,T,real_types)
+    {
+        reduction_fixture<T> f(shape_t{3,4,5});
+        auto min_f = [](T a,T b) { return b<a ? b : a; };
+        auto max_f = [](T a,T b) { return b>a ? b : a; };
+
+        BOOST_CHECK_EQUAL(min(f.a),*std::min_element(f.a.begin(),f.a.end()));
+        BOOST_CHECK_EQUAL(max(f.a),*std::max_element(f.a.begin(),f.a.end()));
+
+        for(auto axes: axes_list)
+        {
+            auto min_result = min(f.a,axes);
+            auto max_result = max(f.a,axes);
+            auto min_ref = reference<T>(f.a,axes,min_f);
+            auto max_ref = reference<T>(f.a,axes,max_f);
+            BOOST_CHECK(std::equal(min_ref.begin(),min_ref.end(),
+                                   min_result.begin()));
+            BOOST_CHECK(std::equal(max_ref.begin(),max_ref.end(),
+                                   max_result.begin()));
+        }
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE_TEMPLATE(test_argmax,T,real_types)
+    {
+        reduction_fixture<T> f(shape_t{3,4,5});
+
+        size_t index = argmax(f.a);
+        BOOST_CHECK_EQUAL(index,size_t(std::max_element(f.a.begin(),f.a.end())
+                                       -f.a.begin()));
+
+        auto result = argmax(f.a,{1});
+        BOOST_CHECK(result.template shape<shape_t>()==shape_t({3,5}));
+        for(size_t i=0;i<3;++i)
+            for(size_t k=0;k<5;++k)
+            {
+                size_t max_j = 0;
+                for(size_t j=1;j<4;++j)
+                    if(f.a(i,j,k)>f.a(i,max_j,k)) max_j = j;
+                BOOST_CHECK_EQUAL(result(i,k),max_j);
+            }
+
+        result = argmax(f.a,{1,2});
+        for(size_t i=0;i<3;++i)
+        {
+            auto frame = f.a(i,slice(0,4),slice(0,5));
+            BOOST_CHECK_EQUAL(result[i],size_t(std::max_element(frame.begin(),
+                                              frame.end())-frame.begin()));
+        }
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_mean)
+    {
+        auto a = dynamic_array<int32>::create(shape_t{2,3});
+        std::iota(a.begin(),a.end(),1);
+
+        BOOST_CHECK_CLOSE(mean(a),3.5,1.e-8);
+        auto result = mean(a,{0});
+        BOOST_CHECK_CLOSE(result[0],2.5,1.e-8);
+        BOOST_CHECK_CLOSE(result[1],3.5,1.e-8);
+        BOOST_CHECK_CLOSE(result[2],4.5,1.e-8);
+
+        result = mean(a,{1});
+        BOOST_CHECK_CLOSE(result[0],2.,1.e-8);
+        BOOST_CHECK_CLOSE(result[1],5.,1.e-8);
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE_TEMPLATE(test_large,T,large_types)
+    {
+        //these shapes are large enough to split the work in several tasks
+        std::vector<shape_t> shapes{{4,400,400},{300000,3},{2,3,200000}};
+        for(auto shape: shapes)
+        {
+            auto a = dynamic_array<T>::create(shape);
+            std::fill(a.begin(),a.end(),T(0.1));
+
+            for(auto axes: axes_list)
+            {
+                if(axes.size() && axes.back()>=shape.size()) continue;
+
+                size_t count = 1;
+                for(auto axis: axes) count *= shape[axis];
+
+                auto result = sum(a,axes);
+                for(auto v: result)
+                    BOOST_CHECK_CLOSE(std::abs(v),0.1*count,1.e-3);
+            }
+
+            BOOST_CHECK_CLOSE(std::abs(sum(a)),0.1*a.size(),1.e-3);
+        }
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_pairwise)
+    {
+        //naive summation of 10^7 float32 values looses about 3 digits
+        auto a = dynamic_array<float32>::create(shape_t{10000000});
+        std::fill(a.begin(),a.end(),0.1f);
+        BOOST_CHECK_CLOSE(sum(a),1.e6f,1.e-3);
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_view)
+    {
+        reduction_fixture<float64> f(shape_t{6,20,30});
+        auto view = f.a(slice(1,5),slice(2,20,3),slice(0,30,2));
+        auto data = dynamic_array<float64>::create(view.template 
+                                                   shape<shape_t>());
+        std::copy(view.begin(),view.end(),data.begin());
+
+        BOOST_CHECK_CLOSE(sum(view),sum(data),1.e-10);
+        BOOST_CHECK_EQUAL(max(view),max(data));
+        for(auto axes: axes_list)
+        {
+            auto result = sum(view,axes);
+            auto ref = sum(data,axes);
+            for(size_t i=0;i<ref.size();++i)
+                BOOST_CHECK_CLOSE(result[i],ref[i],1.e-10);
+        }
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_expression)
+    {
+        reduction_fixture<float64> f(shape_t{3,4,5});
+        auto b = dynamic_array<float64>::create(shape_t{3,4,5});
+        std::fill(b.begin(),b.end(),1.);
+
+        BOOST_CHECK_CLOSE(sum(f.a+b),sum(f.a)+60.,1.e-10);
+
+        auto result = sum(f.a*b,{0,2});
+        auto ref = sum(f.a,{0,2});
+        BOOST_CHECK(result.template shape<shape_t>()==shape_t{4});
+        for(size_t i=0;i<4;++i) BOOST_CHECK_CLOSE(result[i],ref[i],1.e-10);
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_fmap)
+    {
+        typedef mdarray<std::vector<float64>,dynamic_fmap> farray_type;
+
+        //f(i,j) = 10*i+j
+        auto f = farray_type::create(shape_t{2,3});
+        for(size_t i=0;i<2;++i)
+            for(size_t j=0;j<3;++j) f(i,j) = 10.*i+j;
+
+        auto result = sum(f,{1});
+        BOOST_CHECK(result.template shape<shape_t>()==shape_t{2});
+        BOOST_CHECK_EQUAL(result(0),3.);
+        BOOST_CHECK_EQUAL(result(1),33.);
+
+        result = sum(f,{0});
+        BOOST_CHECK_EQUAL(result(0),10.);
+        BOOST_CHECK_EQUAL(result(1),12.);
+        BOOST_CHECK_EQUAL(result(2),14.);
+
+        //argmax returns C-order indices
+        BOOST_CHECK_EQUAL(argmax(f),5);
+        auto index = argmax(f,{1});
+        BOOST_CHECK_EQUAL(index(0),2);
+        BOOST_CHECK_EQUAL(index(1),2);
+
+        auto view = f(slice(0,2),slice(1,3));
+        result = sum(view,{0});
+        BOOST_CHECK_EQUAL(result(0),12.);
+        BOOST_CHECK_EQUAL(result(1),14.);
+        result = sum(view,{1});
+        BOOST_CHECK_EQUAL(result(0),3.);
+        BOOST_CHECK_EQUAL(result(1),23.);
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_fmap_axes)
+    {
+        typedef mdarray<std::vector<float64>,dynamic_fmap> farray_type;
+        reduction_fixture<float64> f(shape_t{3,4,5});
+
+        auto a = farray_type::create(shape_t{3,4,5});
+        shape_t index(3);
+        for(index[0]=0;index[0]<3;++index[0])
+            for(index[1]=0;index[1]<4;++index[1])
+                for(index[2]=0;index[2]<5;++index[2])
+                    a(index) = f.a(index);
+
+        BOOST_CHECK_EQUAL(argmax(a),argmax(f.a));
+        for(auto axes: axes_list)
+        {
+            auto result = sum(a,axes);
+            auto ref = sum(f.a,axes);
+            BOOST_CHECK(result.template shape<shape_t>()==
+                        ref.template shape<shape_t>());
+            for(size_t i=0;i<ref.size();++i)
+                BOOST_CHECK_CLOSE(result[i],ref[i],1.e-10);
+
+            auto max_result = max(a,axes);
+            auto max_ref = max(f.a,axes);
+            for(size_t i=0;i<max_ref.size();++i)
+                BOOST_CHECK_EQUAL(max_result[i],max_ref[i]);
+
+            auto arg_result = argmax(a,axes);
+            auto arg_ref = argmax(f.a,axes);
+            for(size_t i=0;i<arg_ref.size();++i)
+                BOOST_CHECK_EQUAL(arg_result[i],arg_ref[i]);
+        }
+
+        //expressions of Fortran arrays are reduced in storage order too
+        auto result = sum(a+a,{0,2});
+        auto ref = sum(f.a,{0,2});
+        for(size_t i=0;i<4;++i) BOOST_CHECK_CLOSE(result[i],2.*ref[i],1.e-10);
+
+        auto view = a(slice(1,3),slice(0,4,2),slice(0,5));
+        auto cview = f.a(slice(1,3),slice(0,4,2),slice(0,5));
+        for(auto axes: axes_list)
+        {
+            auto result = sum(view,axes);
+            auto ref = sum(cview,axes);
+            for(size_t i=0;i<ref.size();++i)
+                BOOST_CHECK_CLOSE(result[i],ref[i],1.e-10);
+        }
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_errors)
+    {
+        auto a = dynamic_array<float64>::create(shape_t{3,0});
+        BOOST_CHECK_THROW(min(a),size_mismatch_error);
+        BOOST_CHECK_THROW(argmax(a),size_mismatch_error);
+        BOOST_CHECK_EQUAL(sum(a),0.);
+        BOOST_CHECK_THROW(max(a,{1}),size_mismatch_error);
+        BOOST_CHECK_THROW(sum(a,{2}),index_error);
+
+        auto result = sum(a,{1});
+        BOOST_CHECK_EQUAL(result.size(),3);
+        for(auto v: result) BOOST_CHECK_EQUAL(v,0.);
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,303 @@
+//
+// (c) Copyright 2013 DESY, Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+// This file is part of libpnicore.
+//
+// libpnicore is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpnicore is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpnicore.  If not, see <http://www.gnu.org/licenses/>.
+//
+// ===========================================================================
+//
+//  Created on: Oct 16, 2026
+//      Author: Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+
+#ifdef __GNUG__
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+#endif
+#include <boost/test/unit_test.hpp>
+#ifdef __GNUG__
+#pragma GCC diagnostic pop
+#endif
+#include <boost/current_function.hpp>
+#include <pni/core/algorithms/math/simd_inplace_arithmetics.hpp>
+
+#include "array_types.hpp"
+#include <cmath>
+#include <numeric>
+#include "number_ranges.hpp"
+#include "fixture.hpp"
+
+
+namespace boost{
+namespace math{
+
+    //utility funtion template to check for the finiteness of a 
+    //comples value. This is only the case if real and imaginary part 
+    //are finite.
+    template<typename T> bool isfinite(std::complex<T> v)
+    {
+
+        return isfinite(v.real()) && isfinite(v.imag());
+    }
+}
+}
+
+typedef simd_inplace_arithmetics ip_type; 
+
+//
+// large array fixture - the arrays are long enough to run the full vector 
+// loops of all kernels and have an odd number of elements to run the 
+// scalar tail loops too.
+//
+template<typename AT> struct large_fixture
+{
+    typedef typename AT::value_type value_type;
+    typedef random_generator<value_type> generator_type;
+
+    AT lhs;
+    AT lhs_orig;
+    AT rhs;
+    value_type rhs_scalar;
+
+    template<typename RT> large_fixture(const RT &r):
+        lhs(AT::create(shape_t{7,151})),
+        lhs_orig(AT::create(shape_t{7,151})),
+        rhs(AT::create(shape_t{7,151})),
+        rhs_scalar()
+    {
+        generator_type gen_lhs(r.lhs_min(),r.lhs_max());
+        generator_type gen_rhs(r.rhs_min(),r.rhs_max());
+        std::generate(lhs.begin(),lhs.end(),gen_lhs);
+        std::generate(rhs.begin(),rhs.end(),gen_rhs);
+        std::copy(lhs.begin(),lhs.end(),lhs_orig.begin());
+        rhs_scalar = gen_rhs();
+    }
+};
+
+static const std::vector<simd_isa_t> isa_levels{simd_isa_t::NONE,
+                                                simd_isa_t::SSE2,
+                                                simd_isa_t::AVX2,
+                                                simd_isa_t::AVX512};
+
+BOOST_AUTO_TEST_SUITE(simd_inplace_arithmetics_test)
+
+    BOOST_AUTO_TEST_CASE(isa_level_test)
+    {
+        simd_isa_t detected = detect_simd_isa();
+        BOOST_CHECK(simd_isa() <= detected);
+
+        simd_isa(simd_isa_t::NONE);
+        BOOST_CHECK(simd_isa() == simd_isa_t::NONE);
+
+        simd_isa(simd_isa_t::AVX512);
+        BOOST_CHECK(simd_isa() == detected);
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE_TEMPLATE(add_scalar_test,AT,all_array_types)
+    {
+        typedef typename AT::value_type value_type;
+        fixture<AT> f((add_ranges<value_type>()));
+    
+        ip_type::add(f.lhs,f.rhs_scalar);
+
+        for(size_t i=0;i<f.lhs.size();++i) 
+        {
+            if(boost::math::isfinite(f.lhs[i]))
+                BOOST_CHECK_EQUAL(f.lhs[i],
+                                  value_type(f.lhs_orig[i]+f.rhs_scalar));
+        }
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE_TEMPLATE(add_array_test,AT,all_array_types)
+    {
+        typedef typename AT::value_type value_type;
+        fixture<AT> f((add_ranges<value_type>()));
+    
+        ip_type::add(f.lhs,f.rhs);
+
+        for(size_t i=0;i<f.lhs.size();++i) 
+        {
+            if(boost::math::isfinite(f.lhs[i]))
+                BOOST_CHECK_EQUAL(f.lhs[i],
+                                  value_type(f.lhs_orig[i]+f.rhs[i]));
+        }
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE_TEMPLATE(sub_scalar_test,AT,all_array_types)
+    {
+        typedef typename AT::value_type value_type;
+        fixture<AT> f((add_ranges<value_type>()));
+    
+        ip_type::sub(f.lhs,f.rhs_scalar);
+
+        for(size_t i=0;i<f.lhs.size();++i) 
+        {
+            if(boost::math::isfinite(f.lhs[i]))
+                BOOST_CHECK_EQUAL(f.lhs[i],
+                                  value_type(f.lhs_orig[i]-f.rhs_scalar));
+        }
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE_TEMPLATE(sub_array_test,AT,all_array_types)
+    {
+        typedef typename AT::value_type value_type;
+        fixture<AT> f((add_ranges<value_type>()));
+    
+        ip_type::sub(f.lhs,f.rhs);
+
+        for(size_t i=0;i<f.lhs.size();++i) 
+        {
+            if(boost::math::isfinite(f.lhs[i]))
+                BOOST_CHECK_EQUAL(f.lhs[i],
+                                  value_type(f.lhs_orig[i]-f.rhs[i]));
+        }
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE_TEMPLATE(mult_scalar_test,AT,all_array_types)
+    {
+        typedef typename AT::value_type value_type;
+        fixture<AT> f((mult_ranges<value_type>()));
+
+        ip_type::mult(f.lhs,f.rhs_scalar);
+        
+        for(size_t i=0;i<f.lhs.size();++i)
+        {
+            if(boost::math::isfinite(f.lhs[i]))
+                BOOST_CHECK_EQUAL(f.lhs[i],
+                                  value_type(f.lhs_orig[i]*f.rhs_scalar));
+        }
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE_TEMPLATE(mult_array_test,AT,all_array_types)
+    {
+        typedef typename AT::value_type value_type;
+        fixture<AT> f((mult_ranges<value_type>()));
+
+        ip_type::mult(f.lhs,f.rhs);
+
+        for(size_t i=0;i<f.lhs.size();++i)
+        {
+            if(boost::math::isfinite(f.lhs[i]))
+                BOOST_CHECK_EQUAL(f.lhs[i],
+                                  value_type(f.lhs_orig[i]*f.rhs[i]));
+        }
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE_TEMPLATE(div_scalar_test,AT,all_array_types)
+    {
+        typedef typename AT::value_type value_type;
+        fixture<AT> f((div_ranges<value_type>()));
+
+        ip_type::div(f.lhs,f.rhs_scalar);
+    
+        for(size_t i=0;i<f.lhs.size();++i)
+        {
+            if(boost::math::isfinite(f.lhs[i]))
+                BOOST_CHECK_EQUAL(f.lhs[i],
+                                  value_type(f.lhs_orig[i]/f.rhs_scalar));
+        }
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE_TEMPLATE(div_array_test,AT,all_array_types)
+    {
+        typedef typename AT::value_type value_type;
+        fixture<AT> f((div_ranges<value_type>()));
+
+        ip_type::div(f.lhs,f.rhs);
+
+        for(size_t i=0;i<f.lhs.size();++i)
+        {
+            if(boost::math::isfinite(f.lhs[i]))
+                BOOST_CHECK_EQUAL(f.lhs[i],
+                                  value_type(f.lhs_orig[i]/f.rhs[i]));
+        }
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE_TEMPLATE(isa_levels_test,AT,dyn_array_types)
+    {
+        typedef typename AT::value_type value_type;
+
+        for(auto isa: isa_levels)
+        {
+            simd_isa(isa);
+
+            large_fixture<AT> fa((add_ranges<value_type>()));
+            ip_type::add(fa.lhs,fa.rhs);
+            for(size_t i=0;i<fa.lhs.size();++i)
+                if(boost::math::isfinite(fa.lhs[i]))
+                    BOOST_CHECK_EQUAL(fa.lhs[i],
+                                      value_type(fa.lhs_orig[i]+fa.rhs[i]));
+
+            large_fixture<AT> fs((add_ranges<value_type>()));
+            ip_type::sub(fs.lhs,fs.rhs_scalar);
+            for(size_t i=0;i<fs.lhs.size();++i)
+                if(boost::math::isfinite(fs.lhs[i]))
+                    BOOST_CHECK_EQUAL(fs.lhs[i],
+                                      value_type(fs.lhs_orig[i]-fs.rhs_scalar));
+
+            large_fixture<AT> fm((mult_ranges<value_type>()));
+            ip_type::mult(fm.lhs,fm.rhs);
+            for(size_t i=0;i<fm.lhs.size();++i)
+                if(boost::math::isfinite(fm.lhs[i]))
+                    BOOST_CHECK_EQUAL(fm.lhs[i],
+                                      value_type(fm.lhs_orig[i]*fm.rhs[i]));
+
+            large_fixture<AT> fd((div_ranges<value_type>()));
+            ip_type::div(fd.lhs,fd.rhs_scalar);
+            for(size_t i=0;i<fd.lhs.size();++i)
+                if(boost::math::isfinite(fd.lhs[i]))
+                    BOOST_CHECK_EQUAL(fd.lhs[i],
+                                      value_type(fd.lhs_orig[i]/fd.rhs_scalar));
+        }
+
+        simd_isa(detect_simd_isa());
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(strided_view_test)
+    {
+        typedef dynamic_array<float64> array_type;
+        auto a = array_type::create(shape_t{4,6});
+        std::iota(a.begin(),a.end(),0.);
+
+        //every second column - no contiguous storage
+        auto v = a(slice(0,4),slice(0,6,2));
+        auto b = array_type::create(shape_t{4,3});
+        std::fill(b.begin(),b.end(),1.);
+
+        ip_type::add(v,b);
+        ip_type::mult(v,2.);
+
+        for(size_t i=0;i<4;++i)
+            for(size_t j=0;j<6;++j)
+            {
+                float64 orig = float64(i*6+j);
+                if(j%2==0)
+                    BOOST_CHECK_EQUAL(a(i,j),2.*(orig+1.));
+                else
+                    BOOST_CHECK_EQUAL(a(i,j),orig);
+            }
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
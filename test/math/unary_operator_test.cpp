@@ -0,0 +1,195 @@
+//
+// (c) Copyright 2026 DESY, Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+// This file is part of libpnicore.
+//
+// libpnicore is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpnicore is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpnicore.  If not, see <http://www.gnu.org/licenses/>.
+//
+// ===========================================================================
+//
+//  Created on: Oct 16, 2026
+//      Author: Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+#ifdef __GNUG__
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+#endif
+#include <boost/test/unit_test.hpp>
+#ifdef __GNUG__
+#pragma GCC diagnostic pop
+#endif
+#include <boost/mpl/list.hpp>
+#include <pni/core/types.hpp>
+#include <pni/core/arrays.hpp>
+#include <numeric>
+#include <cmath>
+
+using namespace pni::core;
+
+typedef boost::mpl::list<float32,float64,float128> float_types_list;
+typedef boost::mpl::list<complex32,complex64,complex128> complex_types_list;
+
+BOOST_AUTO_TEST_SUITE(unary_operator_test)
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_result_types)
+    {
+        typedef dynamic_array<int32> int_array;
+        typedef dynamic_array<float32> float_array;
+        typedef dynamic_array<complex64> complex_array;
+
+        BOOST_CHECK((std::is_same<sqrt_op<int_array>::value_type,
+                                  float64>::value));
+        BOOST_CHECK((std::is_same<sqrt_op<float_array>::value_type,
+                                  float32>::value));
+        BOOST_CHECK((std::is_same<abs_op<int_array>::value_type,
+                                  int32>::value));
+        BOOST_CHECK((std::is_same<abs_op<complex_array>::value_type,
+                                  float64>::value));
+        BOOST_CHECK((std::is_same<real_op<complex_array>::value_type,
+                                  float64>::value));
+        BOOST_CHECK((std::is_same<conj_op<complex_array>::value_type,
+                                  complex64>::value));
+        BOOST_CHECK((std::is_same<pow_op<int_array>::value_type,
+                                  float64>::value));
+        BOOST_CHECK((std::is_same<clamp_op<int_array>::value_type,
+                                  int32>::value));
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE_TEMPLATE(test_float_functions,T,float_types_list)
+    {
+        auto a = dynamic_array<T>::create(shape_t{3,4});
+        auto b = dynamic_array<T>::create(shape_t{3,4});
+        std::iota(a.begin(),a.end(),T(1));
+        std::fill(b.begin(),b.end(),T(2));
+        auto c = dynamic_array<T>::create(shape_t{3,4});
+
+        c = sqrt(a*a+b*b);
+        for(size_t i=0;i<c.size();++i)
+            BOOST_CHECK_CLOSE(c[i],std::sqrt(a[i]*a[i]+b[i]*b[i]),1.e-4);
+
+        c = log(exp(a)/b);
+        for(size_t i=0;i<c.size();++i)
+            BOOST_CHECK_CLOSE(c[i],std::log(std::exp(a[i])/b[i]),1.e-4);
+
+        c = pow(a,2.5)-b;
+        for(size_t i=0;i<c.size();++i)
+            BOOST_CHECK_CLOSE(c[i],T(std::pow(a[i],T(2.5))-b[i]),1.e-4);
+
+        c = abs(b-a);
+        for(size_t i=0;i<c.size();++i)
+            BOOST_CHECK_CLOSE(c[i],std::abs(b[i]-a[i]),1.e-4);
+
+        c = clamp(a,T(3),T(7));
+        for(size_t i=0;i<c.size();++i)
+            BOOST_CHECK_EQUAL(c[i],std::min(std::max(a[i],T(3)),T(7)));
+
+        c = norm(a)+real(b)+imag(a);
+        for(size_t i=0;i<c.size();++i)
+            BOOST_CHECK_CLOSE(c[i],a[i]*a[i]+b[i],1.e-4);
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE_TEMPLATE(test_complex_functions,T,complex_types_list)
+    {
+        typedef typename T::value_type base_type;
+        auto a = dynamic_array<T>::create(shape_t{10});
+        for(size_t i=0;i<a.size();++i) a[i] = T(base_type(i),base_type(-2));
+        auto r = dynamic_array<base_type>::create(shape_t{10});
+        auto c = dynamic_array<T>::create(shape_t{10});
+
+        r = abs(a);
+        for(size_t i=0;i<r.size();++i)
+            BOOST_CHECK_CLOSE(r[i],std::abs(a[i]),1.e-4);
+
+        r = norm(a);
+        for(size_t i=0;i<r.size();++i)
+            BOOST_CHECK_CLOSE(r[i],std::norm(a[i]),1.e-4);
+
+        r = real(a)-imag(a);
+        for(size_t i=0;i<r.size();++i)
+            BOOST_CHECK_CLOSE(r[i],base_type(i)+base_type(2),1.e-4);
+
+        c = a*conj(a);
+        for(size_t i=0;i<c.size();++i)
+        {
+            BOOST_CHECK_CLOSE(c[i].real(),std::norm(a[i]),1.e-4);
+            BOOST_CHECK_SMALL(c[i].imag(),base_type(1.e-4));
+        }
+
+        c = sqrt(a);
+        for(size_t i=0;i<c.size();++i)
+            BOOST_CHECK_CLOSE(c[i].real(),std::sqrt(a[i]).real(),1.e-4);
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_integer_functions)
+    {
+        auto a = dynamic_array<int16>::create(shape_t{2,5});
+        std::iota(a.begin(),a.end(),int16(-5));
+
+        auto i = dynamic_array<int16>::create(shape_t{2,5});
+        i = abs(a);
+        for(size_t n=0;n<i.size();++n) BOOST_CHECK_EQUAL(i[n],std::abs(a[n]));
+
+        i = clamp(a,-2,2);
+        for(size_t n=0;n<i.size();++n)
+            BOOST_CHECK_EQUAL(i[n],std::min(std::max(a[n],int16(-2)),
+                                            int16(2)));
+
+        //transcendental functions promote integers to float64
+        auto f = dynamic_array<float64>::create(shape_t{2,5});
+        f = sqrt(abs(a))+pow(a,2);
+        for(size_t n=0;n<f.size();++n)
+            BOOST_CHECK_CLOSE(f[n],std::sqrt(float64(std::abs(a[n])))+
+                                   float64(a[n])*float64(a[n]),1.e-8);
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_views)
+    {
+        auto a = dynamic_array<float64>::create(shape_t{3,4});
+        std::iota(a.begin(),a.end(),0.);
+
+        auto view = a(1,slice(0,4));
+        auto c = dynamic_array<float64>::create(shape_t{4});
+        c = sqrt(view)*2.;
+        for(size_t i=0;i<c.size();++i)
+            BOOST_CHECK_CLOSE(c[i],2.*std::sqrt(float64(i+4)),1.e-8);
+
+        dynamic_array<float64> d(exp(view));
+        for(size_t i=0;i<d.size();++i)
+            BOOST_CHECK_CLOSE(d[i],std::exp(float64(i+4)),1.e-8);
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_large)
+    {
+        typedef mdarray<std::vector<float64>,dynamic_cindex_map,
+                        parallel_inplace_arithmetics> array_type;
+        shape_t shape{3,300,400};
+
+        auto a = array_type::create(shape);
+        auto b = array_type::create(shape);
+        std::iota(a.begin(),a.end(),0.);
+        std::fill(b.begin(),b.end(),3.);
+
+        auto c = array_type::create(shape);
+        c = sqrt(a*a+b*b);
+        for(size_t i=0;i<c.size();++i)
+            BOOST_CHECK_CLOSE(c[i],std::sqrt(float64(i)*float64(i)+9.),1.e-8);
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,132 @@
+//
+// (c) Copyright 2026 DESY, Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+// This file is part of libpnicore.
+//
+// libpnicore is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpnicore is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpnicore.  If not, see <http://www.gnu.org/licenses/>.
+//
+// ===========================================================================
+//
+//  Created on: Oct 16, 2026
+//      Author: Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+#ifdef __GNUG__
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+#endif
+#include <boost/test/unit_test.hpp>
+#ifdef __GNUG__
+#pragma GCC diagnostic pop
+#endif
+#include <vector>
+#include <pni/core/type_erasures.hpp>
+
+#include "array_types.hpp"
+#include "fixture.hpp"
+
+using namespace pni::core;
+
+BOOST_AUTO_TEST_SUITE(array_copy_test)
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE_TEMPLATE(test_copy_to,AT,all_array_types)
+    {
+        typedef typename md_array_trait<AT>::value_type value_type;
+        fixture<AT> f;
+
+        const array a(f.mdarray_1);
+        std::vector<value_type> buffer(a.size());
+
+        a.copy_to(buffer.data(),buffer.size());
+        for(size_t i=0;i<a.size();++i)
+            BOOST_CHECK_EQUAL(buffer[i],f.mdarray_1[i]);
+
+        std::vector<value_type> range(2);
+        a.copy_to(3,range.data(),range.size());
+        BOOST_CHECK_EQUAL(range[0],f.mdarray_1[3]);
+        BOOST_CHECK_EQUAL(range[1],f.mdarray_1[4]);
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE_TEMPLATE(test_copy_from,AT,all_array_types)
+    {
+        typedef typename md_array_trait<AT>::value_type value_type;
+        fixture<AT> f;
+
+        array a(f.mdarray_1);
+        std::vector<value_type> buffer(f.mdarray_2.begin(),
+                                       f.mdarray_2.end());
+
+        a.copy_from(buffer.data(),buffer.size());
+        for(size_t i=0;i<a.size();++i)
+            BOOST_CHECK_EQUAL(a[i].as<value_type>(),f.mdarray_2[i]);
+
+        a.copy_from(4,f.mdarray_1.data(),2);
+        BOOST_CHECK_EQUAL(a[3].as<value_type>(),f.mdarray_2[3]);
+        BOOST_CHECK_EQUAL(a[4].as<value_type>(),f.mdarray_1[0]);
+        BOOST_CHECK_EQUAL(a[5].as<value_type>(),f.mdarray_1[1]);
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_conversion)
+    {
+        auto frame = dynamic_array<uint16>::create(shape_t{64,64});
+        for(size_t i=0;i<frame.size();++i) frame[i] = uint16(i);
+        array a(frame);
+
+        std::vector<float32> fbuffer(a.size());
+        a.copy_to(fbuffer.data(),fbuffer.size());
+        for(size_t i=0;i<a.size();++i)
+            BOOST_CHECK_EQUAL(fbuffer[i],float32(i));
+
+        std::vector<int64> ibuffer(a.size(),17);
+        a.copy_from(ibuffer.data(),ibuffer.size());
+        for(size_t i=0;i<a.size();++i)
+            BOOST_CHECK_EQUAL(a[i].as<uint16>(),17);
+
+        std::vector<complex64> cbuffer(a.size());
+        a.copy_to(cbuffer.data(),cbuffer.size());
+        BOOST_CHECK_EQUAL(cbuffer[0],complex64(17,0));
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_errors)
+    {
+        auto data = dynamic_array<int32>::create(shape_t{3,2});
+        std::fill(data.begin(),data.end(),1);
+        data[2] = -1;
+        array a(data);
+
+        //the range must be within the array
+        std::vector<int32> buffer(7);
+        BOOST_CHECK_THROW(a.copy_to(buffer.data(),7),index_error);
+        BOOST_CHECK_THROW(a.copy_to(5,buffer.data(),2),index_error);
+        BOOST_CHECK_THROW(a.copy_from(7,buffer.data(),0),index_error);
+        BOOST_CHECK_NO_THROW(a.copy_to(6,buffer.data(),0));
+
+        //negative values do not fit in an unsigned type
+        std::vector<uint8> ubuffer(6);
+        BOOST_CHECK_NO_THROW(a.copy_to(ubuffer.data(),2));
+        BOOST_CHECK_THROW(a.copy_to(ubuffer.data(),3),range_error);
+
+        //no conversion from string
+        std::vector<string> sbuffer(6);
+        BOOST_CHECK_THROW(a.copy_from(sbuffer.data(),6),type_error);
+
+        array empty;
+        BOOST_CHECK_THROW(empty.copy_to(buffer.data(),1),
+                          memory_not_allocated_error);
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
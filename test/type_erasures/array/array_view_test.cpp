@@ -0,0 +1,182 @@
+//
+// (c) Copyright 2026 DESY, Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+// This file is part of libpnicore.
+//
+// libpnicore is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpnicore is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpnicore.  If not, see <http://www.gnu.org/licenses/>.
+//
+// ===========================================================================
+//
+//  Created on: Oct 16, 2026
+//      Author: Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+#ifdef __GNUG__
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+#endif
+#include <boost/test/unit_test.hpp>
+#ifdef __GNUG__
+#pragma GCC diagnostic pop
+#endif
+#include <vector>
+#include <numeric>
+#include <pni/core/type_erasures.hpp>
+
+#include "array_types.hpp"
+#include "fixture.hpp"
+
+using namespace pni::core;
+
+BOOST_AUTO_TEST_SUITE(array_view_test)
+
+    //------------------------------------------------------------------------
+    //! sums up int32 arrays
+    struct sum_visitor
+    {
+        int64 operator()(const external_array<int32> &a) const
+        {
+            return std::accumulate(a.begin(),a.end(),int64(0));
+        }
+
+        template<typename T> int64 operator()(const external_array<T> &) const
+        {
+            throw type_error(EXCEPTION_RECORD,"Cannot sum this type!");
+        }
+    };
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE_TEMPLATE(test_contiguous_view,AT,all_array_types)
+    {
+        typedef typename md_array_trait<AT>::value_type value_type;
+        fixture<AT> f;
+        array a(f.mdarray_1);
+
+        array v = a(array::view_index{slice(1,3),slice(0,2)});
+        BOOST_CHECK(v.type_id()==a.type_id());
+        BOOST_CHECK_EQUAL(v.rank(),2);
+        BOOST_CHECK_EQUAL(v.size(),4);
+        BOOST_CHECK(v.shape()==(shape_t{2,2}));
+
+        std::vector<value_type> buffer(v.size());
+        v.copy_to(buffer.data(),buffer.size());
+        for(size_t i=0;i<v.size();++i)
+        {
+            BOOST_CHECK_EQUAL(buffer[i],f.mdarray_1[i+2]);
+            BOOST_CHECK_EQUAL(v[i].as<value_type>(),f.mdarray_1[i+2]);
+        }
+        BOOST_CHECK(static_cast<value_type*>(v.data())==
+                    static_cast<value_type*>(a.data())+2);
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE_TEMPLATE(test_strided_view,AT,all_array_types)
+    {
+        typedef typename md_array_trait<AT>::value_type value_type;
+        fixture<AT> f;
+        array a(f.mdarray_1);
+
+        array v = a(array::view_index{slice(0,3),slice(1,2)});
+        BOOST_CHECK_EQUAL(v.size(),3);
+        BOOST_CHECK_THROW(v.data(),shape_mismatch_error);
+
+        //bulk copy of a part of the view
+        std::vector<value_type> buffer(2);
+        v.copy_to(1,buffer.data(),buffer.size());
+        BOOST_CHECK_EQUAL(buffer[0],f.mdarray_1[3]);
+        BOOST_CHECK_EQUAL(buffer[1],f.mdarray_1[5]);
+
+        //iteration
+        size_t index = 1;
+        for(auto element: v)
+        {
+            BOOST_CHECK_EQUAL(element.as<value_type>(),f.mdarray_1[index]);
+            index += 2;
+        }
+
+        //the view shares the data with the array
+        v.copy_from(f.mdarray_2.data(),3);
+        for(size_t i=0;i<a.size();++i)
+            BOOST_CHECK_EQUAL(a[i].as<value_type>(),
+                              i%2 ? f.mdarray_2[i/2] : f.mdarray_1[i]);
+
+        //copies of the view refer to the same data
+        array c(v);
+        c[0] = v[2].as<value_type>();
+        BOOST_CHECK_EQUAL(a[1].as<value_type>(),f.mdarray_2[2]);
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_hyperslab)
+    {
+        auto stack = dynamic_array<uint16>::create(shape_t{4,20,30});
+        for(size_t i=0;i<stack.size();++i) stack[i] = uint16(i);
+        array a(std::move(stack));
+
+        array roi = a(array::view_index{slice(1,3),slice(5,15,2),
+                                        slice(10,20)});
+        BOOST_CHECK(roi.shape()==(shape_t{2,5,10}));
+
+        std::vector<float32> buffer(roi.size());
+        roi.copy_to(buffer.data(),buffer.size());
+
+        size_t i = 0;
+        for(size_t n=1;n<3;++n)
+            for(size_t y=5;y<15;y+=2)
+                for(size_t x=10;x<20;++x)
+                    BOOST_CHECK_EQUAL(buffer[i++],float32(n*600+y*30+x));
+
+        //a single frame is contiguous
+        array frame = a(array::view_index{slice(2),slice(0,20),
+                                          slice(0,30)});
+        BOOST_CHECK_EQUAL(static_cast<const uint16*>(frame.data())[0],
+                          1200);
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_visit)
+    {
+        auto data = dynamic_array<int32>::create(shape_t{3,4});
+        std::iota(data.begin(),data.end(),0);
+        array a(std::move(data));
+
+        sum_visitor visitor;
+
+        //contiguous views are visited in place
+        array rows = a(array::view_index{slice(1,3),slice(0,4)});
+        BOOST_CHECK_EQUAL(visit(rows,visitor),4+5+6+7+8+9+10+11);
+
+        array columns = a(array::view_index{slice(0,3),slice(1,3)});
+        BOOST_CHECK_THROW(visit(columns,visitor),type_error);
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_errors)
+    {
+        array a(dynamic_array<int32>::create(shape_t{3,4}));
+
+        BOOST_CHECK_THROW(a(array::view_index{slice(0,3)}),
+                          shape_mismatch_error);
+        BOOST_CHECK_THROW(a(array::view_index{slice(0,4),slice(0,4)}),
+                          index_error);
+
+        array v = a(array::view_index{slice(0,2),slice(0,4)});
+        BOOST_CHECK_THROW(v(array::view_index{slice(0,1),slice(0,1)}),
+                          not_implemented_error);
+
+        array empty;
+        BOOST_CHECK_THROW(empty(array::view_index{slice(0,1)}),
+                          memory_not_allocated_error);
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
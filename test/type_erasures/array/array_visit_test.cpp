@@ -0,0 +1,119 @@
+//
+// (c) Copyright 2026 DESY, Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+// This file is part of libpnicore.
+//
+// libpnicore is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpnicore is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpnicore.  If not, see <http://www.gnu.org/licenses/>.
+//
+// ===========================================================================
+//
+//  Created on: Oct 16, 2026
+//      Author: Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+#ifdef __GNUG__
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+#endif
+#include <boost/test/unit_test.hpp>
+#ifdef __GNUG__
+#pragma GCC diagnostic pop
+#endif
+#include <numeric>
+#include <pni/core/type_erasures.hpp>
+
+#include "array_types.hpp"
+#include "fixture.hpp"
+
+using namespace pni::core;
+
+BOOST_AUTO_TEST_SUITE(array_visit_test)
+
+    //------------------------------------------------------------------------
+    //! copies the second element to the first and returns the type ID
+    struct copy_visitor
+    {
+        shape_t shape;
+
+        template<typename T> type_id_t operator()(external_array<T> &a)
+        {
+            shape = a.template shape<shape_t>();
+            a[0] = a[1];
+            return type_id_map<T>::type_id;
+        }
+    };
+
+    //------------------------------------------------------------------------
+    //! sums up integer arrays
+    struct sum_visitor
+    {
+        template<typename T>
+        typename std::enable_if<std::is_integral<T>::value,int64>::type
+        operator()(const external_array<T> &a) const
+        {
+            return std::accumulate(a.begin(),a.end(),int64(0));
+        }
+
+        template<typename T>
+        typename std::enable_if<!std::is_integral<T>::value,int64>::type
+        operator()(const external_array<T> &) const
+        {
+            throw type_error(EXCEPTION_RECORD,"Cannot sum this type!");
+        }
+    };
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE_TEMPLATE(test_visit,AT,all_array_types)
+    {
+        typedef typename md_array_trait<AT>::value_type value_type;
+        fixture<AT> f;
+        array a(f.mdarray_1);
+
+        copy_visitor visitor;
+        BOOST_CHECK(visit(a,visitor)==type_id_map<value_type>::type_id);
+        BOOST_CHECK_EQUAL_COLLECTIONS(visitor.shape.begin(),
+                                      visitor.shape.end(),
+                                      f.shape.begin(),f.shape.end());
+
+        //the visitor works on the data of the type erasure
+        BOOST_CHECK_EQUAL(a[0].as<value_type>(),f.mdarray_1[1]);
+        for(size_t i=1;i<a.size();++i)
+            BOOST_CHECK_EQUAL(a[i].as<value_type>(),f.mdarray_1[i]);
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_visit_result)
+    {
+        auto data = dynamic_array<uint16>::create(shape_t{10,20});
+        std::iota(data.begin(),data.end(),0);
+        array a(data);
+        BOOST_CHECK_EQUAL(visit(a,sum_visitor()),199*200/2);
+
+        array b(dynamic_array<float32>::create(shape_t{3}));
+        BOOST_CHECK_THROW(visit(b,sum_visitor()),type_error);
+
+        array empty;
+        BOOST_CHECK_THROW(visit(empty,sum_visitor()),
+                          memory_not_allocated_error);
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_visit_fmap)
+    {
+        //external_array is C-ordered and would read the wrong elements
+        typedef mdarray<std::vector<uint16>,dynamic_fmap> farray_type;
+        array a(farray_type::create(shape_t{3,4}));
+        BOOST_CHECK_THROW(visit(a,sum_visitor()),type_error);
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,124 @@
+//
+// (c) Copyright 2026 DESY, Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+// This file is part of libpnicore.
+//
+// libpnicore is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpnicore is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpnicore.  If not, see <http://www.gnu.org/licenses/>.
+//
+// ===========================================================================
+//
+//  Created on: Oct 16, 2026
+//      Author: Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+#ifdef __GNUG__
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+#endif
+#include <boost/test/unit_test.hpp>
+#ifdef __GNUG__
+#pragma GCC diagnostic pop
+#endif
+#include <vector>
+#include <pni/core/type_erasures.hpp>
+
+#include "types.hpp"
+#include "fixture.hpp"
+
+using namespace pni::core;
+
+BOOST_AUTO_TEST_SUITE(value_storage_test)
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_local_holders)
+    {
+        BOOST_CHECK(is_local_holder<uint8>::value);
+        BOOST_CHECK(is_local_holder<bool_t>::value);
+        BOOST_CHECK(is_local_holder<float128>::value);
+        BOOST_CHECK(is_local_holder<complex128>::value);
+        BOOST_CHECK(is_local_holder<none>::value);
+        BOOST_CHECK(is_local_holder<std::reference_wrapper<complex128>>::value);
+        BOOST_CHECK(is_local_holder<std::reference_wrapper<string>>::value);
+        BOOST_CHECK(!is_local_holder<string>::value);
+        BOOST_CHECK(!is_local_holder<binary>::value);
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE_TEMPLATE(test_storage,T,all_types)
+    {
+        fixture<T> f;
+        value_storage s1;
+        BOOST_CHECK(!s1);
+        BOOST_CHECK(s1.get()==nullptr);
+
+        value_storage s2(value_holder<T>(f.value_1));
+        BOOST_CHECK(s2);
+        BOOST_CHECK(s2->type_id()==type_id_map<T>::type_id);
+
+        //local holders live inside the storage
+        const char *begin = reinterpret_cast<const char*>(&s2);
+        const char *ptr = reinterpret_cast<const char*>(s2.get());
+        bool local = is_local_holder<T>::value;
+        BOOST_CHECK_EQUAL(ptr>=begin && ptr<begin+sizeof(s2),local);
+
+        s1 = s2;
+        BOOST_CHECK(s1.get()!=s2.get());
+        BOOST_CHECK_EQUAL(get_holder_ptr<T>(s1)->as(),f.value_1);
+
+        value_storage s3(std::move(s1));
+        BOOST_CHECK(!s1);
+        BOOST_CHECK_EQUAL(get_holder_ptr<T>(s3)->as(),f.value_1);
+
+        s2.reset();
+        BOOST_CHECK(!s2);
+        s2 = std::move(s3);
+        BOOST_CHECK(!s3);
+        BOOST_CHECK_EQUAL(get_holder_ptr<T>(s2)->as(),f.value_1);
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE_TEMPLATE(test_value_vector,T,all_types)
+    {
+        fixture<T> f;
+        std::vector<value> record;
+        for(size_t i=0;i<100;++i)
+            record.push_back(value(i%2 ? f.value_1 : f.value_2));
+
+        for(size_t i=0;i<record.size();++i)
+            BOOST_CHECK_EQUAL(record[i].template as<T>(),
+                              i%2 ? f.value_1 : f.value_2);
+
+        std::vector<value> copy(record);
+        record.clear();
+        BOOST_CHECK_EQUAL(copy[99].template as<T>(),f.value_1);
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_value_ref)
+    {
+        complex128 data(1,2);
+        value_ref r1(std::ref(data));
+        value_ref r2(r1);
+        value_ref r3;
+        r3 = r2;
+
+        r3 = complex128(3,4);
+        BOOST_CHECK_EQUAL(r1.as<complex128>(),complex128(3,4));
+        BOOST_CHECK_EQUAL(data,complex128(3,4));
+
+        value v = r2;
+        BOOST_CHECK(v.type_id()==type_id_t::COMPLEX128);
+        BOOST_CHECK_EQUAL(v.as<complex128>(),complex128(3,4));
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,92 @@
+//
+// (c) Copyright 2026 DESY, Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+// This file is part of libpnicore.
+//
+// libpnicore is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpnicore is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpnicore.  If not, see <http://www.gnu.org/licenses/>.
+//
+// ===========================================================================
+//
+//  Created on: Oct 16, 2026
+//      Author: Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+#ifdef __GNUG__
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+#endif
+#include <boost/test/unit_test.hpp>
+#ifdef __GNUG__
+#pragma GCC diagnostic pop
+#endif
+#include <sstream>
+#include <pni/core/type_erasures.hpp>
+
+#include "types.hpp"
+#include "fixture.hpp"
+
+using namespace pni::core;
+
+BOOST_AUTO_TEST_SUITE(value_visit_test)
+
+    //------------------------------------------------------------------------
+    //! returns the type ID and replaces values of type S
+    template<typename S> struct assign_visitor
+    {
+        S new_value;
+
+        type_id_t operator()(S &v) const
+        {
+            v = new_value;
+            return type_id_map<S>::type_id;
+        }
+
+        template<typename T> type_id_t operator()(T &) const
+        {
+            return type_id_map<T>::type_id;
+        }
+    };
+
+    //------------------------------------------------------------------------
+    //! writes the value to a stream
+    struct print_visitor
+    {
+        std::ostream &stream;
+
+        template<typename T> void operator()(const T &v) const { stream<<v; }
+    };
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE_TEMPLATE(test_visit,T,all_types)
+    {
+        fixture<T> f;
+        value v(f.value_1);
+
+        BOOST_CHECK(visit(v,assign_visitor<T>{f.value_2})==
+                    type_id_map<T>::type_id);
+        BOOST_CHECK_EQUAL(v.as<T>(),f.value_2);
+
+        std::stringstream ss,ref;
+        visit(v,print_visitor{ss});
+        ref<<f.value_2;
+        BOOST_CHECK_EQUAL(ss.str(),ref.str());
+    }
+
+    //========================================================================
+    BOOST_AUTO_TEST_CASE(test_visit_none)
+    {
+        value v;
+        BOOST_CHECK(visit(v,assign_visitor<uint8>{1})==type_id_t::NONE);
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -80,9 +80,16 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(test_create_from_size,CT,test_types)
     for(auto c: c2)
         BOOST_CHECK_EQUAL(c,random_value);
 
+    //without initialization - std::array is value initialized anyhow
+    auto c3 = utils_type::create(4,no_init);
+    BOOST_CHECK_EQUAL(c3.size(),4u);
+    for(auto c: c3)
+        BOOST_CHECK_EQUAL(c,typename CT::value_type());
+
     //check exception
     BOOST_CHECK_THROW(utils_type::create(5),size_mismatch_error);
     BOOST_CHECK_THROW(utils_type::create(3),size_mismatch_error);
+    BOOST_CHECK_THROW(utils_type::create(5,no_init),size_mismatch_error);
 }
 
 
@@ -91,6 +91,10 @@ BOOST_AUTO_TEST_SUITE(container_utils_std_test)
         auto init_value = generator_type()();
         auto c2 = utils_type::create(100,init_value);
         for(auto c: c2) BOOST_CHECK_EQUAL(c,init_value);
+
+        //without initialization
+        auto c3 = utils_type::create(100,no_init);
+        BOOST_CHECK_EQUAL(c3.size(),100u);
     }
     
     //========================================================================
@@ -0,0 +1,134 @@
+//
+// (c) Copyright 2013 DESY, Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+// This file is part of libpnicore.
+//
+// libpnicore is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// libpnicore is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libpnicore.  If not, see <http://www.gnu.org/licenses/>.
+//
+// ===========================================================================
+//
+//  Created on: Oct 16, 2026
+//      Author: Eugen Wintersberger <eugen.wintersberger@desy.de>
+//
+#ifdef __GNUG__
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+#endif 
+#include <boost/test/unit_test.hpp>
+#ifdef __GNUG__
+#pragma GCC diagnostic pop
+#endif
+#include <boost/current_function.hpp>
+#include <pni/core/utilities/thread_pool.hpp>
+#include <pni/core/error.hpp>
+#include <atomic>
+#include <vector>
+#include <thread>
+
+using namespace pni::core;
+
+BOOST_AUTO_TEST_SUITE(thread_pool_test)
+
+//-----------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(test_construction)
+{
+    thread_pool p1(1);
+    BOOST_CHECK_EQUAL(p1.size(),1u);
+
+    thread_pool p4(4);
+    BOOST_CHECK_EQUAL(p4.size(),4u);
+
+    thread_pool p0(0);
+    BOOST_CHECK_EQUAL(p0.size(),1u);
+
+    p0.resize(3);
+    BOOST_CHECK_EQUAL(p0.size(),3u);
+
+    BOOST_CHECK(thread_pool::default_size()>0);
+}
+
+//-----------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(test_run)
+{
+    thread_pool pool(4);
+    std::vector<size_t> counts(103,0);
+    
+    for(size_t n=0;n<5;++n)
+        pool.run(counts.size(),[&counts](size_t c){ counts[c]++; });
+
+    for(auto c: counts) BOOST_CHECK_EQUAL(c,5u);
+}
+
+//-----------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(test_static_assignment)
+{
+    thread_pool pool(3);
+    std::vector<std::thread::id> first(30),second(30);
+
+    pool.run(30,[&first](size_t c){ first[c] = std::this_thread::get_id(); });
+    pool.run(30,[&second](size_t c){ second[c] = std::this_thread::get_id(); });
+
+    BOOST_CHECK(first == second);
+    for(size_t c=0;c<30;c+=3) 
+        BOOST_CHECK(first[c] == std::this_thread::get_id());
+}
+
+//-----------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(test_nested)
+{
+    thread_pool pool(4);
+    std::atomic<size_t> count(0);
+
+    pool.run(8,[&pool,&count](size_t)
+    {
+        pool.run(8,[&count](size_t){ count++; });
+    });
+    BOOST_CHECK_EQUAL(count.load(),64u);
+}
+
+//-----------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(test_exception)
+{
+    thread_pool pool(4);
+    std::atomic<size_t> count(0);
+
+    BOOST_CHECK_THROW(pool.run(16,[&count](size_t c)
+                      {
+                          count++;
+                          if(c==5) throw range_error(EXCEPTION_RECORD,"test");
+                      }),range_error);
+    BOOST_CHECK(count.load()>=6u);
+
+    //the pool must still be usable
+    count = 0;
+    pool.run(16,[&count](size_t){ count++; });
+    BOOST_CHECK_EQUAL(count.load(),16u);
+}
+
+//-----------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(test_parallel_for)
+{
+    thread_pool::instance().resize(4);
+    std::vector<int> data(1000,0);
+
+    parallel_for(data.size(),64,[&data](size_t begin,size_t end)
+    {
+        for(size_t i=begin;i<end;++i) data[i] += int(i);
+    });
+
+    for(size_t i=0;i<data.size();++i) BOOST_CHECK_EQUAL(data[i],int(i));
+    thread_pool::instance().resize(thread_pool::default_size());
+}
+
+BOOST_AUTO_TEST_SUITE_END()